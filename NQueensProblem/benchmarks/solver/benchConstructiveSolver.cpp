@@ -0,0 +1,89 @@
+#include <iostream>  /* std::cout, std::endl */
+#include <chrono>    /* std::chrono */
+#include <string>    /* std::stoul */
+#include <vector>    /* std::vector */
+
+#include "solver/ConstructiveSolver.h"
+
+using namespace nsSolver;
+
+#define DEFAULT_QUEENSCOUNT 100000000U
+#define RUN_COUNT           5U
+
+/* O(N) check: one bit per line and per diagonal */
+static bool checkSolution(const std::vector<uint32_t>& solution)
+{
+    uint64_t i;
+    uint64_t size;
+    std::vector<bool> lines;
+    std::vector<bool> diagUp;
+    std::vector<bool> diagDown;
+
+    size     = solution.size();
+    lines    = std::vector<bool>(size, false);
+    diagUp   = std::vector<bool>(2 * size, false);
+    diagDown = std::vector<bool>(2 * size, false);
+
+    for(i = 0; i < size; ++i)
+    {
+        if(solution[i] >= size ||
+           lines[solution[i]] ||
+           diagUp[i + solution[i]] ||
+           diagDown[i + size - solution[i]])
+        {
+            return false;
+        }
+        lines[solution[i]]              = true;
+        diagUp[i + solution[i]]         = true;
+        diagDown[i + size - solution[i]] = true;
+    }
+
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t i;
+    uint32_t queensCount;
+    uint32_t attackCount;
+    double   elapsed;
+    double   bestElapsed;
+
+    std::vector<uint32_t> solution;
+    std::chrono::high_resolution_clock::time_point start;
+
+    queensCount = DEFAULT_QUEENSCOUNT;
+    if(argc > 1)
+    {
+        queensCount = std::stoul(argv[1]);
+    }
+
+    ConstructiveSolver solver(queensCount);
+
+    bestElapsed = -1;
+    for(i = 0; i < RUN_COUNT; ++i)
+    {
+        start = std::chrono::high_resolution_clock::now();
+        solver.solve(solution, attackCount);
+        elapsed = std::chrono::duration<double>(
+                    std::chrono::high_resolution_clock::now() - start).count();
+        if(bestElapsed < 0 || elapsed < bestElapsed)
+        {
+            bestElapsed = elapsed;
+        }
+    }
+
+    std::cout << "N = " << queensCount
+              << " | Best of " << RUN_COUNT << ": " << bestElapsed << "s"
+              << " | " << (bestElapsed * 1e9 / queensCount) << "ns/queen"
+              << " | Attack count: " << attackCount << std::endl;
+
+    if(!checkSolution(solution))
+    {
+        std::cout << "\033[1;31mINVALID SOLUTION\033[0m\t" << std::endl;
+        return -1;
+    }
+    std::cout << "\033[1;32mVALID SOLUTION\033[0m\t" << std::endl;
+
+    return 0;
+}
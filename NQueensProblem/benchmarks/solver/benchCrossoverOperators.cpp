@@ -0,0 +1,170 @@
+#include <iostream>  /* std::cout, std::endl, std::ostream */
+#include <chrono>    /* std::chrono */
+#include <string>    /* std::stoul, std::string */
+#include <vector>    /* std::vector */
+#include <numeric>   /* std::iota */
+#include <algorithm> /* std::shuffle */
+#include <random>    /* std::mt19937 */
+
+#include "solver/GeneticSolver.h"
+#include "solver/OrderOneCrossoverOperator.h"
+#include "solver/PMXCrossoverOperator.h"
+#include "solver/CycleCrossoverOperator.h"
+
+using namespace nsSolver;
+
+#define DEFAULT_QUEENSCOUNT 100U
+#define DEFAULT_ITERCOUNT   2000U
+#define DEFAULT_RUNS        5U
+#define BENCH_POPULATION    100U
+#define BENCH_ROUNDS        1000U
+
+/* Mates a random population BENCH_ROUNDS times and returns the time spent
+ * per child */
+static double measureChildTime(CrossoverOperator& crossover,
+                               const uint32_t     queensCount)
+{
+    uint32_t i;
+    double   elapsed;
+
+    std::vector<std::vector<uint32_t>> population(BENCH_POPULATION);
+    std::vector<std::vector<uint32_t>> children(BENCH_POPULATION);
+    std::vector<const uint32_t*>       pop(BENCH_POPULATION);
+    std::vector<uint32_t*>             newChildren(BENCH_POPULATION);
+    std::vector<uint32_t>              matingPool(BENCH_POPULATION);
+    std::chrono::high_resolution_clock::time_point start;
+    std::mt19937 generator(0);
+
+    for(i = 0; i < BENCH_POPULATION; ++i)
+    {
+        population[i] = std::vector<uint32_t>(queensCount);
+        children[i]   = std::vector<uint32_t>(queensCount);
+        std::iota(population[i].begin(), population[i].end(), 0);
+        std::shuffle(population[i].begin(), population[i].end(), generator);
+        pop[i]         = population[i].data();
+        newChildren[i] = children[i].data();
+        matingPool[i]  = i;
+    }
+
+    /* The first call sizes the operator tables */
+    crossover(queensCount, pop.data(), BENCH_POPULATION, matingPool.data(),
+              BENCH_POPULATION, newChildren.data());
+
+    start = std::chrono::high_resolution_clock::now();
+    for(i = 0; i < BENCH_ROUNDS; ++i)
+    {
+        std::shuffle(matingPool.begin(), matingPool.end(), generator);
+        crossover(queensCount, pop.data(), BENCH_POPULATION,
+                  matingPool.data(), BENCH_POPULATION, newChildren.data());
+    }
+    elapsed = std::chrono::duration<double, std::nano>(
+                std::chrono::high_resolution_clock::now() - start).count();
+
+    return elapsed / ((double)BENCH_ROUNDS * BENCH_POPULATION);
+}
+
+/* Runs the solver RUNS times with the operator and reports the generations
+ * needed to reach a zero conflict solution */
+static void runOperator(const std::string& name,
+                        CrossoverOperator& crossover,
+                        const uint32_t     queensCount,
+                        const uint32_t     iterCount,
+                        const uint32_t     runs)
+{
+    uint32_t i;
+    uint32_t solved;
+    uint32_t attackCount;
+    uint64_t generationSum;
+    double   childTime;
+    double   elapsed;
+
+    std::vector<uint32_t> solution;
+    std::chrono::high_resolution_clock::time_point start;
+    std::streambuf* output;
+    std::string     error;
+    GeneticParameters parameters;
+
+    childTime = measureChildTime(crossover, queensCount);
+    parameters.set("crossover-operator", name, error);
+
+    solved        = 0;
+    generationSum = 0;
+    elapsed       = 0;
+    for(i = 0; i < runs; ++i)
+    {
+        GeneticSolver solver(queensCount, iterCount, parameters);
+
+        /* Silence the solver progress */
+        output = std::cout.rdbuf(nullptr);
+        start  = std::chrono::high_resolution_clock::now();
+        solver.solve(solution, attackCount);
+        elapsed += std::chrono::duration<double>(
+                    std::chrono::high_resolution_clock::now() - start).count();
+        std::cout.rdbuf(output);
+
+        if(attackCount == 0)
+        {
+            ++solved;
+            generationSum += solver.getGenerationCount();
+        }
+    }
+
+    std::cout << name
+              << "\t| " << childTime << " ns/child"
+              << " | Solved: " << solved << "/" << runs
+              << " | Mean generations to zero: ";
+    if(solved != 0)
+    {
+        std::cout << (double)generationSum / solved;
+    }
+    else
+    {
+        std::cout << "-";
+    }
+    std::cout << " | Mean time: " << elapsed / runs << "s" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t queensCount;
+    uint32_t iterCount;
+    uint32_t runs;
+
+    OrderOneCrossoverOperator orderOne;
+    PMXCrossoverOperator      pmx;
+    CycleCrossoverOperator    cycle;
+
+    /* Arguments: [N] [ITERCOUNT] [RUNS] */
+    queensCount = DEFAULT_QUEENSCOUNT;
+    iterCount   = DEFAULT_ITERCOUNT;
+    runs        = DEFAULT_RUNS;
+    if(argc > 1)
+    {
+        queensCount = std::stoul(argv[1]);
+    }
+    if(argc > 2)
+    {
+        iterCount = std::stoul(argv[2]);
+    }
+    if(argc > 3)
+    {
+        runs = std::stoul(argv[3]);
+    }
+    if(queensCount == 0)
+    {
+        queensCount = 1;
+    }
+    if(runs == 0)
+    {
+        runs = 1;
+    }
+
+    std::cout << "N = " << queensCount << " | Iterations: " << iterCount
+              << " | Runs: " << runs << std::endl;
+
+    runOperator("order1", orderOne, queensCount, iterCount, runs);
+    runOperator("pmx", pmx, queensCount, iterCount, runs);
+    runOperator("cycle", cycle, queensCount, iterCount, runs);
+
+    return 0;
+}
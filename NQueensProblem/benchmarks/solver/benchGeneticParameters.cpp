@@ -0,0 +1,121 @@
+#include <iostream>  /* std::cout, std::endl, std::ostream */
+#include <chrono>    /* std::chrono */
+#include <string>    /* std::stoul, std::string */
+#include <vector>    /* std::vector */
+
+#include "solver/GeneticSolver.h"
+
+using namespace nsSolver;
+
+#define DEFAULT_QUEENSCOUNT 100U
+#define DEFAULT_ITERCOUNT   2000U
+#define DEFAULT_RUNS        5U
+
+/* Runs the solver RUNS times and reports the time to solution */
+static void runConfiguration(const std::string&       name,
+                             const uint32_t           queensCount,
+                             const uint32_t           iterCount,
+                             const uint32_t           runs,
+                             const GeneticParameters& parameters,
+                             double&                  meanTime)
+{
+    uint32_t i;
+    uint32_t solved;
+    uint32_t attackCount;
+    uint64_t attackSum;
+    double   elapsed;
+
+    std::vector<uint32_t> solution;
+    std::chrono::high_resolution_clock::time_point start;
+    std::streambuf* output;
+
+    solved    = 0;
+    attackSum = 0;
+    meanTime  = 0;
+    for(i = 0; i < runs; ++i)
+    {
+        GeneticSolver solver(queensCount, iterCount, parameters);
+
+        /* Silence the solver progress */
+        output = std::cout.rdbuf(nullptr);
+        start  = std::chrono::high_resolution_clock::now();
+        solver.solve(solution, attackCount);
+        elapsed = std::chrono::duration<double>(
+                    std::chrono::high_resolution_clock::now() - start).count();
+        std::cout.rdbuf(output);
+
+        meanTime  += elapsed;
+        attackSum += attackCount;
+        solved    += (attackCount == 0);
+    }
+    meanTime /= runs;
+
+    std::cout << name
+              << " | Solved: " << solved << "/" << runs
+              << " | Mean time: " << meanTime << "s"
+              << " | Mean attack count: " << (double)attackSum / runs
+              << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t queensCount;
+    uint32_t iterCount;
+    uint32_t runs;
+    double   baselineTime;
+    double   tunedTime;
+    double   adaptiveTime;
+
+    std::string error;
+
+    GeneticParameters baseline;
+    GeneticParameters tuned;
+    GeneticParameters adaptive;
+
+    /* Arguments: [N] [ITERCOUNT] [RUNS] [CONFIG] */
+    queensCount = DEFAULT_QUEENSCOUNT;
+    iterCount   = DEFAULT_ITERCOUNT;
+    runs        = DEFAULT_RUNS;
+    if(argc > 1)
+    {
+        queensCount = std::stoul(argv[1]);
+    }
+    if(argc > 2)
+    {
+        iterCount = std::stoul(argv[2]);
+    }
+    if(argc > 3)
+    {
+        runs = std::stoul(argv[3]);
+    }
+    if(argc > 4 && (!tuned.loadFile(argv[4], error) || !tuned.validate(error)))
+    {
+        std::cout << error << std::endl;
+        return -1;
+    }
+    if(runs == 0)
+    {
+        runs = 1;
+    }
+    adaptive               = tuned;
+    adaptive.adaptiveRates = true;
+
+    std::cout << "N = " << queensCount << " | Iterations: " << iterCount
+              << " | Runs: " << runs << std::endl;
+
+    runConfiguration("Baseline", queensCount, iterCount, runs, baseline,
+                     baselineTime);
+    if(argc > 4)
+    {
+        runConfiguration("Config  ", queensCount, iterCount, runs, tuned,
+                         tunedTime);
+        std::cout << "Config speedup: " << baselineTime / tunedTime
+                  << std::endl;
+    }
+    runConfiguration("Adaptive", queensCount, iterCount, runs, adaptive,
+                     adaptiveTime);
+    std::cout << "Adaptive speedup: " << baselineTime / adaptiveTime
+              << std::endl;
+
+    return 0;
+}
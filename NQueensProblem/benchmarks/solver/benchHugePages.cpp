@@ -0,0 +1,191 @@
+#include <iostream>  /* std::cout, std::endl, std::ostream */
+#include <chrono>    /* std::chrono */
+#include <string>    /* std::stoul, std::string */
+#include <vector>    /* std::vector */
+#include <random>    /* std::mt19937 */
+#include <utility>   /* std::swap */
+
+#include "solver/GeneticSolver.h"
+#include "solver/GeneticParameters.h"
+#include "solver/HugePageAllocator.h"
+
+using namespace nsSolver;
+
+#define DEFAULT_QUEENSCOUNT 2000U
+#define DEFAULT_ITERCOUNT   50U
+#define DEFAULT_RUNS        3U
+#define DEFAULT_BUFFER_MB   256U
+#define BENCH_ACCESSES      (1U << 22)
+
+/* Follows a random cycle over a buffer of the allocator, each access depends
+ * on the previous one and most of them miss the TLB with regular pages */
+static double measureLatency(const HugePageMode mode,
+                             const uint32_t     size,
+                             HugePageMode*      backing,
+                             size_t*            hugeBytes)
+{
+    uint32_t  i;
+    uint32_t  j;
+    uint32_t  index;
+    uint32_t* buffer;
+    double    latency;
+
+    std::mt19937 generator(size);
+    std::chrono::high_resolution_clock::time_point start;
+
+    HugePageAllocator allocator(mode);
+
+    buffer = (uint32_t*)allocator.allocate((size_t)size * sizeof(uint32_t));
+    for(i = 0; i < size; ++i)
+    {
+        buffer[i] = i;
+    }
+    /* Sattolo's algorithm gives a single cycle */
+    for(i = size - 1; i > 0; --i)
+    {
+        j = generator() % i;
+        std::swap(buffer[i], buffer[j]);
+    }
+    *backing   = allocator.getBacking(buffer);
+    *hugeBytes = HugePageAllocator::getTransparentHugeBytes();
+
+    index = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for(i = 0; i < BENCH_ACCESSES; ++i)
+    {
+        index = buffer[index];
+    }
+    latency = std::chrono::duration<double, std::nano>(
+                std::chrono::high_resolution_clock::now() - start).count() /
+              BENCH_ACCESSES;
+
+    /* Keep the chase */
+    if(index == UINT32_MAX)
+    {
+        std::cout << index;
+    }
+
+    return latency;
+}
+
+/* Runs the solver RUNS times and returns the mean time */
+static double runSolver(const uint32_t     queensCount,
+                        const uint32_t     iterCount,
+                        const uint32_t     runs,
+                        const HugePageMode mode,
+                        HugePageMode*      backing,
+                        size_t*            hugeBytes)
+{
+    uint32_t i;
+    uint32_t attackCount;
+    double   elapsed;
+
+    std::vector<uint32_t> solution;
+    std::chrono::high_resolution_clock::time_point start;
+    std::streambuf* output;
+
+    GeneticParameters parameters;
+
+    parameters.hugePages = HugePageAllocator::getModeName(mode);
+
+    elapsed = 0;
+    for(i = 0; i < runs; ++i)
+    {
+        GeneticSolver solver(queensCount, iterCount, parameters);
+
+        /* Silence the solver progress */
+        output = std::cout.rdbuf(nullptr);
+        start  = std::chrono::high_resolution_clock::now();
+        solver.solve(solution, attackCount);
+        elapsed += std::chrono::duration<double>(
+                    std::chrono::high_resolution_clock::now() - start).count();
+        std::cout.rdbuf(output);
+
+        *backing   = solver.getHugePageBacking();
+        *hugeBytes = HugePageAllocator::getTransparentHugeBytes();
+    }
+
+    return elapsed / runs;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t     i;
+    uint32_t     queensCount;
+    uint32_t     iterCount;
+    uint32_t     runs;
+    uint32_t     size;
+    double       latency;
+    double       elapsed;
+    double       reference;
+    size_t       hugeBytes;
+    HugePageMode backing;
+
+    const HugePageMode modes[] = {
+        HUGE_PAGES_OFF, HUGE_PAGES_TRANSPARENT, HUGE_PAGES_EXPLICIT
+    };
+
+    /* Arguments: [N] [ITERCOUNT] [RUNS] [BUFFER_MB] */
+    queensCount = DEFAULT_QUEENSCOUNT;
+    iterCount   = DEFAULT_ITERCOUNT;
+    runs        = DEFAULT_RUNS;
+    size        = DEFAULT_BUFFER_MB;
+    if(argc > 1)
+    {
+        queensCount = std::stoul(argv[1]);
+    }
+    if(argc > 2)
+    {
+        iterCount = std::stoul(argv[2]);
+    }
+    if(argc > 3)
+    {
+        runs = std::stoul(argv[3]);
+    }
+    if(argc > 4)
+    {
+        size = std::stoul(argv[4]);
+    }
+    if(runs == 0)
+    {
+        runs = 1;
+    }
+    size = (size == 0 ? 1 : size) * (1024 * 1024 / sizeof(uint32_t));
+
+    /* Random access latency of each mode */
+    reference = 0;
+    for(i = 0; i < sizeof(modes) / sizeof(modes[0]); ++i)
+    {
+        latency = measureLatency(modes[i], size, &backing, &hugeBytes);
+        if(i == 0)
+        {
+            reference = latency;
+        }
+        std::cout << "Buffer " << HugePageAllocator::getModeName(modes[i])
+                  << " (backing " << HugePageAllocator::getModeName(backing)
+                  << ", " << hugeBytes / 1024 << " kB transparent huge): "
+                  << latency << " ns/access | Speedup: "
+                  << reference / latency << std::endl;
+    }
+
+    /* Genetic solver with each mode */
+    std::cout << "N = " << queensCount << " | Iterations: " << iterCount
+              << " | Runs: " << runs << std::endl;
+    reference = 0;
+    for(i = 0; i < sizeof(modes) / sizeof(modes[0]); ++i)
+    {
+        elapsed = runSolver(queensCount, iterCount, runs, modes[i],
+                            &backing, &hugeBytes);
+        if(i == 0)
+        {
+            reference = elapsed;
+        }
+        std::cout << "Solver " << HugePageAllocator::getModeName(modes[i])
+                  << " (backing " << HugePageAllocator::getModeName(backing)
+                  << ", " << hugeBytes / 1024 << " kB transparent huge): "
+                  << elapsed << "s | Speedup: " << reference / elapsed
+                  << std::endl;
+    }
+
+    return 0;
+}
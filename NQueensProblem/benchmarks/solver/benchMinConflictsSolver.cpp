@@ -0,0 +1,62 @@
+#include <iostream>  /* std::cout, std::endl */
+#include <chrono>    /* std::chrono */
+#include <string>    /* std::stoul */
+#include <vector>    /* std::vector */
+
+#include "solver/MinConflictsSolver.h"
+
+using namespace nsSolver;
+
+#define DEFAULT_QUEENSCOUNT 10000000U
+#define DEFAULT_ROUNDS      1000U
+
+int main(int argc, char** argv)
+{
+    uint32_t queensCount;
+    uint32_t threadCount;
+    uint32_t rounds;
+    uint32_t attackCount;
+    double   elapsed;
+
+    std::vector<uint32_t> solution;
+    std::chrono::high_resolution_clock::time_point start;
+
+    /* Arguments: [N] [THREADS] [ROUNDS], 0 threads uses every core */
+    queensCount = DEFAULT_QUEENSCOUNT;
+    threadCount = 0;
+    rounds      = DEFAULT_ROUNDS;
+    if(argc > 1)
+    {
+        queensCount = std::stoul(argv[1]);
+    }
+    if(argc > 2)
+    {
+        threadCount = std::stoul(argv[2]);
+    }
+    if(argc > 3)
+    {
+        rounds = std::stoul(argv[3]);
+    }
+
+    MinConflictsSolver solver(queensCount, rounds, threadCount);
+
+    start = std::chrono::high_resolution_clock::now();
+    solver.solve(solution, attackCount);
+    elapsed = std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - start).count();
+
+    std::cout << "N = " << queensCount
+              << " | Threads: " << threadCount
+              << " | Time: " << elapsed << "s"
+              << " | " << (elapsed * 1e9 / queensCount) << "ns/queen"
+              << " | Attack count: " << attackCount << std::endl;
+
+    if(attackCount != 0)
+    {
+        std::cout << "\033[1;31mNOT SOLVED\033[0m\t" << std::endl;
+        return -1;
+    }
+    std::cout << "\033[1;32mSOLVED\033[0m\t" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,251 @@
+#include <iostream>  /* std::cout, std::endl, std::ostream */
+#include <chrono>    /* std::chrono */
+#include <string>    /* std::stoul, std::string */
+#include <vector>    /* std::vector */
+#include <thread>    /* std::thread */
+#include <random>    /* std::mt19937 */
+#include <utility>   /* std::swap */
+
+#include "solver/GeneticSolver.h"
+#include "solver/ThreadAffinity.h"
+
+using namespace nsSolver;
+
+#define DEFAULT_QUEENSCOUNT 2000U
+#define DEFAULT_ITERCOUNT   50U
+#define DEFAULT_RUNS        3U
+#define DEFAULT_BUFFER_MB   64U
+#define BENCH_ACCESSES      (1U << 22)
+
+/* Allocates the buffer and links its cells in one random cycle, the pages
+ * are first touched by the calling thread */
+static void allocThread(const ThreadAffinity* affinity,
+                        const uint32_t        worker,
+                        const uint32_t        size,
+                        uint32_t**            buffer)
+{
+    uint32_t i;
+    uint32_t j;
+
+    std::mt19937 generator(size);
+
+    if(affinity != nullptr)
+    {
+        affinity->pin(worker);
+    }
+
+    *buffer = new uint32_t[size];
+    for(i = 0; i < size; ++i)
+    {
+        (*buffer)[i] = i;
+    }
+    /* Sattolo's algorithm gives a single cycle */
+    for(i = size - 1; i > 0; --i)
+    {
+        j = generator() % i;
+        std::swap((*buffer)[i], (*buffer)[j]);
+    }
+}
+
+/* Follows the cycle, each access depends on the previous one so the time
+ * per access is the memory latency */
+static void chaseThread(const ThreadAffinity* affinity,
+                        const uint32_t        worker,
+                        const uint32_t*       buffer,
+                        double*               latency)
+{
+    uint32_t i;
+    uint32_t index;
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(affinity != nullptr)
+    {
+        affinity->pin(worker);
+    }
+
+    index = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for(i = 0; i < BENCH_ACCESSES; ++i)
+    {
+        index = buffer[index];
+    }
+    *latency = std::chrono::duration<double, std::nano>(
+                std::chrono::high_resolution_clock::now() - start).count() /
+               BENCH_ACCESSES;
+
+    /* Keep the chase */
+    if(index == UINT32_MAX)
+    {
+        std::cout << index;
+    }
+}
+
+/* Allocates on one worker and reads from another one */
+static double measureLatency(const ThreadAffinity* affinity,
+                             const uint32_t        allocWorker,
+                             const uint32_t        readWorker,
+                             const uint32_t        size)
+{
+    double    latency;
+    uint32_t* buffer;
+
+    std::thread(allocThread, affinity, allocWorker, size, &buffer).join();
+    std::thread(chaseThread, affinity, readWorker, buffer, &latency).join();
+    delete[] buffer;
+
+    return latency;
+}
+
+/* Runs the solver RUNS times and returns the mean time */
+static double runSolver(const uint32_t queensCount,
+                        const uint32_t iterCount,
+                        const uint32_t runs,
+                        const bool     pinned)
+{
+    uint32_t i;
+    uint32_t attackCount;
+    double   elapsed;
+
+    std::vector<uint32_t> solution;
+    std::chrono::high_resolution_clock::time_point start;
+    std::streambuf* output;
+
+    elapsed = 0;
+    for(i = 0; i < runs; ++i)
+    {
+        GeneticSolver solver(queensCount, iterCount);
+        solver.enableAffinity(pinned);
+
+        /* Silence the solver progress */
+        output = std::cout.rdbuf(nullptr);
+        start  = std::chrono::high_resolution_clock::now();
+        solver.solve(solution, attackCount);
+        elapsed += std::chrono::duration<double>(
+                    std::chrono::high_resolution_clock::now() - start).count();
+        std::cout.rdbuf(output);
+    }
+
+    return elapsed / runs;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t queensCount;
+    uint32_t iterCount;
+    uint32_t runs;
+    uint32_t size;
+    uint32_t localCount;
+    uint32_t remoteCount;
+    double   latency;
+    double   local;
+    double   remote;
+    double   unpinned;
+    double   unpinnedTime;
+    double   pinnedTime;
+
+    std::vector<uint32_t> nodeWorkers;
+
+    ThreadAffinity affinity;
+
+    /* Arguments: [N] [ITERCOUNT] [RUNS] [BUFFER_MB] */
+    queensCount = DEFAULT_QUEENSCOUNT;
+    iterCount   = DEFAULT_ITERCOUNT;
+    runs        = DEFAULT_RUNS;
+    size        = DEFAULT_BUFFER_MB;
+    if(argc > 1)
+    {
+        queensCount = std::stoul(argv[1]);
+    }
+    if(argc > 2)
+    {
+        iterCount = std::stoul(argv[2]);
+    }
+    if(argc > 3)
+    {
+        runs = std::stoul(argv[3]);
+    }
+    if(argc > 4)
+    {
+        size = std::stoul(argv[4]);
+    }
+    if(runs == 0)
+    {
+        runs = 1;
+    }
+    size = (size == 0 ? 1 : size) * (1024 * 1024 / sizeof(uint32_t));
+
+    std::cout << "Cores: " << affinity.getCpuCount()
+              << " | Nodes: " << affinity.getNodeCount() << std::endl;
+
+    /* First worker of each node */
+    for(i = 0; i < affinity.getCpuCount(); ++i)
+    {
+        if(affinity.getNode(i) == nodeWorkers.size())
+        {
+            nodeWorkers.push_back(i);
+        }
+    }
+
+    /* Latency from each node to the memory of each node */
+    local       = 0;
+    remote      = 0;
+    localCount  = 0;
+    remoteCount = 0;
+    for(i = 0; i < nodeWorkers.size(); ++i)
+    {
+        for(j = 0; j < nodeWorkers.size(); ++j)
+        {
+            latency = measureLatency(&affinity, nodeWorkers[i],
+                                     nodeWorkers[j], size);
+            std::cout << "Memory of node " << i << " read from node " << j
+                      << ": " << latency << " ns/access" << std::endl;
+            if(i == j)
+            {
+                local += latency;
+                ++localCount;
+            }
+            else
+            {
+                remote += latency;
+                ++remoteCount;
+            }
+        }
+    }
+    local /= localCount;
+
+    unpinned = 0;
+    for(i = 0; i < runs; ++i)
+    {
+        unpinned += measureLatency(nullptr, 0, 0, size);
+    }
+    unpinned /= runs;
+
+    std::cout << "Pinned local: " << local << " ns/access" << std::endl;
+    if(remoteCount != 0)
+    {
+        remote /= remoteCount;
+        std::cout << "Pinned remote: " << remote << " ns/access"
+                  << " | Remote penalty: " << remote / local << std::endl;
+    }
+    else
+    {
+        std::cout << "Pinned remote: single node, no remote memory"
+                  << std::endl;
+    }
+    std::cout << "Unpinned: " << unpinned << " ns/access"
+              << " | Penalty: " << unpinned / local << std::endl;
+
+    /* Genetic solver with and without pinning */
+    std::cout << "N = " << queensCount << " | Iterations: " << iterCount
+              << " | Runs: " << runs << std::endl;
+    unpinnedTime = runSolver(queensCount, iterCount, runs, false);
+    pinnedTime   = runSolver(queensCount, iterCount, runs, true);
+    std::cout << "Unpinned solver: " << unpinnedTime << "s" << std::endl
+              << "Pinned solver: " << pinnedTime << "s"
+              << " | Speedup: " << unpinnedTime / pinnedTime << std::endl;
+
+    return 0;
+}
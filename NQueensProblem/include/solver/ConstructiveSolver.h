@@ -0,0 +1,109 @@
+/******************************************************************************
+ * File: ConstructiveSolver.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * ConstructiveSolver implements the Solver class. Any class implementing the
+ * Solver interface is assumed to solve the N Queens Problem.
+ * The algorithm used to solve the problem is the explicit closed-form
+ * construction (split by N mod 6) that exists for every N >= 4.
+ ******************************************************************************/
+
+#ifndef __SOLVER_CONSTRUCTIVE_SOLVER_H
+#define __SOLVER_CONSTRUCTIVE_SOLVER_H
+
+#include <cstdint> /* uint32_t */
+#include <vector>  /* std::vector */
+
+#include <solver/Solver.h> /* nsSolver::Sovler */
+
+/**
+ * @brief N Queens problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Constructive Solver, writes a zero conflict placement in O(N)
+     * time without any search.
+     *
+     * The queens are placed on the even lines first, then on the odd lines.
+     * When N mod 6 is 2, lines 1 and 3 are swapped and line 5 is moved to the
+     * end. When N mod 6 is 3, line 2 is moved to the end of the even lines and
+     * lines 1 and 3 to the end of the odd lines (lines are 1-based here).
+     * No solution exists for N = 2 and N = 3, the solver then returns the
+     * placement given by the same pattern, which has the minimal attack count.
+     *
+     */
+    class ConstructiveSolver: public Solver
+    {
+        private:
+            /**
+             * @brief The number of queens the problem has to solve.
+             *
+             */
+            uint32_t queensCount;
+
+            /**
+             * @brief Computer the number of attacks of the current solution.
+             *
+             * @param[in] solution The current solution for which we need to
+             * compute the number of possible attacks.
+             *
+             * @return uint32_t The number of possible attacks for the solution.
+             */
+            uint32_t
+            getAttackCount(const std::vector<uint32_t>& solution) const;
+
+        public:
+            /**
+             * @brief Destroy the ConstructiveSolver object.
+             *
+             */
+            virtual ~ConstructiveSolver(void);
+
+            /**
+             * @brief Default contructor, unused.
+             *
+             */
+            ConstructiveSolver(void) = delete;
+
+            /**
+             * @brief Construct a new Constructive Solver object
+             *
+             * @param[in] queensCount The number of queens the problem has to
+             * solve.
+             */
+            ConstructiveSolver(const uint32_t queensCount);
+
+            /**
+             * @brief Solves the N Queens problem and store the solution in the
+             * vector given as parameter.
+             *
+             * @param[out] solution The vector receiving the solution for the
+             * problem. The vector's index represents the Queen's column, the
+             * value at the index represents the Queen's line. -1 represents no
+             * Queen in the column.
+             *
+             * @param[out] attackCount The number of possible attack with the
+             * current solution.
+             */
+            virtual void solve(std::vector<uint32_t>& solution,
+                               uint32_t &attackCount);
+
+#ifdef _TESTMODE
+            /**
+             * @brief Tests the solve method.
+             *
+             */
+            void testSolve(void);
+#endif
+
+    };
+}
+
+#endif /* #ifndef __SOLVER_CONSTRUCTIVE_SOLVER_H */
@@ -38,18 +38,23 @@ namespace nsSolver
              * @param[in] individualSize The size of an individual.
              * @param[in] pop The population to use.
              * @param[in] popSize The size of the population.
+             * @param[in] popHash The Zobrist hashes of the population.
              * @param[in] matingPool The selected individuals to mate (indexes
              * in population).
              * @param[in] matingPoolSize The number of parents that should be
              * mated.
              * @param[out] newChildren The generated children.
+             * @param[out] childrenHash The Zobrist hashes of the children,
+             * derived from the parents hashes with the genes that differ.
              */
             virtual void operator()(const uint32_t   individualSize,
                                     const uint32_t** pop,
                                     const uint32_t   popSize,
+                                    const uint64_t*  popHash,
                                     const uint32_t*  matingPool,
                                     const uint32_t   matingPoolSize,
-                                    uint32_t**       newChildren) = 0;
+                                    uint32_t**       newChildren,
+                                    uint64_t*        childrenHash) = 0;
 
             /**
              * @brief Destroy the Crossover Operator object.
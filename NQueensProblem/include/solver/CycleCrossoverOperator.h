@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * File: CycleCrossoverOperator.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Crossover operator implementing the cycle crossover (CX).
+ * The positions of the parents are split in cycles: following a cycle from a
+ * position of parent 1 to the position of parent 1 holding the allele of
+ * parent 2 at the same position. The children take their alleles from each
+ * parent alternately, one cycle at a time.
+ ******************************************************************************/
+
+#ifndef __SOLVER_CYCLE_CROSSOVER_OPERATOR_H_
+#define __SOLVER_CYCLE_CROSSOVER_OPERATOR_H_
+
+#include <cstdint> /* Generic int types */
+#include <vector>  /* std::vector */
+#include <random>  /* std::default_random_engine */
+
+#include <solver/CrossoverOperator.h> /* nsSolver::CrossoverOperator */
+
+/**
+ * @brief N Queens problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Cycle crossover. Every gene of a child comes from one of the
+     * parents at the same column, no queen is moved to another column.
+     *
+     * The parent giving the first cycle is drawn at random so the children
+     * of a pair of parents differ from one generation to the other. The
+     * position and visited tables are kept between calls, the operator does
+     * not allocate once it has seen the individual size. An operator instance
+     * must not be shared by several threads.
+     *
+     */
+    class CycleCrossoverOperator: public CrossoverOperator
+    {
+        private:
+            /**
+             * @brief Random number engine.
+             *
+             */
+            std::default_random_engine randomGenerator;
+
+            /**
+             * @brief Position of each allele in parent 1.
+             *
+             */
+            std::vector<uint32_t> positions;
+
+            /**
+             * @brief Tells if each position already belongs to a cycle.
+             *
+             */
+            std::vector<uint8_t> visited;
+
+            /**
+             * @brief apply the crossover between two parents ot create two new
+             * children.
+             *
+             * @param[in] individualSize The size of an individual.
+             * @param[in] parents The parents to mate.
+             * @param[in] parentsHash The Zobrist hashes of the parents.
+             * @param[out] children The array of children to be created.
+             * @param[out] childrenHash The Zobrist hashes of the children.
+             */
+            void mate(const uint32_t   individualSize,
+                      const uint32_t** parents,
+                      const uint64_t*  parentsHash,
+                      uint32_t**       children,
+                      uint64_t*        childrenHash);
+
+        public:
+            /**
+             * @brief Generate new offstring from the mating pool given as
+             * parameter.
+             *
+             * @param[in] individualSize The size of an individual.
+             * @param[in] pop The population to use.
+             * @param[in] popSize The size of the population.
+             * @param[in] popHash The Zobrist hashes of the population.
+             * @param[in] matingPool The selected individuals to mate (indexes
+             * in population).
+             * @param[in] matingPoolSize The number of parents that should be
+             * mated.
+             * @param[out] newChildren The generated children.
+             * @param[out] childrenHash The Zobrist hashes of the children,
+             * derived from the parents hashes with the genes that differ.
+             */
+            virtual void operator()(const uint32_t   individualSize,
+                                    const uint32_t** pop,
+                                    const uint32_t   popSize,
+                                    const uint64_t*  popHash,
+                                    const uint32_t*  matingPool,
+                                    const uint32_t   matingPoolSize,
+                                    uint32_t**       newChildren,
+                                    uint64_t*        childrenHash);
+
+            /**
+             * @brief Construct a new Cycle Crossover Operator object.
+             *
+             */
+            CycleCrossoverOperator(void);
+
+            /**
+             * @brief Destroy the Cycle Crossover Operator object.
+             *
+             */
+            virtual ~CycleCrossoverOperator(void) {}
+    };
+}
+
+#endif /* #ifndef __SOLVER_CYCLE_CROSSOVER_OPERATOR_H_ */
@@ -0,0 +1,180 @@
+/*******************************************************************************
+ * File: FileMigrantExchange.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Migrant exchange through the files of a directory. This is the fallback of
+ * the shared memory exchange, the directory can be local or shared by several
+ * machines.
+ ******************************************************************************/
+
+#ifndef __SOLVER_FILE_MIGRANT_EXCHANGE_H_
+#define __SOLVER_FILE_MIGRANT_EXCHANGE_H_
+
+#include <cstdint> /* Generic int types */
+#include <string>  /* std::string */
+#include <set>     /* std::set */
+#include <vector>  /* std::vector */
+
+#include <solver/MigrantExchange.h> /* nsSolver::MigrantExchange */
+
+#define MIGRANT_FILE_EXTENSION ".mig"
+
+/**
+ * @brief N Queens problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief File migrant exchange.
+     *
+     * Each migrant is a text file of the directory named after its publisher
+     * and its publication number: SENDER-NUMBER.mig. The file holds the
+     * individual size, the fitness and the genes separated by blanks. Files
+     * are written under a hidden temporary name and renamed, readers never
+     * see a partial file. A publisher keeps its last slotCount files and
+     * removes its files when the exchange is closed. Readers remember the
+     * files they already consumed.
+     *
+     */
+    class FileMigrantExchange: public MigrantExchange
+    {
+        private:
+            /**
+             * @brief The exchange directory, empty when the exchange is
+             * closed.
+             *
+             */
+            std::string directory;
+
+            /**
+             * @brief The size of an individual.
+             *
+             */
+            uint32_t individualSize;
+
+            /**
+             * @brief The number of files kept by the publisher.
+             *
+             */
+            uint32_t slotCount;
+
+            /**
+             * @brief Identifier of this exchange, prefix of its files.
+             *
+             */
+            std::string sender;
+
+            /**
+             * @brief Number of individuals published.
+             *
+             */
+            uint64_t publishCount;
+
+            /**
+             * @brief The files already consumed and still in the directory.
+             *
+             */
+            std::set<std::string> consumed;
+
+            /**
+             * @brief Scratch marks of the genes seen in a migrant, one per
+             * line.
+             *
+             */
+            std::vector<uint8_t> seen;
+
+            /**
+             * @brief Returns the path of a file published by this exchange.
+             *
+             * @param[in] number The publication number of the file.
+             *
+             * @return std::string The file path.
+             */
+            std::string getPath(const uint64_t number) const;
+
+            /**
+             * @brief Reads a migrant file.
+             *
+             * @param[in] path The file path.
+             * @param[out] individual The buffer receiving the individual.
+             * @param[out] fitness The fitness given by the publisher.
+             *
+             * @return True if the file holds a permutation of the exchange
+             * size, false otherwise.
+             */
+            bool readMigrant(const std::string& path,
+                             uint32_t*          individual,
+                             uint32_t&          fitness);
+
+        public:
+            /**
+             * @brief Construct a new closed File Migrant Exchange object.
+             *
+             */
+            FileMigrantExchange(void);
+
+            /**
+             * @brief Destroy the File Migrant Exchange object, the exchange
+             * is closed.
+             *
+             */
+            virtual ~FileMigrantExchange(void);
+
+            /**
+             * @brief Opens the exchange, the directory is created if it does
+             * not exist yet.
+             *
+             * @param[in] directory The exchange directory.
+             * @param[in] individualSize The size of an individual, files of
+             * other sizes are ignored.
+             * @param[in] slotCount The number of files kept by the publisher.
+             * @param[out] error The error description when the function fails.
+             *
+             * @return True if the exchange is open, false otherwise.
+             */
+            bool open(const std::string& directory,
+                      const uint32_t     individualSize,
+                      const uint32_t     slotCount,
+                      std::string&       error);
+
+            /**
+             * @brief Closes the exchange and removes the files it published.
+             *
+             */
+            void close(void);
+
+            /**
+             * @brief Publishes an individual to the other processes.
+             *
+             * @param[in] individual The individual to publish.
+             * @param[in] fitness The fitness of the individual.
+             *
+             * @return True if the individual was published, false otherwise.
+             */
+            virtual bool publish(const uint32_t* individual,
+                                 const uint32_t  fitness);
+
+            /**
+             * @brief Consumes the individuals published by the other
+             * processes since the last call, the most recent ones first.
+             * Invalid files are ignored.
+             *
+             * @param[out] individuals The buffers receiving the individuals.
+             * @param[out] fitness The fitness given by the publishers.
+             * @param[in] maxCount The number of buffers in individuals.
+             *
+             * @return uint32_t The number of individuals consumed.
+             */
+            virtual uint32_t consume(uint32_t**     individuals,
+                                     uint32_t*      fitness,
+                                     const uint32_t maxCount);
+    };
+}
+
+#endif /* #ifndef __SOLVER_FILE_MIGRANT_EXCHANGE_H_ */
@@ -0,0 +1,190 @@
+/*******************************************************************************
+ * File: FitnessCache.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Bounded concurrent fitness cache keyed by the Zobrist hash of the
+ * individuals.
+ ******************************************************************************/
+
+#ifndef __SOLVER_FITNESS_CACHE_H_
+#define __SOLVER_FITNESS_CACHE_H_
+
+#include <cstdint> /* Generic int types */
+#include <atomic>  /* std::atomic */
+
+/**
+ * @brief N Queens problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Bounded concurrent fitness cache. The cache is a direct mapped
+     * table indexed by the Zobrist hash of the individual. Each slot stores
+     * the fitness + 1 (0 marks an empty slot) and the hash XORed with it, a
+     * slot torn by concurrent writers then fails the check and is read as a
+     * miss: no lock is needed.
+     *
+     * The Zobrist hash of an individual is the XOR of one key per
+     * (column, line) gene, the keys are computed on the fly with the
+     * SplitMix64 finalizer. Swapping two genes updates the hash in O(1).
+     *
+     */
+    class FitnessCache
+    {
+        private:
+            /**
+             * @brief Number of slots, a power of two.
+             *
+             */
+            uint64_t slotCount;
+
+            /**
+             * @brief Hash XOR data of each slot.
+             *
+             */
+            std::atomic<uint64_t>* checks;
+
+            /**
+             * @brief Fitness + 1 of each slot, 0 for empty slots.
+             *
+             */
+            std::atomic<uint64_t>* data;
+
+            /**
+             * @brief Number of lookups that found the fitness.
+             *
+             */
+            std::atomic<uint64_t> hits;
+
+            /**
+             * @brief Number of lookups that missed the fitness.
+             *
+             */
+            std::atomic<uint64_t> misses;
+
+        public:
+            /**
+             * @brief Default contructor, unused.
+             *
+             */
+            FitnessCache(void) = delete;
+
+            /**
+             * @brief Construct a new Fitness Cache object.
+             *
+             * @param[in] slotCount The number of slots, rounded up to a power
+             * of two. Each slot uses 16 bytes.
+             */
+            FitnessCache(const uint64_t slotCount);
+
+            /**
+             * @brief Destroy the Fitness Cache object.
+             *
+             */
+            ~FitnessCache(void);
+
+            /**
+             * @brief Looks for the fitness of an individual.
+             *
+             * @param[in] hash The individual Zobrist hash.
+             * @param[out] fitness The cached fitness, if found.
+             *
+             * @return True if the fitness was found, false otherwise.
+             */
+            bool lookup(const uint64_t hash, uint32_t& fitness) const;
+
+            /**
+             * @brief Stores the fitness of an individual, replacing the
+             * previous content of the slot.
+             *
+             * @param[in] hash The individual Zobrist hash.
+             * @param[in] fitness The individual fitness.
+             */
+            void store(const uint64_t hash, const uint32_t fitness);
+
+            /**
+             * @brief Adds lookup statistics. Threads tally their own hits and
+             * misses and add them once to avoid contention.
+             *
+             * @param[in] hitCount The number of hits to add.
+             * @param[in] missCount The number of misses to add.
+             */
+            void addStats(const uint64_t hitCount, const uint64_t missCount);
+
+            /**
+             * @brief Returns the number of hits.
+             *
+             * @return uint64_t The number of hits.
+             */
+            uint64_t getHits(void) const;
+
+            /**
+             * @brief Returns the number of misses.
+             *
+             * @return uint64_t The number of misses.
+             */
+            uint64_t getMisses(void) const;
+
+            /**
+             * @brief Empties the cache and resets the statistics.
+             *
+             */
+            void clear(void);
+
+            /**
+             * @brief Computes the Zobrist hash of an individual in O(N).
+             *
+             * @param[in] individual The individual to hash.
+             * @param[in] individualSize The size of the individual.
+             *
+             * @return uint64_t The Zobrist hash.
+             */
+            static uint64_t getHash(const uint32_t* individual,
+                                    const uint32_t  individualSize);
+
+            /**
+             * @brief Updates a Zobrist hash after two genes were swapped.
+             *
+             * @param[in] hash The hash before the swap.
+             * @param[in] colA The first swapped column.
+             * @param[in] lineA The line of colA before the swap.
+             * @param[in] colB The second swapped column.
+             * @param[in] lineB The line of colB before the swap.
+             *
+             * @return uint64_t The hash after the swap.
+             */
+            static uint64_t swapHash(const uint64_t hash,
+                                     const uint32_t colA,
+                                     const uint32_t lineA,
+                                     const uint32_t colB,
+                                     const uint32_t lineB);
+
+            /**
+             * @brief Returns the Zobrist key of a gene.
+             *
+             * @param[in] column The gene column.
+             * @param[in] line The gene line.
+             *
+             * @return uint64_t The gene key.
+             */
+            static inline uint64_t getGeneKey(const uint32_t column,
+                                              const uint32_t line)
+            {
+                uint64_t key;
+
+                /* SplitMix64 finalizer of the (column, line) pair */
+                key = ((uint64_t)column << 32 | line) + 0x9E3779B97F4A7C15ULL;
+                key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+                return key ^ (key >> 31);
+            }
+    };
+}
+
+#endif /* #ifndef __SOLVER_FITNESS_CACHE_H_ */
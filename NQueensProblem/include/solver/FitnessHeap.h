@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * File: FitnessHeap.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Indexed max heap of the population fitness. Gives the worst individual of
+ * the population in O(1) and updates a fitness in O(log P).
+ ******************************************************************************/
+
+#ifndef __SOLVER_FITNESS_HEAP_H_
+#define __SOLVER_FITNESS_HEAP_H_
+
+#include <cstdint> /* Generic int types */
+
+/**
+ * @brief N Queens problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Indexed max heap of the population fitness. The heap stores the
+     * individuals index ordered by fitness, the worst individual is at the
+     * top. The position of each individual in the heap is kept so its fitness
+     * can be updated in place.
+     *
+     */
+    class FitnessHeap
+    {
+        private:
+            /**
+             * @brief Maximal number of individuals in the heap.
+             *
+             */
+            uint32_t capacity;
+
+            /**
+             * @brief Number of individuals in the heap.
+             *
+             */
+            uint32_t count;
+
+            /**
+             * @brief The individuals index, in heap order.
+             *
+             */
+            uint32_t* heap;
+
+            /**
+             * @brief The heap position of each individual.
+             *
+             */
+            uint32_t* position;
+
+            /**
+             * @brief The fitness of each individual.
+             *
+             */
+            uint32_t* fitness;
+
+            /**
+             * @brief Moves an element up until its parent is not better.
+             *
+             * @param[in] pos The heap position of the element.
+             */
+            void siftUp(uint32_t pos);
+
+            /**
+             * @brief Moves an element down until its children are not worse.
+             *
+             * @param[in] pos The heap position of the element.
+             */
+            void siftDown(uint32_t pos);
+
+            /**
+             * @brief Swaps two heap elements and updates their positions.
+             *
+             * @param[in] posA The first heap position.
+             * @param[in] posB The second heap position.
+             */
+            void swap(const uint32_t posA, const uint32_t posB);
+
+        public:
+            /**
+             * @brief Default contructor, unused.
+             *
+             */
+            FitnessHeap(void) = delete;
+
+            /**
+             * @brief Construct a new Fitness Heap object.
+             *
+             * @param[in] capacity The maximal number of individuals.
+             */
+            FitnessHeap(const uint32_t capacity);
+
+            /**
+             * @brief Destroy the Fitness Heap object.
+             *
+             */
+            ~FitnessHeap(void);
+
+            /**
+             * @brief Builds the heap from the population fitness in O(P).
+             *
+             * @param[in] popFitness The fitness of each individual.
+             * @param[in] popSize The number of individuals, must not exceed
+             * the heap capacity.
+             */
+            void build(const uint32_t* popFitness, const uint32_t popSize);
+
+            /**
+             * @brief Returns the index of the worst individual.
+             *
+             * @return uint32_t The index of the individual with the highest
+             * fitness.
+             */
+            uint32_t top(void) const;
+
+            /**
+             * @brief Returns the fitness of an individual, as stored in the
+             * heap.
+             *
+             * @param[in] index The individual index.
+             *
+             * @return uint32_t The individual fitness.
+             */
+            uint32_t getFitness(const uint32_t index) const;
+
+            /**
+             * @brief Updates the fitness of an individual in O(log P).
+             *
+             * @param[in] index The individual index.
+             * @param[in] newFitness The new fitness of the individual.
+             */
+            void update(const uint32_t index, const uint32_t newFitness);
+    };
+}
+
+#endif /* #ifndef __SOLVER_FITNESS_HEAP_H_ */
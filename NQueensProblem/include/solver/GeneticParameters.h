@@ -0,0 +1,178 @@
+/*******************************************************************************
+ * File: GeneticParameters.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Runtime parameters of the genetic solver. The parameters can be set from
+ * key=value pairs given on the command line, in a configuration file or in a
+ * per board size table written by the autotune tool.
+ ******************************************************************************/
+
+#ifndef __SOLVER_GENETIC_PARAMETERS_H_
+#define __SOLVER_GENETIC_PARAMETERS_H_
+
+#include <cstdint> /* Generic int types */
+#include <string>  /* std::string */
+
+#define GEN_POPULATION_SIZE     100
+#define GEN_MATING_POOL_SIZE    60
+#define GEN_INJECTION_POOL_SIZE 20
+#define GEN_CROSSOVER_PROBA     0.9
+#define GEN_MUTATION_PROBA      0.1
+#define GEN_MUTATION_SIZE       99
+#define GEN_CROSSOVER_OPERATOR  "order1"
+#define GEN_HUGE_PAGES          "off"
+#define GEN_TABLE_FILE          "autotune.table"
+
+/**
+ * @brief N Queens problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Genetic solver parameters. The default values are the GEN_*
+     * values above.
+     *
+     * The keys accepted by set and in configuration files are:
+     * population, mating-pool, injection-pool, crossover, mutation,
+     * mutation-size, adaptive (0 or 1), crossover-operator (order1, pmx or
+     * cycle) and huge-pages (off, transparent or explicit).
+     * Configuration files contain one key=value pair per line, empty lines
+     * and lines starting with # are ignored.
+     * Parameter tables contain one entry per board size: an N=size pair
+     * followed by the key=value pairs of the size, separated by blanks.
+     *
+     */
+    struct GeneticParameters
+    {
+        /**
+         * @brief Size of the population.
+         *
+         */
+        uint32_t populationSize;
+
+        /**
+         * @brief Size of the mating pool, must be even.
+         *
+         */
+        uint32_t matingPoolSize;
+
+        /**
+         * @brief Number of immigrants injected every GEN_INJECTION_RATE
+         * generations.
+         *
+         */
+        uint32_t injectionPoolSize;
+
+        /**
+         * @brief Probability to apply the crossover in a generation.
+         *
+         */
+        double crossoverProba;
+
+        /**
+         * @brief Probability to apply the mutation in a generation.
+         *
+         */
+        double mutationProba;
+
+        /**
+         * @brief Number of individuals mutated by a mutation.
+         *
+         */
+        uint32_t mutationSize;
+
+        /**
+         * @brief Set to true to adapt the crossover and mutation
+         * probabilities from their recent success.
+         *
+         */
+        bool adaptiveRates;
+
+        /**
+         * @brief Name of the crossover operator: order1, pmx or cycle.
+         *
+         */
+        std::string crossoverOperator;
+
+        /**
+         * @brief Huge page mode of the population buffers: off, transparent
+         * or explicit.
+         *
+         */
+        std::string hugePages;
+
+        /**
+         * @brief Construct a new Genetic Parameters object with the default
+         * values.
+         *
+         */
+        GeneticParameters(void);
+
+        /**
+         * @brief Sets a parameter from its key and textual value.
+         *
+         * @param[in] key The parameter key.
+         * @param[in] value The parameter value.
+         * @param[out] error The error description when the function fails.
+         *
+         * @return True if the parameter was set, false if the key is unknown
+         * or the value is not a number or a known operator.
+         */
+        bool set(const std::string& key,
+                 const std::string& value,
+                 std::string&       error);
+
+        /**
+         * @brief Sets the parameters from a configuration file.
+         *
+         * @param[in] path The path of the configuration file.
+         * @param[out] error The error description when the function fails.
+         *
+         * @return True if every line of the file was applied, false
+         * otherwise.
+         */
+        bool loadFile(const std::string& path, std::string& error);
+
+        /**
+         * @brief Sets the parameters from the entry of a parameter table
+         * matching a board size: the entry with the largest size not above
+         * queensCount, or the smallest size if every entry is above it.
+         *
+         * @param[in] path The path of the parameter table.
+         * @param[in] queensCount The board size to look for.
+         * @param[out] error The error description when the function fails.
+         *
+         * @return True if the table was read, even if it has no entry, false
+         * otherwise.
+         */
+        bool loadTable(const std::string& path,
+                       const uint32_t     queensCount,
+                       std::string&       error);
+
+        /**
+         * @brief Returns the parameters as blank separated key=value pairs,
+         * as read by set, loadFile and loadTable.
+         *
+         * @return std::string The parameters.
+         */
+        std::string toString(void) const;
+
+        /**
+         * @brief Checks that the parameters can be used by the genetic
+         * solver.
+         *
+         * @param[out] error The error description when the function fails.
+         *
+         * @return True if the parameters are valid, false otherwise.
+         */
+        bool validate(std::string& error) const;
+    };
+}
+
+#endif /* #ifndef __SOLVER_GENETIC_PARAMETERS_H_ */
@@ -17,6 +17,8 @@
 
 #include <cstdint> /* uint32_t */
 #include <vector>  /* std::vector */
+#include <thread>  /* std::thread */
+#include <atomic>  /* std::atomic */
 #include <random>  /* std::random_device, std::mt19937,
                       std::uniform_int_distribution */
 
@@ -28,16 +30,37 @@
 #include <solver/MutationOperator.h>
 /* nsSolver::PopulationSelector */
 #include <solver/PopulationSelector.h>
+/* nsSolver::LocalSearchOperator */
+#include <solver/LocalSearchOperator.h>
+/* nsSolver::FitnessHeap */
+#include <solver/FitnessHeap.h>
+/* nsSolver::FitnessCache */
+#include <solver/FitnessCache.h>
+/* nsSolver::GeneticParameters */
+#include <solver/GeneticParameters.h>
+/* nsSolver::MigrantExchange */
+#include <solver/MigrantExchange.h>
+/* nsSolver::ThreadAffinity */
+#include <solver/ThreadAffinity.h>
+/* nsSolver::HugePageAllocator, nsSolver::HugePageMode */
+#include <solver/HugePageAllocator.h>
 
 #include <solver/Solver.h> /* nsSolver::Sovler */
 
-#define GEN_POPULATION_SIZE     100
-#define GEN_MATING_POOL_SIZE    60
-#define GEN_INJECTION_POOL_SIZE 20
-#define GEN_CROSSOVER_PROBA     0.9
-#define GEN_MUTATION_PROBA      0.1
-#define GEN_MUTATION_SIZE       99
 #define GEN_INJECTION_RATE      25
+#define GEN_INJECTION_TRIES     32
+#define GEN_STAGNATION_LIMIT    200
+#define GEN_MIN_UNIQUE_RATIO    0.5
+#define GEN_MIN_HAMMING         0.05
+#define GEN_RESEED_RATIO        0.5
+#define GEN_HAMMING_PAIRS       256
+#define GEN_HAMMING_COLUMNS     64
+#define GEN_LOCAL_SEARCH_BUDGET 4
+#define GEN_CACHE_SLOTS         (1 << 16)
+#define GEN_SPLIT_MIN_QUEENS    4096
+#define GEN_ADAPT_RATE          0.1
+#define GEN_ADAPT_MIN_PROBA     0.05
+#define GEN_ADAPT_MAX_PROBA     1.0
 
 /**
  * @brief N Queens problem solvers.
@@ -84,6 +107,12 @@ namespace nsSolver
              */
             uint32_t* populationFitness;
 
+            /**
+             * @brief Store the population Zobrist hashes.
+             *
+             */
+            uint64_t* populationHash;
+
             /**
              * @brief Size of the mating pool.
              *
@@ -108,6 +137,12 @@ namespace nsSolver
              */
             uint32_t* childrenFitness;
 
+            /**
+             * @brief Store the children Zobrist hashes.
+             *
+             */
+            uint64_t* childrenHash;
+
             /**
              * @brief Injection pool size;
              *
@@ -126,12 +161,125 @@ namespace nsSolver
              */
             uint32_t* injectionFitness;
 
+            /**
+             * @brief Store the injection pool Zobrist hashes.
+             *
+             */
+            uint64_t* injectionHash;
+
+            /**
+             * @brief Threads generating the next immigrants in the background.
+             *
+             */
+            std::vector<std::thread> injectionThreads;
+
+            /**
+             * @brief Copy of the best individual found so far.
+             *
+             */
+            uint32_t* elite;
+
+            /**
+             * @brief Fitness of the elite individual.
+             *
+             */
+            uint32_t eliteFitness;
+
+            /**
+             * @brief Zobrist hash of the elite individual.
+             *
+             */
+            uint64_t eliteHash;
+
+            /**
+             * @brief Fitness of the individuals already evaluated.
+             *
+             */
+            FitnessCache* fitnessCache = nullptr;
+
+            /**
+             * @brief Exchange sharing the elite with other solver processes,
+             * nullptr when the solver runs alone. The exchange is not owned
+             * by the solver.
+             *
+             */
+            MigrantExchange* migrantExchange = nullptr;
+
+            /**
+             * @brief Placement of the worker threads, nullptr when the
+             * workers are not pinned.
+             *
+             */
+            ThreadAffinity* affinity = nullptr;
+
+            /**
+             * @brief Allocator of the individuals buffers.
+             *
+             */
+            HugePageAllocator* allocator = nullptr;
+
+            /**
+             * @brief Fitness of the last individual published to the
+             * exchange.
+             *
+             */
+            uint32_t publishedFitness;
+
+            /**
+             * @brief Number of individuals published to the exchange.
+             *
+             */
+            uint64_t migrantsSent;
+
+            /**
+             * @brief Number of individuals received from the exchange.
+             *
+             */
+            uint64_t migrantsReceived;
+
             /**
              * @brief Size of the population that should be mutated.
              *
              */
             uint32_t mutationSize;
 
+            /**
+             * @brief Current probability to apply the crossover.
+             *
+             */
+            double crossoverProba;
+
+            /**
+             * @brief Current probability to apply the mutation.
+             *
+             */
+            double mutationProba;
+
+            /**
+             * @brief Set to true to adapt the crossover and mutation
+             * probabilities during the generational loop.
+             *
+             */
+            bool adaptiveRates;
+
+            /**
+             * @brief Moving average of the crossover success ratio.
+             *
+             */
+            double crossoverSuccess;
+
+            /**
+             * @brief Moving average of the mutation success ratio.
+             *
+             */
+            double mutationSuccess;
+
+            /**
+             * @brief Number of generations run by the last solve.
+             *
+             */
+            uint32_t generationCount;
+
             /**
              * @brief Random engine, must be seeded at object initialization.
              *
@@ -162,12 +310,40 @@ namespace nsSolver
              */
             PopulationSelector* populationSelector = nullptr;
 
+            /**
+             * @brief Genetic local search operator applied to the children,
+             * nullptr when the local search is disabled.
+             *
+             */
+            LocalSearchOperator* localSearchOperator = nullptr;
+
+            /**
+             * @brief Set to true to breed one pair at a time instead of a
+             * whole mating pool per generation.
+             *
+             */
+            bool steadyState = false;
+
             /**
              * @brief Number of cores present to process the data.
              *
              */
             uint32_t coreCount;
 
+            /**
+             * @brief Maximal number of workers, 0 to use all the cores.
+             *
+             */
+            uint32_t workerLimit = 0;
+
+            /**
+             * @brief Up then down diagonal counters shared by the threads
+             * when the fitness of a single individual is split across
+             * threads. They are cleared by each reduction.
+             *
+             */
+            std::atomic<uint32_t>* splitDiagonals = nullptr;
+
             /**
              * @brief Computer the number of attacks of the current solution.
              *
@@ -180,11 +356,48 @@ namespace nsSolver
             getAttackCount(const uint32_t* solution) const;
 
             /**
-             * @brief Initialize the algorithm population.
+             * @brief Initialize the algorithm population. The population is
+             * split in the same blocks as the fitness computation, each block
+             * is initialized by the worker that evaluates it so its memory is
+             * first touched on the worker node.
              *
              */
             void initPopulation(void);
 
+            /**
+             * @brief Initializes a block of the population with random
+             * permutations. This function is used as a thread routine.
+             *
+             * @param[in] worker The worker index, used to pin the thread.
+             * @param[in] start The first individual of the block.
+             * @param[in] end The individual after the last individual of the
+             * block.
+             * @param[in] seed The seed of the thread random engine.
+             */
+            void initPopulationThread(const uint32_t worker,
+                                      const uint32_t start,
+                                      const uint32_t end,
+                                      const uint32_t seed);
+
+            /**
+             * @brief Pins the calling thread to the core of a worker when
+             * the affinity is enabled.
+             *
+             * @param[in] worker The worker index.
+             */
+            void pinWorker(const uint32_t worker) const;
+
+            /**
+             * @brief Allocates the individuals of a population in one
+             * contiguous buffer taken from the huge page allocator.
+             *
+             * @param[in] count The number of individuals.
+             *
+             * @return uint32_t** The individuals pointers, the buffer is
+             * released with the allocator.
+             */
+            uint32_t** allocateIndividuals(const uint32_t count);
+
             /**
              * @brief Computes the fitness of the current populations we store.
              *
@@ -210,6 +423,8 @@ namespace nsSolver
 
             /**
              * @brief Compute the fitness of a certain part of a population.
+             * The fitness is first looked for in the fitness cache, the
+             * computed fitness are added to the cache.
              * This function is used as a thread routine.
              *
              * @param[in] index The index from which the function needs to
@@ -218,14 +433,266 @@ namespace nsSolver
              * fitness of.
              * @param[in] population The population to use.
              * @param[in] popSize The size of the population.
+             * @param[in] popHash The Zobrist hashes of the population.
              * @param[out] popFitness The fitness array of the population.
              */
             void computeFitnessThread(const uint32_t index,
                                       const uint32_t blockSize,
                                       const uint32_t** population,
                                       const uint32_t popSize,
+                                      const uint64_t* popHash,
                                       uint32_t* popFitness);
 
+            /**
+             * @brief Computes the fitness of the dirty individuals of a set.
+             * When there are fewer dirty individuals than cores and the
+             * individuals are large, each individual is split across all the
+             * cores with getSplitAttackCount. Otherwise the individuals are
+             * split in blocks, one per core.
+             *
+             * @param[in] individuals The individuals to evaluate.
+             * @param[in] count The number of individuals.
+             * @param[in] hashes The Zobrist hashes of the individuals.
+             * @param[in/out] fitness The fitness of the individuals,
+             * UINT32_MAX marks the dirty ones.
+             */
+            void evaluateIndividuals(const uint32_t** individuals,
+                                     const uint32_t   count,
+                                     const uint64_t*  hashes,
+                                     uint32_t*        fitness);
+
+            /**
+             * @brief Computes the number of attacks of one permutation on
+             * several threads. Each thread adds the queens of a block of
+             * columns to the shared atomic diagonal counters, the counters
+             * are then read and cleared by ranges, in parallel, and each
+             * diagonal holding c queens adds c * (c - 1) / 2 attacks. The
+             * memory stays O(N) whatever the number of threads.
+             *
+             * @param[in] individual The individual to evaluate.
+             * @param[in] threadCount The number of threads to use.
+             *
+             * @return uint32_t The number of possible attacks.
+             */
+            uint32_t getSplitAttackCount(const uint32_t* individual,
+                                         const uint32_t  threadCount);
+
+            /**
+             * @brief Counts the queens of a block of columns on each
+             * diagonal. This function is used as a thread routine.
+             *
+             * @param[in] individual The individual to count.
+             * @param[in] start The first column of the block.
+             * @param[in] end The column after the last column of the block.
+             */
+            void splitCountThread(const uint32_t* individual,
+                                  const uint32_t  start,
+                                  const uint32_t  end);
+
+            /**
+             * @brief Sums the attacks held by a range of the diagonal
+             * counters and clears them. This function is used as a thread
+             * routine.
+             *
+             * @param[in] start The first counter of the range.
+             * @param[in] end The counter after the last one of the range.
+             * @param[out] attacks The number of attacks in the range.
+             */
+            void splitReduceThread(const uint32_t start,
+                                   const uint32_t end,
+                                   uint64_t*      attacks);
+
+            /**
+             * @brief Updates the hashes of the individuals mutated by the
+             * last mutation. The swapped genes are used when the mutation
+             * operator reports them, the individual is hashed again
+             * otherwise.
+             *
+             * @param[in] individuals The mutated population.
+             * @param[in] selection The mutated individuals.
+             * @param[in/out] hashes The hashes of the population.
+             */
+            void updateMutatedHashes(const uint32_t**             individuals,
+                                     const std::vector<uint32_t>& selection,
+                                     uint64_t*                    hashes);
+
+            /**
+             * @brief Starts generating the next immigrants in the injection
+             * pool. The generation runs on worker threads while the
+             * generations go on, the injection pool must not be used before
+             * waitInjection is called.
+             *
+             */
+            void startInjection(void);
+
+            /**
+             * @brief Waits for the immigrants generation started by
+             * startInjection. Does nothing if no generation is running.
+             *
+             */
+            void waitInjection(void);
+
+            /**
+             * @brief Returns the number of cores to use, the detected cores
+             * bounded by the worker limit.
+             *
+             * @return uint32_t The number of cores to use, at least 1.
+             */
+            uint32_t detectCores(void) const;
+
+            /**
+             * @brief Copies an individual of the population to the elite if
+             * it is fitter than the elite.
+             *
+             * @param[in] index The index of the individual.
+             *
+             * @return True if the elite was replaced, false otherwise.
+             */
+            bool updateElite(const uint32_t index);
+
+            /**
+             * @brief Publishes the elite to the migrant exchange if it
+             * improved since the last publication.
+             *
+             */
+            void publishElite(void);
+
+            /**
+             * @brief Publishes the elite and replaces the first immigrants of
+             * the injection pool by the migrants of the other processes. The
+             * migrants fitness is computed again, the injection must not be
+             * running.
+             *
+             */
+            void exchangeMigrants(void);
+
+            /**
+             * @brief Generates a block of immigrants and their fitness. Even
+             * immigrants are random permutations, odd immigrants are built
+             * column by column, preferring lines with free diagonals. This
+             * function is used as a thread routine.
+             *
+             * @param[out] individuals The individuals to generate.
+             * @param[out] fitness The fitness of the generated individuals.
+             * @param[out] hashes The hashes of the generated individuals.
+             * @param[in] start The first immigrant of the block.
+             * @param[in] end The immigrant after the last one of the block.
+             * @param[in] seed The seed of the thread random engine.
+             */
+            void immigrantThread(uint32_t**     individuals,
+                                 uint32_t*      fitness,
+                                 uint64_t*      hashes,
+                                 const uint32_t start,
+                                 const uint32_t end,
+                                 const uint32_t seed);
+
+            /**
+             * @brief Runs the generational loop: each generation breeds a
+             * whole mating pool and replaces the population in bulk.
+             *
+             * @return uint32_t The index of the fittest individual.
+             */
+            uint32_t solveGenerational(void);
+
+            /**
+             * @brief Runs the steady-state loop: each step breeds one pair of
+             * children and replaces the worst individuals found with an
+             * indexed heap, in O(log P). A generation is worth
+             * matingPoolSize / 2 steps. The adaptive rates are updated once
+             * per generation from the share of children entering the
+             * population, mutated pairs crediting the mutation.
+             *
+             * @return uint32_t The index of the fittest individual.
+             */
+            uint32_t solveSteadyState(void);
+
+            /**
+             * @brief Replaces the worst individuals of the population by the
+             * fitter candidates. A candidate fitter than the elite becomes the
+             * new elite.
+             *
+             * @param[in/out] heap The population fitness heap.
+             * @param[in] candidates The candidate individuals.
+             * @param[in] candidatesFitness The candidates fitness.
+             * @param[in] candidatesHash The candidates hashes.
+             * @param[in] candidatesCount The number of candidates.
+             * @param[in/out] bestIndex The index of the fittest individual.
+             * @param[out] replacedCount The number of candidates that entered
+             * the population.
+             *
+             * @return True if the fittest individual improved, false
+             * otherwise.
+             */
+            bool replaceWorst(FitnessHeap&     heap,
+                              const uint32_t** candidates,
+                              const uint32_t*  candidatesFitness,
+                              const uint64_t*  candidatesHash,
+                              const uint32_t   candidatesCount,
+                              uint32_t&        bestIndex,
+                              uint32_t&        replacedCount);
+
+            /**
+             * @brief Tells if the population stagnates: the best individual
+             * did not improve for GEN_STAGNATION_LIMIT generations, or for a
+             * quarter of it when the population collapsed.
+             *
+             * @param[in] stagnation The number of generations without
+             * improvement.
+             * @param[in] uniqueCount The number of unique genotypes.
+             * @param[in] meanHamming The mean Hamming distance ratio.
+             *
+             * @return True if part of the population should be reseeded.
+             */
+            bool isStagnating(const uint32_t stagnation,
+                              const uint32_t uniqueCount,
+                              const double   meanHamming) const;
+
+            /**
+             * @brief Adapts the crossover and mutation probabilities. The
+             * success ratio of each applied operator updates its moving
+             * average, then each probability moves toward its share of the
+             * summed averages, scaled between GEN_ADAPT_MIN_PROBA and
+             * GEN_ADAPT_MAX_PROBA. No operator can then starve.
+             *
+             * @param[in] mated True if the crossover was applied.
+             * @param[in] crossoverRatio The ratio of children that entered the
+             * population.
+             * @param[in] mutated True if the mutation was applied.
+             * @param[in] mutationRatio The ratio of mutated individuals that
+             * improved.
+             */
+            void adaptRates(const bool   mated,
+                            const double crossoverRatio,
+                            const bool   mutated,
+                            const double mutationRatio);
+
+            /**
+             * @brief Returns the index of the fittest individual of the
+             * population.
+             *
+             * @return uint32_t The index of the fittest individual.
+             */
+            uint32_t getBestIndex(void) const;
+
+            /**
+             * @brief Computes the diversity of the population: the number of
+             * unique genotypes and the mean Hamming distance between sampled
+             * pairs of individuals, on sampled columns.
+             *
+             * @param[out] uniqueCount The number of unique genotypes.
+             * @param[out] meanHamming The mean ratio of differing genes, from
+             * 0 (identical) to 1.
+             */
+            void computeDiversity(uint32_t& uniqueCount, double& meanHamming);
+
+            /**
+             * @brief Replaces the GEN_RESEED_RATIO worst part of the
+             * population with new immigrants. The fittest individual is never
+             * replaced.
+             *
+             */
+            void reseedPopulation(void);
+
         public:
             /**
              * @brief Destroy the GeneticSolver object.
@@ -250,6 +717,21 @@ namespace nsSolver
             GeneticSolver(const uint32_t queensCount,
                           const uint32_t iterCount);
 
+            /**
+             * @brief Construct a new Genetic Solver object with the given
+             * parameters.
+             *
+             * @param[in] queensCount The number of queens the problem has to
+             * solve.
+             * @param[in] iterCount The maximal number of iteration before the
+             * algorithm should stop.
+             * @param[in] parameters The genetic parameters, they must pass
+             * GeneticParameters::validate.
+             */
+            GeneticSolver(const uint32_t           queensCount,
+                          const uint32_t           iterCount,
+                          const GeneticParameters& parameters);
+
             /**
              * @brief Solves the N Queens problem and store the solution in the
              * vector given as parameter.
@@ -265,6 +747,75 @@ namespace nsSolver
             virtual void solve(std::vector<uint32_t>& solution,
                                uint32_t &attackCount);
 
+            /**
+             * @brief Enables the memetic mode: each child is improved by a
+             * swap local search before the population selection. The local
+             * search also computes the children fitness incrementally.
+             *
+             * @param[in] budget The number of swaps tried per queen of a
+             * child, 0 disables the local search.
+             */
+            void enableLocalSearch(const uint32_t budget);
+
+            /**
+             * @brief Enables the steady-state mode: one pair of children is
+             * bred at a time and replaces the worst individuals right away,
+             * so improvements show up without waiting for a whole generation.
+             *
+             * @param[in] enable True to use the steady-state loop, false to
+             * use the generational loop.
+             */
+            void enableSteadyState(const bool enable);
+
+            /**
+             * @brief Returns the number of generations run by the last solve.
+             * The steady-state mode counts one generation every
+             * matingPoolSize children.
+             *
+             * @return uint32_t The number of generations.
+             */
+            uint32_t getGenerationCount(void) const;
+
+            /**
+             * @brief Sets the exchange used to share the elite with other
+             * solver processes. The elite is published and the migrants are
+             * merged every GEN_INJECTION_RATE generations, with the
+             * immigrants.
+             *
+             * @param[in] exchange The open exchange, nullptr to run alone.
+             * The exchange must outlive the solve calls.
+             */
+            void setMigrantExchange(MigrantExchange* exchange);
+
+            /**
+             * @brief Enables the worker pinning: the fitness and
+             * initialization workers are pinned to the cores given by
+             * ThreadAffinity, and each block of the population is first
+             * touched by the worker that evaluates it.
+             *
+             * @param[in] enable True to pin the workers, false to let the
+             * system place them.
+             */
+            void enableAffinity(const bool enable);
+
+            /**
+             * @brief Limits the number of workers of each parallel step, so
+             * that several solvers can share the machine. Must be called
+             * before enableLocalSearch to limit the local search workers.
+             *
+             * @param[in] count The maximal number of workers, 0 to use all
+             * the cores.
+             */
+            void setWorkerCount(const uint32_t count);
+
+            /**
+             * @brief Returns the backing obtained for the population buffer,
+             * which may be less than the requested huge page mode.
+             *
+             * @return HugePageMode The population buffer backing.
+             */
+            HugePageMode getHugePageBacking(void) const;
+
 #ifdef _TESTMODE
             /**
              * @brief Tests the attackCount method
@@ -295,6 +846,36 @@ namespace nsSolver
              *
              */
             void testTossProbability(void);
+
+            /**
+             * @brief Tests the immigrants generation.
+             *
+             */
+            void testInjection(void);
+
+            /**
+             * @brief Tests the diversity metrics and the population reseed.
+             *
+             */
+            void testDiversity(void);
+
+            /**
+             * @brief Tests the population hashes and the fitness cache.
+             *
+             */
+            void testHashes(void);
+
+            /**
+             * @brief Tests the split fitness evaluation.
+             *
+             */
+            void testSplitFitness(void);
+
+            /**
+             * @brief Tests the runtime parameters and the adaptive rates.
+             *
+             */
+            void testAdaptiveRates(void);
 #endif
 
     };
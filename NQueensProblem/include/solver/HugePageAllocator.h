@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * File: HugePageAllocator.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Allocator backing large buffers with huge pages. Explicit huge pages are
+ * requested with MAP_HUGETLB, transparent huge pages with
+ * madvise(MADV_HUGEPAGE). The allocator falls back to the next mode when a
+ * mode is not available.
+ * The NQueensProblem and TSP projects build on their own, each one keeps a
+ * copy of the allocator. The unit_tests.sh scripts check that the copies
+ * stay identical.
+ ******************************************************************************/
+
+#ifndef __SOLVER_HUGE_PAGE_ALLOCATOR_H_
+#define __SOLVER_HUGE_PAGE_ALLOCATOR_H_
+
+#include <cstdint> /* Generic int types */
+#include <cstddef> /* size_t */
+#include <string>  /* std::string */
+#include <map>     /* std::map */
+
+#define HUGE_PAGE_SIZE     (2UL << 20)
+#define HUGE_PAGE_MIN_SIZE (HUGE_PAGE_SIZE / 2)
+
+/**
+ * @brief N Queens problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Huge page modes, from the least to the most demanding one.
+     *
+     */
+    enum HugePageMode
+    {
+        /** @brief Regular heap allocation. */
+        HUGE_PAGES_OFF         = 0,
+        /** @brief Aligned mapping advised to use transparent huge pages. */
+        HUGE_PAGES_TRANSPARENT = 1,
+        /** @brief Mapping of reserved huge pages (MAP_HUGETLB). */
+        HUGE_PAGES_EXPLICIT    = 2
+    };
+
+    /**
+     * @brief Huge page allocator.
+     *
+     * Buffers smaller than HUGE_PAGE_MIN_SIZE always come from the heap, a
+     * huge page would mostly be wasted. Larger buffers are rounded up to
+     * HUGE_PAGE_SIZE. The explicit mode needs huge pages reserved by the
+     * administrator (vm.nr_hugepages), when the reservation is exhausted the
+     * buffer gets transparent huge pages. The transparent mode maps a
+     * HUGE_PAGE_SIZE aligned buffer and advises the kernel to back it with
+     * huge pages, which the kernel does when transparent huge pages are set
+     * to always or madvise. When the mapping fails the buffer comes from
+     * the heap. The buffers still allocated are released with the
+     * allocator.
+     *
+     */
+    class HugePageAllocator
+    {
+        private:
+            /**
+             * @brief An allocated buffer.
+             *
+             */
+            struct Block
+            {
+                /** @brief The requested size. */
+                size_t size;
+                /** @brief The mapped size, 0 for heap buffers. */
+                size_t mapSize;
+                /** @brief The backing obtained for the buffer. */
+                HugePageMode backing;
+            };
+
+            /**
+             * @brief The requested mode.
+             *
+             */
+            HugePageMode mode;
+
+            /**
+             * @brief The allocated buffers, by address.
+             *
+             */
+            std::map<void*, Block> blocks;
+
+            /**
+             * @brief Number of bytes allocated with each backing.
+             *
+             */
+            size_t backedBytes[HUGE_PAGES_EXPLICIT + 1];
+
+            /**
+             * @brief Maps an anonymous buffer.
+             *
+             * @param[in] size The size of the buffer, a multiple of
+             * HUGE_PAGE_SIZE.
+             * @param[in] backing The requested backing, explicit or
+             * transparent.
+             *
+             * @return void* The buffer, nullptr if the mapping failed.
+             */
+            void* map(const size_t size, const HugePageMode backing) const;
+
+        public:
+            /**
+             * @brief Construct a new Huge Page Allocator object.
+             *
+             * @param[in] mode The requested mode.
+             */
+            HugePageAllocator(const HugePageMode mode);
+
+            /**
+             * @brief Destroy the Huge Page Allocator object, the buffers still
+             * allocated are released.
+             *
+             */
+            ~HugePageAllocator(void);
+
+            /**
+             * @brief Allocates a buffer. The buffer content is not
+             * initialized.
+             *
+             * @param[in] size The size of the buffer in bytes.
+             *
+             * @return void* The buffer, nullptr if size is 0.
+             */
+            void* allocate(const size_t size);
+
+            /**
+             * @brief Releases a buffer returned by allocate.
+             *
+             * @param[in] address The buffer, nullptr is ignored.
+             */
+            void release(void* address);
+
+            /**
+             * @brief Returns the requested mode.
+             *
+             * @return HugePageMode The requested mode.
+             */
+            HugePageMode getMode(void) const;
+
+            /**
+             * @brief Returns the backing obtained for a buffer.
+             *
+             * @param[in] address The buffer.
+             *
+             * @return HugePageMode The backing of the buffer, HUGE_PAGES_OFF
+             * for unknown buffers.
+             */
+            HugePageMode getBacking(const void* address) const;
+
+            /**
+             * @brief Returns the number of bytes currently allocated with a
+             * backing.
+             *
+             * @param[in] backing The backing.
+             *
+             * @return size_t The number of bytes.
+             */
+            size_t getBackedBytes(const HugePageMode backing) const;
+
+            /**
+             * @brief Parses a mode name: off, transparent or explicit.
+             *
+             * @param[in] name The mode name.
+             * @param[out] mode The mode.
+             *
+             * @return True if the name is valid, false otherwise.
+             */
+            static bool parseMode(const std::string& name, HugePageMode& mode);
+
+            /**
+             * @brief Returns the name of a mode, as read by parseMode.
+             *
+             * @param[in] mode The mode.
+             *
+             * @return const char* The mode name.
+             */
+            static const char* getModeName(const HugePageMode mode);
+
+            /**
+             * @brief Returns the size of the process memory that the kernel
+             * actually backs with transparent huge pages.
+             *
+             * @return size_t The number of bytes, 0 if unknown.
+             */
+            static size_t getTransparentHugeBytes(void);
+    };
+}
+
+#endif /* #ifndef __SOLVER_HUGE_PAGE_ALLOCATOR_H_ */
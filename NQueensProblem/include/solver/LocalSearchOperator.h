@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * File: LocalSearchOperator.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Local search operator interface. This class defines the API a local search
+ * operator should implement.
+ ******************************************************************************/
+
+#ifndef __SOLVER_LOCAL_SEARCH_OPERATOR_H_
+#define __SOLVER_LOCAL_SEARCH_OPERATOR_H_
+
+#include <cstdint> /* Generic int types */
+
+/**
+ * @brief N Queens problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Local search operator interface. This class defines the API a
+     * local search operator should implement. A local search operator is used
+     * in memetic algorithms to improve the offsprings before they compete with
+     * the population.
+     *
+     */
+    class LocalSearchOperator
+    {
+        public:
+            /**
+             * @brief Improves a set of individuals and computes their fitness.
+             *
+             * @param[in/out] individuals The individuals to improve.
+             * @param[in] individualCount The number of individuals.
+             * @param[in] individualSize The size of an individual.
+             * @param[in/out] hashes The Zobrist hashes of the individuals,
+             * updated with each accepted swap.
+             * @param[out] fitness The fitness of each improved individual.
+             */
+            virtual void operator()(uint32_t**     individuals,
+                                    const uint32_t individualCount,
+                                    const uint32_t individualSize,
+                                    uint64_t*      hashes,
+                                    uint32_t*      fitness) = 0;
+
+            /**
+             * @brief Destroy the Local Search Operator object.
+             *
+             */
+            virtual ~LocalSearchOperator(void) {}
+    };
+}
+
+#endif /* #ifndef __SOLVER_LOCAL_SEARCH_OPERATOR_H_ */
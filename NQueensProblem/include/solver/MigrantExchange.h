@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * File: MigrantExchange.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Migrant exchange interface. This class defines the API used by solver
+ * processes to share their elite individuals with each other.
+ ******************************************************************************/
+
+#ifndef __SOLVER_MIGRANT_EXCHANGE_H_
+#define __SOLVER_MIGRANT_EXCHANGE_H_
+
+#include <cstdint> /* Generic int types */
+
+/**
+ * @brief N Queens problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief MigrantExchange interface. Defines what a migrant exchange
+     * should implement. An exchange is opened by several solver processes
+     * working on the same board size: each process publishes its elite
+     * individuals and consumes the ones published by the other processes.
+     * Processes can open or close the exchange at any time.
+     *
+     */
+    class MigrantExchange
+    {
+        public:
+            /**
+             * @brief Publishes an individual to the other processes.
+             *
+             * @param[in] individual The individual to publish.
+             * @param[in] fitness The fitness of the individual.
+             *
+             * @return True if the individual was published, false otherwise.
+             */
+            virtual bool publish(const uint32_t* individual,
+                                 const uint32_t  fitness) = 0;
+
+            /**
+             * @brief Consumes the individuals published by the other
+             * processes since the last call, the most recent ones first.
+             *
+             * @param[out] individuals The buffers receiving the individuals.
+             * @param[out] fitness The fitness given by the publishers.
+             * @param[in] maxCount The number of buffers in individuals.
+             *
+             * @return uint32_t The number of individuals consumed.
+             */
+            virtual uint32_t consume(uint32_t**     individuals,
+                                     uint32_t*      fitness,
+                                     const uint32_t maxCount) = 0;
+
+            /**
+             * @brief Destroy the Migrant Exchange object.
+             *
+             */
+            virtual ~MigrantExchange(void) {}
+    };
+}
+
+#endif /* #ifndef __SOLVER_MIGRANT_EXCHANGE_H_ */
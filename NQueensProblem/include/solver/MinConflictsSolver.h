@@ -0,0 +1,274 @@
+/******************************************************************************
+ * File: MinConflictsSolver.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * MinConflictsSolver implements the Solver class. Any class implementing the
+ * Solver interface is assumed to solve the N Queens Problem.
+ * The algorithm used to solve the problem is a parallel min-conflicts
+ * algorithm working on permutations and shared atomic diagonal counters.
+ ******************************************************************************/
+
+#ifndef __SOLVER_MIN_CONFLICTS_SOLVER_H
+#define __SOLVER_MIN_CONFLICTS_SOLVER_H
+
+#include <cstdint> /* uint32_t, uint16_t */
+#include <vector>  /* std::vector */
+#include <atomic>  /* std::atomic */
+#include <random>  /* std::random_device, std::mt19937,
+                      std::uniform_int_distribution */
+
+#include <solver/Solver.h> /* nsSolver::Sovler */
+
+#define MINC_INIT_TRIES   64
+#define MINC_SWAP_TRIES   32
+#define MINC_STALL_ROUNDS 4
+
+/**
+ * @brief N Queens problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Min-Conflicts Solver, implements the parallel min-conflicts
+     * version of the N Queens problem solver.
+     *
+     * The board is kept as a permutation (one queen per line and column) so
+     * only the diagonals can conflict. The number of queens on each diagonal
+     * is stored in compact 16 bits atomic counters, the whole state costs 12
+     * bytes per queen. Each repair round splits the columns in disjoint
+     * blocks, one per thread, and every thread swaps the conflicted queens of
+     * its block with other queens of the same block. The swap gains are
+     * computed from counters that other threads may be modifying: stale reads
+     * only lead to a bad decision, never to a corrupted counter, and the final
+     * attack count is computed by a verification pass that rebuilds the
+     * counters from the board.
+     *
+     */
+    class MinConflictsSolver: public Solver
+    {
+        private:
+            /**
+             * @brief The number of queens the problem has to solve.
+             *
+             */
+            uint32_t queensCount;
+
+            /**
+             * @brief The maximum number of repair rounds before the algorithm
+             * must stop.
+             *
+             */
+            uint32_t iterCount;
+
+            /**
+             * @brief Number of threads used to repair the board.
+             *
+             */
+            uint32_t threadCount;
+
+            /**
+             * @brief Number of queens on each up diagonal (column + line).
+             *
+             */
+            std::atomic<uint16_t>* diagUp;
+
+            /**
+             * @brief Number of queens on each down diagonal
+             * (column - line + queensCount - 1).
+             *
+             */
+            std::atomic<uint16_t>* diagDown;
+
+            /**
+             * @brief Random engine, must be seeded at object initialization.
+             *
+             */
+            std::mt19937 generator;
+
+            /**
+             * @brief Computer the number of attacks of the current solution.
+             *
+             * @param[in] solution The current solution for which we need to
+             * compute the number of possible attacks.
+             *
+             * @return uint32_t The number of possible attacks for the solution.
+             */
+            uint32_t
+            getAttackCount(const std::vector<uint32_t>& solution) const;
+
+            /**
+             * @brief Computes the number of attacks from the diagonal
+             * counters. This function uses all the repair threads.
+             *
+             * @return uint64_t The number of possible attacks.
+             */
+            uint64_t getCounterAttackCount(void) const;
+
+            /**
+             * @brief Sums the attacks stored in a range of diagonal counters.
+             * This function is used as a thread routine.
+             *
+             * @param[in] start The first diagonal to sum.
+             * @param[in] end The diagonal after the last one to sum.
+             * @param[out] attacks The number of attacks in the range.
+             */
+            void counterAttackThread(const uint32_t start,
+                                     const uint32_t end,
+                                     uint64_t* attacks) const;
+
+            /**
+             * @brief Rebuilds the diagonal counters from the board. This
+             * function uses all the repair threads.
+             *
+             * @param[in] solution The board to count.
+             */
+            void rebuildCounters(const std::vector<uint32_t>& solution);
+
+            /**
+             * @brief Adds the queens of a block of columns to the diagonal
+             * counters. This function is used as a thread routine.
+             *
+             * @param[in] solution The board to count.
+             * @param[in] start The first column of the block.
+             * @param[in] end The column after the last column of the block.
+             */
+            void countThread(const std::vector<uint32_t>* solution,
+                             const uint32_t start,
+                             const uint32_t end);
+
+            /**
+             * @brief Initializes a block of columns of the board. The block
+             * values are shuffled, preferring lines with free diagonals. This
+             * function is used as a thread routine.
+             *
+             * @param[in/out] solution The board to initialize.
+             * @param[in] start The first column of the block.
+             * @param[in] end The column after the last column of the block.
+             * @param[in] seed The seed of the thread random engine.
+             */
+            void initThread(std::vector<uint32_t>* solution,
+                            const uint32_t start,
+                            const uint32_t end,
+                            const uint32_t seed);
+
+            /**
+             * @brief Repairs the conflicted queens of a block of columns. The
+             * block starts at column start and wraps around the board. This
+             * function is used as a thread routine.
+             *
+             * @param[in/out] solution The board to repair.
+             * @param[in] start The first column of the block.
+             * @param[in] size The number of columns in the block.
+             * @param[in] seed The seed of the thread random engine.
+             * @param[in] perturb Set to true to force random swaps of the
+             * conflicted queens (used when the rounds stall).
+             * @param[in] candidates The columns of the block that may be
+             * conflicted, nullptr to scan the whole block.
+             * @param[out] next The columns that may still be conflicted after
+             * the repair: the unrepaired and the moved queens.
+             */
+            void repairThread(std::vector<uint32_t>* solution,
+                              const uint32_t start,
+                              const uint32_t size,
+                              const uint32_t seed,
+                              const bool perturb,
+                              const std::vector<uint32_t>* candidates,
+                              std::vector<uint32_t>* next);
+
+            /**
+             * @brief Tells if the queen in the given column shares a diagonal
+             * with another queen.
+             *
+             * @param[in] column The queen column.
+             * @param[in] line The queen line.
+             *
+             * @return True if the queen is conflicted, false otherwise.
+             */
+            bool isConflicted(const uint32_t column, const uint32_t line) const;
+
+            /**
+             * @brief Computes the variation of the attack count if the queens
+             * of two columns were swapped.
+             *
+             * @param[in] colA The first column.
+             * @param[in] lineA The line of the first column.
+             * @param[in] colB The second column.
+             * @param[in] lineB The line of the second column.
+             *
+             * @return int64_t The attack count variation.
+             */
+            int64_t getSwapDelta(const uint32_t colA, const uint32_t lineA,
+                                 const uint32_t colB,
+                                 const uint32_t lineB) const;
+
+            /**
+             * @brief Swaps the queens of two columns and updates the diagonal
+             * counters.
+             *
+             * @param[in/out] solution The board.
+             * @param[in] colA The first column.
+             * @param[in] colB The second column.
+             */
+            void swapQueens(std::vector<uint32_t>& solution,
+                            const uint32_t colA, const uint32_t colB);
+
+        public:
+            /**
+             * @brief Destroy the MinConflictsSolver object.
+             *
+             */
+            virtual ~MinConflictsSolver(void);
+
+            /**
+             * @brief Default contructor, unused.
+             *
+             */
+            MinConflictsSolver(void) = delete;
+
+            /**
+             * @brief Construct a new Min-Conflicts Solver object
+             *
+             * @param[in] queensCount The number of queens the problem has to
+             * solve.
+             * @param[in] iterCount The maximal number of repair rounds before
+             * the algorithm should stop.
+             * @param[in] threadCount The number of threads to use, 0 uses
+             * every core of the machine.
+             */
+            MinConflictsSolver(const uint32_t queensCount,
+                               const uint32_t iterCount,
+                               const uint32_t threadCount);
+
+            /**
+             * @brief Solves the N Queens problem and store the solution in the
+             * vector given as parameter.
+             *
+             * @param[out] solution The vector receiving the solution for the
+             * problem. The vector's index represents the Queen's column, the
+             * value at the index represents the Queen's line. -1 represents no
+             * Queen in the column.
+             *
+             * @param[out] attackCount The number of possible attack with the
+             * current solution.
+             */
+            virtual void solve(std::vector<uint32_t>& solution,
+                               uint32_t &attackCount);
+
+#ifdef _TESTMODE
+            /**
+             * @brief Tests the solve method.
+             *
+             */
+            void testSolve(void);
+#endif
+
+    };
+}
+
+#endif /* #ifndef __SOLVER_MIN_CONFLICTS_SOLVER_H */
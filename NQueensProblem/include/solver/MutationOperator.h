@@ -51,6 +51,30 @@ namespace nsSolver
                                     const uint32_t         individualSize,
                                     std::vector<uint32_t>& selection) = 0;
 
+            /**
+             * @brief Returns the two genes swapped in an individual by the
+             * last mutation. Operators that do not mutate by swapping genes
+             * keep the default implementation.
+             *
+             * @param[in] rank The rank of the individual in the last
+             * selection.
+             * @param[out] geneA The first swapped gene.
+             * @param[out] geneB The second swapped gene.
+             *
+             * @return True if the individual was mutated by swapping geneA
+             * and geneB, false if the swapped genes are not known.
+             */
+            virtual bool getSwappedGenes(const uint32_t rank,
+                                         uint32_t&      geneA,
+                                         uint32_t&      geneB) const
+            {
+                (void)rank;
+                (void)geneA;
+                (void)geneB;
+
+                return false;
+            }
+
             /**
              * @brief Destroy the Mutation Operator object.
              *
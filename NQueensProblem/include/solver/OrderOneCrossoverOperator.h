@@ -20,6 +20,7 @@
 #define __SOLVER_ORDER_ONE_CROSSOVER_OPERATOR_H_
 
 #include <cstdint> /* Generic int types */
+#include <vector>  /* std::vector */
 #include <random>  /* std::default_random_engine */
 
 #include <solver/CrossoverOperator.h> /* nsSolver::CrossoverOperator */
@@ -47,16 +48,28 @@ namespace nsSolver
              */
             std::default_random_engine randomGenerator;
 
+            /**
+             * @brief Tells if each allele was already placed in the child
+             * being built. The table is kept between calls.
+             *
+             */
+            std::vector<uint8_t> placed;
+
             /**
              * @brief apply the crossover between two parents ot create two new
              * children.
              *
              * @param[in] individualSize The size of an individual.
              * @param[in] parents The parents to mate.
+             * @param[in] parentsHash The Zobrist hashes of the parents.
              * @param[out] children The array of children to be created.
+             * @param[out] childrenHash The Zobrist hashes of the children.
              */
-            void mate(const uint32_t individualSize, const uint32_t** parents,
-                      uint32_t**     children);
+            void mate(const uint32_t   individualSize,
+                      const uint32_t** parents,
+                      const uint64_t*  parentsHash,
+                      uint32_t**       children,
+                      uint64_t*        childrenHash);
 
         public:
             /**
@@ -66,18 +79,23 @@ namespace nsSolver
              * @param[in] individualSize The size of an individual.
              * @param[in] pop The population to use.
              * @param[in] popSize The size of the population.
+             * @param[in] popHash The Zobrist hashes of the population.
              * @param[in] matingPool The selected individuals to mate (indexes
              * in population).
              * @param[in] matingPoolSize The number of parents that should be
              * mated.
              * @param[out] newChildren The generated children.
+             * @param[out] childrenHash The Zobrist hashes of the children,
+             * derived from the parents hashes with the genes that differ.
              */
             virtual void operator()(const uint32_t   individualSize,
                                     const uint32_t** pop,
                                     const uint32_t   popSize,
+                                    const uint64_t*  popHash,
                                     const uint32_t*  matingPool,
                                     const uint32_t   matingPoolSize,
-                                    uint32_t**       newChildren);
+                                    uint32_t**       newChildren,
+                                    uint64_t*        childrenHash);
 
             /**
              * @brief Construct a new Order One Crossover Operator object.
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * File: PMXCrossoverOperator.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Crossover operator implementing the partially mapped crossover (PMX).
+ * A swath of consecutive alleles from parent 1 is copied at the same
+ * positions in the child, the rest of the child keeps the alleles of parent 2
+ * at their positions, the conflicting alleles being placed through the
+ * mapping defined by the swath.
+ ******************************************************************************/
+
+#ifndef __SOLVER_PMX_CROSSOVER_OPERATOR_H_
+#define __SOLVER_PMX_CROSSOVER_OPERATOR_H_
+
+#include <cstdint> /* Generic int types */
+#include <vector>  /* std::vector */
+#include <random>  /* std::default_random_engine */
+
+#include <solver/CrossoverOperator.h> /* nsSolver::CrossoverOperator */
+
+/**
+ * @brief N Queens problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Partially mapped crossover. Contrary to the order 1 crossover,
+     * most genes keep their column in the child, which keeps the queens of
+     * both parents on their diagonals.
+     *
+     * The child is built as a copy of parent 2 in which every allele of the
+     * swath of parent 1 is swapped into place. Tracking the position of each
+     * allele in the child makes each swap O(1), the child is built in
+     * O(individualSize). The position table is kept between calls, the
+     * operator does not allocate once it has seen the individual size. An
+     * operator instance must not be shared by several threads.
+     *
+     */
+    class PMXCrossoverOperator: public CrossoverOperator
+    {
+        private:
+            /**
+             * @brief Random number engine.
+             *
+             */
+            std::default_random_engine randomGenerator;
+
+            /**
+             * @brief Position of each allele in the child being built.
+             *
+             */
+            std::vector<uint32_t> positions;
+
+            /**
+             * @brief apply the crossover between two parents ot create two new
+             * children.
+             *
+             * @param[in] individualSize The size of an individual.
+             * @param[in] parents The parents to mate.
+             * @param[in] parentsHash The Zobrist hashes of the parents.
+             * @param[out] children The array of children to be created.
+             * @param[out] childrenHash The Zobrist hashes of the children.
+             */
+            void mate(const uint32_t   individualSize,
+                      const uint32_t** parents,
+                      const uint64_t*  parentsHash,
+                      uint32_t**       children,
+                      uint64_t*        childrenHash);
+
+        public:
+            /**
+             * @brief Generate new offstring from the mating pool given as
+             * parameter.
+             *
+             * @param[in] individualSize The size of an individual.
+             * @param[in] pop The population to use.
+             * @param[in] popSize The size of the population.
+             * @param[in] popHash The Zobrist hashes of the population.
+             * @param[in] matingPool The selected individuals to mate (indexes
+             * in population).
+             * @param[in] matingPoolSize The number of parents that should be
+             * mated.
+             * @param[out] newChildren The generated children.
+             * @param[out] childrenHash The Zobrist hashes of the children,
+             * derived from the parents hashes with the genes that differ.
+             */
+            virtual void operator()(const uint32_t   individualSize,
+                                    const uint32_t** pop,
+                                    const uint32_t   popSize,
+                                    const uint64_t*  popHash,
+                                    const uint32_t*  matingPool,
+                                    const uint32_t   matingPoolSize,
+                                    uint32_t**       newChildren,
+                                    uint64_t*        childrenHash);
+
+            /**
+             * @brief Construct a new PMX Crossover Operator object.
+             *
+             */
+            PMXCrossoverOperator(void);
+
+            /**
+             * @brief Destroy the PMX Crossover Operator object.
+             *
+             */
+            virtual ~PMXCrossoverOperator(void) {}
+    };
+}
+
+#endif /* #ifndef __SOLVER_PMX_CROSSOVER_OPERATOR_H_ */
@@ -40,18 +40,23 @@ namespace nsSolver
              * merge.
              * @param[in] popSize The size of the initial population.
              * @param[in/out] popFitness The fitness of the initial population.
+             * @param[in/out] popHash The hash of the initial population, the
+             * hash of a replaced individual is copied from its child.
              * @param[in] children The children population.
              * @param[in] childrenSize The size of the children population.
              * @param[in] childrenFitness The fitness of the children
              * population.
+             * @param[in] childrenHash The hash of the children population.
              * @param[in] individualSize The size of an individual.
              */
             virtual void operator()(uint32_t**       population,
                                     const uint32_t   popSize,
                                     uint32_t*        popFitness,
+                                    uint64_t*        popHash,
                                     const uint32_t** children,
                                     const uint32_t   childrenSize,
                                     const uint32_t*  childrenFitness,
+                                    const uint64_t*  childrenHash,
                                     const uint32_t   individualSize) = 0;
 
             /**
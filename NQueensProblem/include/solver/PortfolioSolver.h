@@ -0,0 +1,209 @@
+/******************************************************************************
+ * File: PortfolioSolver.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * PortfolioSolver implements the Solver class. Any class implementing the
+ * Solver interface is assumed to solve the N Queens Problem.
+ * The solver races the other search solvers on separate threads and keeps the
+ * first zero conflict solution.
+ ******************************************************************************/
+
+#ifndef __SOLVER_PORTFOLIO_SOLVER_H
+#define __SOLVER_PORTFOLIO_SOLVER_H
+
+#include <cstdint>            /* uint32_t */
+#include <vector>             /* std::vector */
+#include <string>             /* std::string */
+#include <atomic>             /* std::atomic */
+#include <mutex>              /* std::mutex */
+#include <condition_variable> /* std::condition_variable */
+
+#include <solver/Solver.h> /* nsSolver::Sovler */
+
+#define PORTFOLIO_POLL_MS 10
+
+/**
+ * @brief N Queens problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Portfolio Solver, runs the greedy, hill climbing, genetic,
+     * memetic and min-conflicts solvers concurrently.
+     *
+     * Every engine runs on its own thread and shares the same stop flag. The
+     * first engine returning a complete zero conflict solution sets the flag
+     * and the other engines return at their next check. When no engine finds
+     * such a solution, the best complete solution is kept once every engine
+     * bounded by the iteration count has finished. The greedy engine is not
+     * bounded by the iteration count, it is then stopped as well.
+     * The constructive solver is not part of the portfolio: it returns a
+     * solution for every N >= 4 without any search and would always win.
+     *
+     */
+    class PortfolioSolver: public Solver
+    {
+        private:
+            /**
+             * @brief The number of queens the problem has to solve.
+             *
+             */
+            uint32_t queensCount;
+
+            /**
+             * @brief The maximum number of iterations given to each engine.
+             *
+             */
+            uint32_t iterCount;
+
+            /**
+             * @brief The engines raced by the portfolio.
+             *
+             */
+            std::vector<Solver*> engines;
+
+            /**
+             * @brief The name of each engine, as used on the command line.
+             *
+             */
+            std::vector<std::string> engineNames;
+
+            /**
+             * @brief Tells if each engine stops by itself after iterCount
+             * iterations.
+             *
+             */
+            std::vector<bool> engineBounded;
+
+            /**
+             * @brief Stop flag shared by all the engines.
+             *
+             */
+            std::atomic<bool> engineStop;
+
+            /**
+             * @brief Protects the race state below.
+             *
+             */
+            std::mutex raceLock;
+
+            /**
+             * @brief Signaled each time an engine finishes.
+             *
+             */
+            std::condition_variable raceSignal;
+
+            /**
+             * @brief Number of engines that finished.
+             *
+             */
+            uint32_t finishedCount;
+
+            /**
+             * @brief Number of bounded engines that finished.
+             *
+             */
+            uint32_t finishedBoundedCount;
+
+            /**
+             * @brief Index of the first engine that found a zero conflict
+             * solution, UINT32_MAX if none did.
+             *
+             */
+            uint32_t winnerIndex;
+
+            /**
+             * @brief Name of the engine that produced the last solution.
+             *
+             */
+            std::string winnerName;
+
+            /**
+             * @brief Runs one engine and reports its result. This function is
+             * used as a thread routine.
+             *
+             * @param[in] index The index of the engine to run.
+             * @param[out] solution The solution found by the engine.
+             * @param[out] attackCount The attack count of the solution.
+             */
+            void engineThread(const uint32_t index,
+                              std::vector<uint32_t>* solution,
+                              uint32_t* attackCount);
+
+            /**
+             * @brief Computer the number of attacks of the current solution.
+             *
+             * @param[in] solution The current solution for which we need to
+             * compute the number of possible attacks.
+             *
+             * @return uint32_t The number of possible attacks for the solution.
+             */
+            uint32_t
+            getAttackCount(const std::vector<uint32_t>& solution) const;
+
+        public:
+            /**
+             * @brief Destroy the PortfolioSolver object.
+             *
+             */
+            virtual ~PortfolioSolver(void);
+
+            /**
+             * @brief Default contructor, unused.
+             *
+             */
+            PortfolioSolver(void) = delete;
+
+            /**
+             * @brief Construct a new Portfolio Solver object
+             *
+             * @param[in] queensCount The number of queens the problem has to
+             * solve.
+             * @param[in] iterCount The maximal number of iterations given to
+             * each engine.
+             */
+            PortfolioSolver(const uint32_t queensCount,
+                            const uint32_t iterCount);
+
+            /**
+             * @brief Solves the N Queens problem and store the solution in the
+             * vector given as parameter.
+             *
+             * @param[out] solution The vector receiving the solution for the
+             * problem. The vector's index represents the Queen's column, the
+             * value at the index represents the Queen's line. -1 represents no
+             * Queen in the column.
+             *
+             * @param[out] attackCount The number of possible attack with the
+             * current solution.
+             */
+            virtual void solve(std::vector<uint32_t>& solution,
+                               uint32_t &attackCount);
+
+            /**
+             * @brief Returns the name of the engine that produced the last
+             * solution.
+             *
+             * @return const std::string& The engine name, empty if no engine
+             * produced a complete solution.
+             */
+            const std::string& getWinner(void) const;
+
+#ifdef _TESTMODE
+            /**
+             * @brief Tests the solve method.
+             *
+             */
+            void testSolve(void);
+#endif
+
+    };
+}
+
+#endif /* #ifndef __SOLVER_PORTFOLIO_SOLVER_H */
@@ -0,0 +1,282 @@
+/*******************************************************************************
+ * File: ShmMigrantExchange.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Migrant exchange between the processes of one machine through a POSIX
+ * shared memory ring.
+ ******************************************************************************/
+
+#ifndef __SOLVER_SHM_MIGRANT_EXCHANGE_H_
+#define __SOLVER_SHM_MIGRANT_EXCHANGE_H_
+
+#include <cstdint>     /* Generic int types */
+#include <cstddef>     /* size_t */
+#include <string>      /* std::string */
+#include <vector>      /* std::vector */
+#include <atomic>      /* std::atomic */
+#include <sys/types.h> /* ino_t */
+
+#include <solver/MigrantExchange.h> /* nsSolver::MigrantExchange */
+
+#define MIGRANT_SLOT_COUNT      64
+#define MIGRANT_OPEN_TIMEOUT_MS 1000
+#define MIGRANT_SLOT_TIMEOUT_MS 1000
+
+/**
+ * @brief N Queens problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Header of the shared memory segment. The segment is zeroed at
+     * creation, the state is set once the other fields are written.
+     *
+     */
+    struct ShmHeader
+    {
+        std::atomic<uint32_t> state;
+        uint32_t              individualSize;
+        uint32_t              slotCount;
+        uint32_t              reserved;
+        std::atomic<uint64_t> writeIndex;
+    };
+
+    /**
+     * @brief Slot of the ring, followed by the genes of the individual. The
+     * low half of the sequence counts the writes, the high half holds the
+     * pid of the last process that locked the slot. The lock time is in
+     * steady clock milliseconds, zero until the owner wrote it.
+     *
+     */
+    struct ShmSlot
+    {
+        std::atomic<uint64_t> sequence;
+        std::atomic<uint64_t> index;
+        uint64_t              sender;
+        uint32_t              fitness;
+        uint32_t              reserved;
+        std::atomic<uint64_t> lockTime;
+    };
+
+    /**
+     * @brief Shared memory migrant exchange.
+     *
+     * The shared memory segment holds a header and a ring of slots. A
+     * publisher reserves the next slot index with an atomic increment and
+     * writes the slot under a sequence lock: the slot sequence is odd while
+     * the slot is written. Readers copy a slot and keep it only if its
+     * sequence was even and did not change during the copy, readers never
+     * block the publishers. Each process remembers the last index it read.
+     * A slot left locked by a dead process, or locked for longer than
+     * MIGRANT_SLOT_TIMEOUT_MS, is reclaimed by the next publisher or reader
+     * that finds it.
+     * The first process creates the segment, the next ones map it and
+     * start with the migrants still in the ring. Closing the exchange does
+     * not remove the segment, remove must be called once every process left.
+     *
+     */
+    class ShmMigrantExchange: public MigrantExchange
+    {
+        private:
+            /**
+             * @brief The mapped segment, nullptr when the exchange is closed.
+             *
+             */
+            uint8_t* segment;
+
+            /**
+             * @brief The size of the mapped segment.
+             *
+             */
+            size_t segmentSize;
+
+            /**
+             * @brief The size of an individual.
+             *
+             */
+            uint32_t individualSize;
+
+            /**
+             * @brief The number of slots of the ring.
+             *
+             */
+            uint32_t slotCount;
+
+            /**
+             * @brief The size of a slot in bytes.
+             *
+             */
+            size_t slotSize;
+
+            /**
+             * @brief Identifier of this exchange, used to skip its own
+             * migrants.
+             *
+             */
+            uint64_t sender;
+
+            /**
+             * @brief Index of the next slot to read.
+             *
+             */
+            uint64_t readIndex;
+
+            /**
+             * @brief Scratch marks of the genes seen in a migrant, one per
+             * line.
+             *
+             */
+            std::vector<uint8_t> seen;
+
+            /**
+             * @brief Returns the address of a slot of the ring.
+             *
+             * @param[in] index The slot index, taken modulo the slot count.
+             *
+             * @return uint8_t* The slot address.
+             */
+            uint8_t* getSlot(const uint64_t index) const;
+
+            /**
+             * @brief Tells if a locked slot was left by its owner, either
+             * because the owner died or because it held the lock for too
+             * long.
+             *
+             * @param[in] slot The slot to check.
+             * @param[in] sequence The odd sequence read from the slot.
+             *
+             * @return True if the slot can be reclaimed, false otherwise.
+             */
+            bool isAbandoned(const ShmSlot* slot,
+                             const uint64_t sequence) const;
+
+            /**
+             * @brief Locks a slot for this process. A slot locked by another
+             * process is only taken when it was abandoned.
+             *
+             * @param[in] slot The slot to lock.
+             * @param[out] sequence The locked sequence of the slot.
+             *
+             * @return True if the slot is locked, false otherwise.
+             */
+            bool lockSlot(ShmSlot* slot, uint64_t& sequence) const;
+
+            /**
+             * @brief Unlocks a slot locked by this process.
+             *
+             * @param[in] slot The slot to unlock.
+             * @param[in] sequence The locked sequence of the slot.
+             *
+             * @return True if the slot was still locked by this process,
+             * false if another process reclaimed it meanwhile.
+             */
+            bool unlockSlot(ShmSlot* slot, const uint64_t sequence) const;
+
+            /**
+             * @brief Creates or maps the segment once.
+             *
+             * @param[in] name The shared memory object name.
+             * @param[in] individualSize The size of an individual.
+             * @param[in] slotCount The number of slots of the ring.
+             * @param[out] stale True if the segment was never initialized by
+             * its creator.
+             * @param[out] staleInode The inode of the mapped segment.
+             * @param[out] error The error description when the function fails.
+             *
+             * @return True if the exchange is open, false otherwise.
+             */
+            bool openSegment(const std::string& name,
+                             const uint32_t     individualSize,
+                             const uint32_t     slotCount,
+                             bool&              stale,
+                             ino_t&             staleInode,
+                             std::string&       error);
+
+        public:
+            /**
+             * @brief Construct a new closed Shm Migrant Exchange object.
+             *
+             */
+            ShmMigrantExchange(void);
+
+            /**
+             * @brief Destroy the Shm Migrant Exchange object, the exchange is
+             * closed.
+             *
+             */
+            virtual ~ShmMigrantExchange(void);
+
+            /**
+             * @brief Opens the exchange, the segment is created if it does
+             * not exist yet. A segment that its creator never initialized,
+             * e.g. after a crash, is replaced by a new one.
+             *
+             * @param[in] name The shared memory object name, starting with /.
+             * @param[in] individualSize The size of an individual, it must
+             * match the size used by the other processes.
+             * @param[in] slotCount The number of slots of the ring, only used
+             * when the segment is created.
+             * @param[out] error The error description when the function fails.
+             *
+             * @return True if the exchange is open, false otherwise.
+             */
+            bool open(const std::string& name,
+                      const uint32_t     individualSize,
+                      const uint32_t     slotCount,
+                      std::string&       error);
+
+            /**
+             * @brief Closes the exchange, the segment is kept for the other
+             * processes.
+             *
+             */
+            void close(void);
+
+            /**
+             * @brief Removes a shared memory segment. The processes that
+             * still have it open keep using it.
+             *
+             * @param[in] name The shared memory object name.
+             */
+            static void remove(const std::string& name);
+
+            /**
+             * @brief Publishes an individual to the other processes. The
+             * function fails when the reserved slot is being written by a
+             * publisher that went around the whole ring, or when the slot
+             * was reclaimed before the individual was written.
+             *
+             * @param[in] individual The individual to publish.
+             * @param[in] fitness The fitness of the individual.
+             *
+             * @return True if the individual was published, false otherwise.
+             */
+            virtual bool publish(const uint32_t* individual,
+                                 const uint32_t  fitness);
+
+            /**
+             * @brief Consumes the individuals published by the other
+             * processes since the last call, the most recent ones first.
+             * Slots overwritten or being written during the copy are skipped,
+             * as well as the individuals that are not permutations. The
+             * abandoned slots met are reclaimed.
+             *
+             * @param[out] individuals The buffers receiving the individuals.
+             * @param[out] fitness The fitness given by the publishers.
+             * @param[in] maxCount The number of buffers in individuals.
+             *
+             * @return uint32_t The number of individuals consumed.
+             */
+            virtual uint32_t consume(uint32_t**     individuals,
+                                     uint32_t*      fitness,
+                                     const uint32_t maxCount);
+    };
+}
+
+#endif /* #ifndef __SOLVER_SHM_MIGRANT_EXCHANGE_H_ */
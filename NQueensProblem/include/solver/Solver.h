@@ -16,6 +16,7 @@
 
 #include <cstdint> /* uint32_t */
 #include <vector>  /* std::vector */
+#include <atomic>  /* std::atomic */
 
 /**
  * @brief N Queens problem solvers.
@@ -30,6 +31,25 @@ namespace nsSolver
     class Solver
     {
         private:
+            /**
+             * @brief Cooperative cancellation flag, nullptr when the solver
+             * cannot be cancelled.
+             *
+             */
+            const std::atomic<bool>* stopFlag = nullptr;
+
+        protected:
+            /**
+             * @brief Tells if the solver was asked to stop. Solvers check it
+             * in their main loops and return their current best solution.
+             *
+             * @return True if the solver should stop, false otherwise.
+             */
+            bool isStopped(void) const
+            {
+                return this->stopFlag != nullptr &&
+                       this->stopFlag->load(std::memory_order_relaxed);
+            }
 
         public:
             /**
@@ -38,6 +58,18 @@ namespace nsSolver
              */
             virtual ~Solver(void){};
 
+            /**
+             * @brief Sets the flag used to cancel the solver. The flag must
+             * outlive every call to solve.
+             *
+             * @param[in] stopFlag The flag, the solver stops as soon as it is
+             * set to true. nullptr disables the cancellation.
+             */
+            void setStopFlag(const std::atomic<bool>* stopFlag)
+            {
+                this->stopFlag = stopFlag;
+            }
+
             /**
              * @brief Solves the N Queens problem and store the solution in the
              * vector given as parameter.
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * File: SwapLocalSearchOperator.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Local search operator. Implements the LocalSearchOperator interface.
+ * The Swap local search operator swaps conflicted queens with random queens
+ * of the same individual while the swaps reduce the attack count.
+ ******************************************************************************/
+
+#ifndef __SOLVER_SWAP_LOCAL_SEARCH_OPERATOR_H_
+#define __SOLVER_SWAP_LOCAL_SEARCH_OPERATOR_H_
+
+#include <cstdint> /* Generic int types */
+#include <vector>  /* std::vector */
+#include <random>  /* std::default_random_engine */
+
+#include <solver/LocalSearchOperator.h> /* nsSolver::LocalSearchOperator */
+
+#define LS_SWAP_TRIES 16
+
+/**
+ * @brief N Queens problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Swap local search operator. Implements the LocalSearchOperator
+     * interface.
+     * The operator counts the queens of each line and diagonal of an
+     * individual, then tries a bounded number of swaps between a conflicted
+     * queen and random queens, moving to the next conflicted queen after the
+     * first improving swap or LS_SWAP_TRIES failures. The swap gain is computed in constant time
+     * from the counters and only improving swaps are kept. Swaps never change
+     * the number of queens on a line, permutations stay permutations.
+     * The individuals are split in blocks, one per thread.
+     *
+     */
+    class SwapLocalSearchOperator: public LocalSearchOperator
+    {
+        private:
+            /**
+             * @brief Random number engine.
+             *
+             */
+            std::default_random_engine randomGenerator;
+
+            /**
+             * @brief Number of swaps tried per queen of an individual.
+             *
+             */
+            uint32_t budget;
+
+            /**
+             * @brief Number of threads used to improve the individuals.
+             *
+             */
+            uint32_t threadCount;
+
+            /**
+             * @brief Improves a block of individuals. This function is used as
+             * a thread routine.
+             *
+             * @param[in/out] individuals The individuals to improve.
+             * @param[in] start The first individual of the block.
+             * @param[in] end The individual after the last one of the block.
+             * @param[in] individualSize The size of an individual.
+             * @param[in/out] hashes The Zobrist hashes of the individuals.
+             * @param[out] fitness The fitness of each improved individual.
+             * @param[in] seed The seed of the thread random engine.
+             */
+            void searchThread(uint32_t**     individuals,
+                              const uint32_t start,
+                              const uint32_t end,
+                              const uint32_t individualSize,
+                              uint64_t*      hashes,
+                              uint32_t*      fitness,
+                              const uint32_t seed);
+
+        public:
+            /**
+             * @brief Improves a set of individuals and computes their fitness.
+             *
+             * @param[in/out] individuals The individuals to improve.
+             * @param[in] individualCount The number of individuals.
+             * @param[in] individualSize The size of an individual.
+             * @param[in/out] hashes The Zobrist hashes of the individuals,
+             * updated with each accepted swap.
+             * @param[out] fitness The fitness of each improved individual.
+             */
+            virtual void operator()(uint32_t**     individuals,
+                                    const uint32_t individualCount,
+                                    const uint32_t individualSize,
+                                    uint64_t*      hashes,
+                                    uint32_t*      fitness);
+
+            /**
+             * @brief Construct a new Swap Local Search Operator object.
+             *
+             * @param[in] budget The number of swaps tried per queen of an
+             * individual, 0 only computes the fitness.
+             * @param[in] threadCount The number of threads to use, 0 uses
+             * every core of the machine.
+             */
+            SwapLocalSearchOperator(const uint32_t budget,
+                                    const uint32_t threadCount);
+
+            /**
+             * @brief Destroy the Local Search Operator object.
+             *
+             */
+            virtual ~SwapLocalSearchOperator(void) {}
+    };
+}
+
+#endif /* #ifndef __SOLVER_SWAP_LOCAL_SEARCH_OPERATOR_H_ */
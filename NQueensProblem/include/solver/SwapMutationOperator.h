@@ -17,6 +17,7 @@
 
 #include <cstdint> /* Generic int types */
 #include <vector>  /* std::vector */
+#include <utility> /* std::pair */
 #include <random>  /* std::default_random_engine */
 
 #include <solver/MutationOperator.h> /* nsSolver::MutationOperator */
@@ -43,6 +44,12 @@ namespace nsSolver
              */
             std::default_random_engine randomGenerator;
 
+            /**
+             * @brief Genes swapped in each individual of the last selection.
+             *
+             */
+            std::vector<std::pair<uint32_t, uint32_t>> swappedGenes;
+
         public:
             /**
              * @brief Apply mutation to a set of individual in the population.
@@ -65,6 +72,22 @@ namespace nsSolver
                                     const uint32_t         individualSize,
                                     std::vector<uint32_t>& selection);
 
+            /**
+             * @brief Returns the two genes swapped in an individual by the
+             * last mutation.
+             *
+             * @param[in] rank The rank of the individual in the last
+             * selection.
+             * @param[out] geneA The first swapped gene.
+             * @param[out] geneB The second swapped gene.
+             *
+             * @return True if the rank is part of the last selection, false
+             * otherwise.
+             */
+            virtual bool getSwappedGenes(const uint32_t rank,
+                                         uint32_t&      geneA,
+                                         uint32_t&      geneB) const;
+
             /**
              * @brief Construct a new Swap Mutation Operator object.
              *
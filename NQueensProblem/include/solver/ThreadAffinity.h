@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * File: ThreadAffinity.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Placement of the solver worker threads on the cores and NUMA nodes of the
+ * machine.
+ ******************************************************************************/
+
+#ifndef __SOLVER_THREAD_AFFINITY_H_
+#define __SOLVER_THREAD_AFFINITY_H_
+
+#include <cstdint> /* Generic int types */
+#include <string>  /* std::string */
+#include <vector>  /* std::vector */
+
+#define AFFINITY_NODE_PATH "/sys/devices/system/node"
+
+/**
+ * @brief N Queens problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Thread affinity, maps worker indexes to cores.
+     *
+     * The cores the process may run on are read from its affinity mask and
+     * grouped by NUMA node, as listed by the node cpulist files of sysfs.
+     * Consecutive workers get consecutive cores of the same node, so the
+     * workers of neighbouring blocks share a node and its caches. Cores are
+     * taken in the kernel order, which lists one thread of each physical
+     * core before the hyperthread siblings on usual machines. When sysfs is
+     * not available every core is put in node 0.
+     *
+     */
+    class ThreadAffinity
+    {
+        private:
+            /**
+             * @brief The cores, grouped by node.
+             *
+             */
+            std::vector<uint32_t> cpus;
+
+            /**
+             * @brief The node of each core.
+             *
+             */
+            std::vector<uint32_t> cpuNodes;
+
+            /**
+             * @brief The number of nodes with at least one core.
+             *
+             */
+            uint32_t nodeCount;
+
+        public:
+            /**
+             * @brief Construct a new Thread Affinity object from the
+             * topology of the machine.
+             *
+             */
+            ThreadAffinity(void);
+
+            /**
+             * @brief Returns the number of cores available to the workers.
+             *
+             * @return uint32_t The number of cores.
+             */
+            uint32_t getCpuCount(void) const;
+
+            /**
+             * @brief Returns the number of nodes with at least one core.
+             *
+             * @return uint32_t The number of nodes.
+             */
+            uint32_t getNodeCount(void) const;
+
+            /**
+             * @brief Returns the core of a worker, workers wrap around the
+             * cores.
+             *
+             * @param[in] worker The worker index.
+             *
+             * @return uint32_t The core of the worker.
+             */
+            uint32_t getCpu(const uint32_t worker) const;
+
+            /**
+             * @brief Returns the node of a worker.
+             *
+             * @param[in] worker The worker index.
+             *
+             * @return uint32_t The rank of the worker node, from 0 to
+             * getNodeCount() - 1.
+             */
+            uint32_t getNode(const uint32_t worker) const;
+
+            /**
+             * @brief Pins the calling thread to the core of a worker.
+             *
+             * @param[in] worker The worker index.
+             *
+             * @return True if the thread was pinned, false otherwise.
+             */
+            bool pin(const uint32_t worker) const;
+
+            /**
+             * @brief Removes the pinning of the calling thread, it may run on
+             * every core of the process again.
+             *
+             * @return True if the pinning was removed, false otherwise.
+             */
+            bool unpin(void) const;
+
+            /**
+             * @brief Parses a sysfs cpulist such as 0-3,8-11.
+             *
+             * @param[in] list The cpulist.
+             * @param[out] cpus The cores of the list, in the list order.
+             *
+             * @return True if the list is valid, false otherwise.
+             */
+            static bool parseCpuList(const std::string&     list,
+                                     std::vector<uint32_t>& cpus);
+    };
+}
+
+#endif /* #ifndef __SOLVER_THREAD_AFFINITY_H_ */
@@ -14,10 +14,20 @@
 #include <vector>   /* std::vector */
 #include <iostream> /* std::cout, std::endl */
 #include <cstring>  /* stdncmp */
+#include <string>   /* std::string */
+#include <fstream>  /* std::ifstream */
 
 #include <solver/GreedySolver.h>       /* nsSolver::GreedySolver */
 #include <solver/HillClimbingSolver.h> /* nsSolver::HillClimbingSolver*/
 #include <solver/GeneticSolver.h>      /* nsSolver::GeneticSolver*/
+#include <solver/ConstructiveSolver.h> /* nsSolver::ConstructiveSolver*/
+#include <solver/MinConflictsSolver.h> /* nsSolver::MinConflictsSolver*/
+#include <solver/PortfolioSolver.h>    /* nsSolver::PortfolioSolver*/
+
+/* nsSolver::ShmMigrantExchange */
+#include <solver/ShmMigrantExchange.h>
+/* nsSolver::FileMigrantExchange */
+#include <solver/FileMigrantExchange.h>
 
 using namespace nsSolver; /* Solver's namespace */
 
@@ -25,16 +35,127 @@ using namespace nsSolver; /* Solver's namespace */
 
 static void displayUsage(char* exeName)
 {
-    std::cout << exeName << "[ALGOTYPE] [N] [ITERCOUNT]"
+    std::cout << exeName << "[ALGOTYPE] [N] [ITERCOUNT] [OPTIONS]"
               << std::endl << "\t"
               << "ALGOTYPE is the algorithm type used to solve the problem can "
-              << "be GREEDY, HILL or GEN."
+              << "be GREEDY, HILL, GEN, STEADY, MEMETIC, CONST, MINCONF or "
+              << "PORTFOLIO."
               << std::endl << "\t"
               << "N Is the number of queens to use to solve the problem. "
               << std::endl << "\t"
               << "ITERCOUNT is the maximal number of iteration to reach before"
               << " stopping the algorithm (this is not taken into account for "
-              << "the greedy algorithm)." << std::endl;
+              << "the greedy and constructive algorithms)." << std::endl
+              << "\t"
+              << "OPTIONS set the genetic parameters (GEN, STEADY and MEMETIC):"
+              << std::endl << "\t\t"
+              << "--config=FILE loads key=value lines from FILE."
+              << std::endl << "\t\t"
+              << "--table=FILE loads the entry of the closest board size "
+              << "from the parameter table FILE (" << GEN_TABLE_FILE
+              << " is loaded at startup when present)."
+              << std::endl << "\t\t"
+              << "--adaptive adapts the crossover and mutation probabilities."
+              << std::endl << "\t\t"
+              << "--exchange=shm:/NAME shares the elite with the other "
+              << "processes using the shared memory NAME, --exchange=dir:PATH "
+              << "uses the files of the directory PATH."
+              << std::endl << "\t\t"
+              << "--exchange-reset removes the shared memory of the exchange "
+              << "before joining it, e.g. when it was left by a run on "
+              << "another board size."
+              << std::endl << "\t\t"
+              << "--affinity pins the fitness workers to the cores, node by "
+              << "node, and initializes the population on the worker nodes."
+              << std::endl << "\t\t"
+              << "--KEY=VALUE sets a parameter, KEY can be population, "
+              << "mating-pool, injection-pool, crossover, mutation, "
+              << "mutation-size, crossover-operator or huge-pages (off, "
+              << "transparent or explicit huge pages for the populations)."
+              << std::endl;
+}
+
+static bool parseOptions(int                argc,
+                         char**             argv,
+                         const uint32_t     queens,
+                         GeneticParameters& parameters,
+                         std::string&       exchange,
+                         bool&              exchangeReset,
+                         bool&              affinity)
+{
+    int         i;
+    size_t      separator;
+    std::string option;
+    std::string error;
+
+    /* The tuned parameters are the defaults of the options */
+    if(std::ifstream(GEN_TABLE_FILE).good() &&
+       !parameters.loadTable(GEN_TABLE_FILE, queens, error))
+    {
+        std::cout << error << std::endl;
+        return false;
+    }
+
+    /* Options are applied in order, the last value of a key wins */
+    for(i = 4; i < argc; ++i)
+    {
+        option    = argv[i];
+        separator = option.find('=');
+        if(option == "--adaptive")
+        {
+            parameters.adaptiveRates = true;
+        }
+        else if(option == "--affinity")
+        {
+            affinity = true;
+        }
+        else if(option == "--exchange-reset")
+        {
+            exchangeReset = true;
+        }
+        else if(option.compare(0, 2, "--") != 0 ||
+                separator == std::string::npos)
+        {
+            error = "Wrong option: " + option;
+        }
+        else if(option.compare(0, separator, "--config") == 0)
+        {
+            parameters.loadFile(option.substr(separator + 1), error);
+        }
+        else if(option.compare(0, separator, "--table") == 0)
+        {
+            parameters.loadTable(option.substr(separator + 1), queens, error);
+        }
+        else if(option.compare(0, separator, "--exchange") == 0)
+        {
+            exchange = option.substr(separator + 1);
+            if(exchange.compare(0, 4, "shm:") != 0 &&
+               exchange.compare(0, 4, "dir:") != 0)
+            {
+                error = "Wrong exchange: " + exchange;
+            }
+        }
+        else
+        {
+            parameters.set(option.substr(2, separator - 2),
+                           option.substr(separator + 1),
+                           error);
+        }
+
+        if(!error.empty())
+        {
+            std::cout << error << std::endl;
+            return false;
+        }
+    }
+
+    if(!parameters.validate(error))
+    {
+        std::cout << error << std::endl;
+        return false;
+    }
+
+    return true;
 }
 
 int main(int argc, char** argv)
@@ -43,12 +164,21 @@ int main(int argc, char** argv)
     uint32_t queens;
     uint32_t iterCount;
     uint32_t attackCount;
+    bool     affinity;
+    bool     exchangeReset;
 
     std::vector<uint32_t> solution;
+    std::string           exchange;
+    std::string           error;
+
+    GeneticParameters   parameters;
+    ShmMigrantExchange  shmExchange;
+    FileMigrantExchange fileExchange;
 
-    Solver* solver = nullptr;
+    Solver*          solver          = nullptr;
+    MigrantExchange* migrantExchange = nullptr;
 
-    if(argc != 4)
+    if(argc < 4)
     {
         std::cout << "Wrong argument count" << std::endl;
         displayUsage(argv[0]);
@@ -57,6 +187,43 @@ int main(int argc, char** argv)
     queens    = std::stoi(argv[2]);
     iterCount = std::stoi(argv[3]);
 
+    affinity      = false;
+    exchangeReset = false;
+    if(!parseOptions(argc, argv, queens, parameters, exchange, exchangeReset,
+                     affinity))
+    {
+        displayUsage(argv[0]);
+        return -1;
+    }
+
+    /* Join the other solver processes */
+    if(exchange.compare(0, 4, "shm:") == 0)
+    {
+        if(exchangeReset)
+        {
+            ShmMigrantExchange::remove(exchange.substr(4));
+        }
+        if(!shmExchange.open(exchange.substr(4), queens, MIGRANT_SLOT_COUNT,
+                             error))
+        {
+            std::cout << error << std::endl
+                      << "Use --exchange-reset to remove a stale exchange."
+                      << std::endl;
+            return -1;
+        }
+        migrantExchange = &shmExchange;
+    }
+    else if(exchange.compare(0, 4, "dir:") == 0)
+    {
+        if(!fileExchange.open(exchange.substr(4), queens, MIGRANT_SLOT_COUNT,
+                              error))
+        {
+            std::cout << error << std::endl;
+            return -1;
+        }
+        migrantExchange = &fileExchange;
+    }
+
     if(strncmp(argv[1], "GREEDY", 5) == 0)
     {
         solver = new GreedySolver(queens);
@@ -67,7 +234,39 @@ int main(int argc, char** argv)
     }
     else if(strncmp(argv[1], "GEN", 3) == 0)
     {
-        solver = new GeneticSolver(queens, iterCount);
+        solver = new GeneticSolver(queens, iterCount, parameters);
+        static_cast<GeneticSolver*>(solver)->setMigrantExchange(
+                                                    migrantExchange);
+        static_cast<GeneticSolver*>(solver)->enableAffinity(affinity);
+    }
+    else if(strncmp(argv[1], "STEADY", 6) == 0)
+    {
+        solver = new GeneticSolver(queens, iterCount, parameters);
+        static_cast<GeneticSolver*>(solver)->setMigrantExchange(
+                                                    migrantExchange);
+        static_cast<GeneticSolver*>(solver)->enableAffinity(affinity);
+        static_cast<GeneticSolver*>(solver)->enableSteadyState(true);
+    }
+    else if(strncmp(argv[1], "MEMETIC", 7) == 0)
+    {
+        solver = new GeneticSolver(queens, iterCount, parameters);
+        static_cast<GeneticSolver*>(solver)->setMigrantExchange(
+                                                    migrantExchange);
+        static_cast<GeneticSolver*>(solver)->enableAffinity(affinity);
+        static_cast<GeneticSolver*>(solver)->enableLocalSearch(
+                                                    GEN_LOCAL_SEARCH_BUDGET);
+    }
+    else if(strncmp(argv[1], "CONST", 5) == 0)
+    {
+        solver = new ConstructiveSolver(queens);
+    }
+    else if(strncmp(argv[1], "MINCONF", 7) == 0)
+    {
+        solver = new MinConflictsSolver(queens, iterCount, 0);
+    }
+    else if(strncmp(argv[1], "PORTFOLIO", 9) == 0)
+    {
+        solver = new PortfolioSolver(queens, iterCount);
     }
     else
     {
@@ -81,6 +280,12 @@ int main(int argc, char** argv)
     solver->solve(solution, attackCount);
 
     std::cout << "Attack count: " << attackCount << std::endl;
+    if(strncmp(argv[1], "PORTFOLIO", 9) == 0)
+    {
+        std::cout << "Winner: "
+                  << static_cast<PortfolioSolver*>(solver)->getWinner()
+                  << std::endl;
+    }
     std::cout << "Solution: " << std::endl;
 
     for(i = 0; i < solution.size(); ++i)
@@ -0,0 +1,189 @@
+/******************************************************************************
+ * File: ConstructiveSolver.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * ConstructiveSolver implements the Solver class. Any class implementing the
+ * Solver interface is assumed to solve the N Queens Problem.
+ * The algorithm used to solve the problem is the explicit closed-form
+ * construction (split by N mod 6) that exists for every N >= 4.
+ ******************************************************************************/
+
+#include <cstdint> /* uint32_t, uint64_t */
+#include <vector>  /* std::vector */
+#include <cstdlib> /* abs */
+
+/* Header file */
+#include <solver/ConstructiveSolver.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+ConstructiveSolver::ConstructiveSolver(const uint32_t queensCount)
+{
+    this->queensCount = queensCount;
+}
+
+ConstructiveSolver::~ConstructiveSolver(void)
+{
+
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+void ConstructiveSolver::solve(std::vector<uint32_t>& solution,
+                               uint32_t &attackCount)
+{
+    uint64_t line;
+    uint64_t count;
+    uint32_t column;
+    uint32_t remainder;
+
+    /* Initializes the data */
+    solution.clear();
+    attackCount = 0;
+
+    /* Check parameters */
+    if(this->queensCount == 0)
+    {
+        return;
+    }
+
+    /* The lines below are 1-based, they are stored 0-based in the solution */
+    count     = this->queensCount;
+    remainder = this->queensCount % 6;
+    column    = 0;
+    solution.resize(this->queensCount);
+
+    /* Even lines */
+    if(remainder == 3 && count >= 4)
+    {
+        for(line = 4; line <= count; line += 2)
+        {
+            solution[column++] = line - 1;
+        }
+        solution[column++] = 1;
+    }
+    else
+    {
+        for(line = 2; line <= count; line += 2)
+        {
+            solution[column++] = line - 1;
+        }
+    }
+
+    /* Odd lines */
+    if(remainder == 2 && count >= 4)
+    {
+        solution[column++] = 2;
+        solution[column++] = 0;
+        for(line = 7; line <= count; line += 2)
+        {
+            solution[column++] = line - 1;
+        }
+        solution[column++] = 4;
+    }
+    else if(remainder == 3 && count >= 4)
+    {
+        for(line = 5; line <= count; line += 2)
+        {
+            solution[column++] = line - 1;
+        }
+        solution[column++] = 0;
+        solution[column++] = 2;
+    }
+    else
+    {
+        for(line = 1; line <= count; line += 2)
+        {
+            solution[column++] = line - 1;
+        }
+    }
+
+    /* N = 2 and N = 3 have no solution, the pattern gives the best placement */
+    if(this->queensCount < 4)
+    {
+        attackCount = getAttackCount(solution);
+    }
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+uint32_t
+ConstructiveSolver::getAttackCount(const std::vector<uint32_t>& solution) const
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t attackCount;
+
+    attackCount = 0;
+    for(i = 0; i < this->queensCount; ++i)
+    {
+        for(j = i + 1; j < this->queensCount; ++j)
+        {
+            /* Check same lines, first diagonal and second diagonal */
+            if(solution[i] == solution[j] ||
+               (j - i) == abs(solution[i] - solution[j]))
+            {
+                ++attackCount;
+            }
+        }
+    }
+
+    return attackCount;
+}
+
+#ifdef _TESTMODE
+/*******************************************************************************
+ * Test methods
+ ******************************************************************************/
+/* LCOV_EXCL_START */
+
+#include <stdexcept> /* std::runtime_error */
+void ConstructiveSolver::testSolve(void)
+{
+    uint32_t val;
+    uint32_t i;
+    std::vector<uint32_t> sol;
+    std::vector<bool>     used;
+
+    solve(sol, val);
+    if(sol.size() != this->queensCount)
+    {
+        throw std::runtime_error("Wrong solution size: " +
+                                 std::to_string(sol.size()));
+    }
+    if(getAttackCount(sol) != val)
+    {
+        throw std::runtime_error("Solution does not match" +
+                                 std::to_string(val) + ":" +
+                                 std::to_string(getAttackCount(sol)));
+    }
+    if(this->queensCount >= 4 && val != 0)
+    {
+        throw std::runtime_error("Solution has conflicts for N = " +
+                                 std::to_string(this->queensCount));
+    }
+
+    /* Each line must be used exactly once */
+    used = std::vector<bool>(this->queensCount, false);
+    for(i = 0; i < this->queensCount; ++i)
+    {
+        if(sol[i] >= this->queensCount || used[sol[i]])
+        {
+            throw std::runtime_error("Erroneous line found in solution");
+        }
+        used[sol[i]] = true;
+    }
+}
+
+/* LCOV_EXCL_STOP */
+#endif
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * File: CycleCrossoverOperator.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Crossover operator implementing the cycle crossover (CX).
+ * The positions of the parents are split in cycles: following a cycle from a
+ * position of parent 1 to the position of parent 1 holding the allele of
+ * parent 2 at the same position. The children take their alleles from each
+ * parent alternately, one cycle at a time.
+ ******************************************************************************/
+
+#include <cstdint>   /* Generic int types */
+#include <vector>    /* std::vector */
+#include <random>    /* std::random_device */
+#include <algorithm> /* std::fill */
+
+/* nsSolver::FitnessCache */
+#include <solver/FitnessCache.h>
+
+/* Header file */
+#include <solver/CycleCrossoverOperator.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+CycleCrossoverOperator::CycleCrossoverOperator(void)
+{
+    /* Initialize the random generator */
+    std::random_device rd;
+    this->randomGenerator.seed(rd());
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+void CycleCrossoverOperator::operator()(const uint32_t   individualSize,
+                                        const uint32_t** pop,
+                                        const uint32_t   popSize,
+                                        const uint64_t*  popHash,
+                                        const uint32_t*  matingPool,
+                                        const uint32_t   matingPoolSize,
+                                        uint32_t**       newChildren,
+                                        uint64_t*        childrenHash)
+{
+    uint32_t i;
+    uint32_t offset;
+
+    uint64_t        parentsHash[2];
+    const uint32_t* parents[2] = {nullptr, nullptr};
+    uint32_t*       children[2];
+
+    /* We cannot mate less than two parents */
+    if(matingPoolSize < 2 || individualSize == 0)
+    {
+        return;
+    }
+
+    /* The tables only grow, the next calls do not allocate */
+    if(this->positions.size() < individualSize)
+    {
+        this->positions.resize(individualSize);
+        this->visited.resize(individualSize);
+    }
+
+    /* We mate the parents */
+    offset = 0;
+    for(i = 0; i < matingPoolSize; ++i)
+    {
+        if(parents[0] == nullptr && matingPool[i] < popSize)
+        {
+            parents[0]     = pop[matingPool[i]];
+            parentsHash[0] = popHash[matingPool[i]];
+        }
+        else if(matingPool[i] < popSize)
+        {
+            parents[1]     = pop[matingPool[i]];
+            parentsHash[1] = popHash[matingPool[i]];
+
+            children[0] = newChildren[offset];
+            children[1] = newChildren[offset + 1];
+
+            mate(individualSize, parents, parentsHash, children,
+                 childrenHash + offset);
+
+            parents[0] = nullptr;
+            parents[1] = nullptr;
+            offset += 2;
+        }
+    }
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+void CycleCrossoverOperator::mate(const uint32_t   individualSize,
+                                  const uint32_t** parents,
+                                  const uint64_t*  parentsHash,
+                                  uint32_t**       children,
+                                  uint64_t*        childrenHash)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t donor;
+    uint64_t delta;
+
+    for(i = 0; i < individualSize; ++i)
+    {
+        this->positions[parents[0][i]] = i;
+    }
+    std::fill(this->visited.begin(), this->visited.begin() + individualSize,
+              0);
+
+    /* Walk the cycles, each cycle swaps the parent giving its alleles. The
+     * children hashes start from their parent, the cycles given by the other
+     * parent change both hashes by the same genes */
+    delta = 0;
+    donor = this->randomGenerator() % 2;
+    for(i = 0; i < individualSize; ++i)
+    {
+        if(this->visited[i] != 0)
+        {
+            continue;
+        }
+
+        j = i;
+        do
+        {
+            this->visited[j] = 1;
+            children[0][j] = parents[donor][j];
+            children[1][j] = parents[(donor + 1) % 2][j];
+            if(donor != 0)
+            {
+                delta ^= FitnessCache::getGeneKey(j, parents[0][j]) ^
+                         FitnessCache::getGeneKey(j, parents[1][j]);
+            }
+            j = this->positions[parents[1][j]];
+        } while(j != i);
+
+        donor = (donor + 1) % 2;
+    }
+    childrenHash[0] = parentsHash[0] ^ delta;
+    childrenHash[1] = parentsHash[1] ^ delta;
+}
@@ -0,0 +1,276 @@
+/*******************************************************************************
+ * File: FileMigrantExchange.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Migrant exchange through the files of a directory. This is the fallback of
+ * the shared memory exchange, the directory can be local or shared by several
+ * machines.
+ ******************************************************************************/
+
+#include <cstdint>    /* Generic int types */
+#include <cstring>    /* memset, strerror */
+#include <cerrno>     /* errno, EEXIST */
+#include <cstdio>     /* std::rename, std::remove */
+#include <string>     /* std::string */
+#include <set>        /* std::set */
+#include <vector>     /* std::vector */
+#include <utility>    /* std::pair */
+#include <algorithm>  /* std::sort */
+#include <functional> /* std::greater */
+#include <fstream>    /* std::ifstream, std::ofstream */
+#include <sstream>    /* std::ostringstream */
+#include <random>     /* std::random_device */
+#include <dirent.h>   /* opendir, readdir, closedir */
+#include <sys/stat.h> /* mkdir, stat */
+
+/* Header file */
+#include <solver/FileMigrantExchange.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+FileMigrantExchange::FileMigrantExchange(void)
+{
+    std::random_device rd;
+    std::ostringstream name;
+
+    this->individualSize = 0;
+    this->slotCount      = 0;
+    this->publishCount   = 0;
+
+    name << std::hex << rd() << rd();
+    this->sender = name.str();
+}
+
+FileMigrantExchange::~FileMigrantExchange(void)
+{
+    close();
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+bool FileMigrantExchange::open(const std::string& directory,
+                               const uint32_t     individualSize,
+                               const uint32_t     slotCount,
+                               std::string&       error)
+{
+    struct stat status;
+
+    close();
+
+    if(individualSize == 0 || slotCount == 0)
+    {
+        error = "The migrant exchange needs individuals and slots";
+        return false;
+    }
+    if(mkdir(directory.c_str(), 0700) != 0 && errno != EEXIST)
+    {
+        error = "Cannot create migrant directory " + directory + ": " +
+                strerror(errno);
+        return false;
+    }
+    if(stat(directory.c_str(), &status) != 0 || !S_ISDIR(status.st_mode))
+    {
+        error = directory + " is not a directory";
+        return false;
+    }
+
+    this->directory      = directory;
+    this->individualSize = individualSize;
+    this->slotCount      = slotCount;
+    this->publishCount   = 0;
+    this->consumed.clear();
+    this->seen.assign(individualSize, 0);
+
+    return true;
+}
+
+void FileMigrantExchange::close(void)
+{
+    uint64_t i;
+
+    if(this->directory.empty())
+    {
+        return;
+    }
+
+    /* Remove the files this exchange still owns */
+    i = (this->publishCount > this->slotCount) ?
+        this->publishCount - this->slotCount : 0;
+    for(; i < this->publishCount; ++i)
+    {
+        std::remove(getPath(i).c_str());
+    }
+    this->directory.clear();
+}
+
+bool FileMigrantExchange::publish(const uint32_t* individual,
+                                  const uint32_t  fitness)
+{
+    uint32_t      i;
+    std::string   path;
+    std::string   temporary;
+    std::ofstream file;
+
+    if(this->directory.empty())
+    {
+        return false;
+    }
+
+    /* Write under a hidden name, the rename makes the file visible at
+     * once */
+    path      = getPath(this->publishCount);
+    temporary = this->directory + "/." + this->sender + ".tmp";
+    file.open(temporary);
+    file << this->individualSize << " " << fitness;
+    for(i = 0; i < this->individualSize; ++i)
+    {
+        file << " " << individual[i];
+    }
+    file << std::endl;
+    file.close();
+    if(file.fail() || std::rename(temporary.c_str(), path.c_str()) != 0)
+    {
+        std::remove(temporary.c_str());
+        return false;
+    }
+
+    /* Keep the last slotCount files */
+    if(this->publishCount >= this->slotCount)
+    {
+        std::remove(getPath(this->publishCount - this->slotCount).c_str());
+    }
+    ++this->publishCount;
+
+    return true;
+}
+
+uint32_t FileMigrantExchange::consume(uint32_t**     individuals,
+                                      uint32_t*      fitness,
+                                      const uint32_t maxCount)
+{
+    uint32_t    i;
+    uint32_t    count;
+    std::string name;
+    std::string path;
+    DIR*        handle;
+    dirent*     entry;
+    struct stat status;
+
+    const std::string extension(MIGRANT_FILE_EXTENSION);
+
+    std::set<std::string>                         present;
+    std::vector<std::pair<int64_t, std::string>>  fresh;
+
+    if(this->directory.empty())
+    {
+        return 0;
+    }
+
+    handle = opendir(this->directory.c_str());
+    if(handle == nullptr)
+    {
+        return 0;
+    }
+
+    /* List the migrants of the other processes */
+    while((entry = readdir(handle)) != nullptr)
+    {
+        name = entry->d_name;
+        if(name.size() <= extension.size() || name[0] == '.' ||
+           name.compare(name.size() - extension.size(), std::string::npos,
+                        extension) != 0 ||
+           name.compare(0, this->sender.size() + 1, this->sender + "-") == 0)
+        {
+            continue;
+        }
+
+        present.insert(name);
+        path = this->directory + "/" + name;
+        if(this->consumed.count(name) == 0 &&
+           stat(path.c_str(), &status) == 0)
+        {
+            fresh.push_back(std::make_pair(
+                (int64_t)status.st_mtim.tv_sec * 1000000000 +
+                status.st_mtim.tv_nsec, name));
+        }
+    }
+    closedir(handle);
+
+    /* Forget the files that were removed by their publisher */
+    for(std::set<std::string>::iterator it = this->consumed.begin();
+        it != this->consumed.end();)
+    {
+        if(present.count(*it) == 0)
+        {
+            it = this->consumed.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    /* Read the most recent files first, the others are kept for the next
+     * call */
+    std::sort(fresh.begin(), fresh.end(),
+              std::greater<std::pair<int64_t, std::string>>());
+    count = 0;
+    for(i = 0; i < fresh.size() && count < maxCount; ++i)
+    {
+        path = this->directory + "/" + fresh[i].second;
+        this->consumed.insert(fresh[i].second);
+        if(readMigrant(path, individuals[count], fitness[count]))
+        {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+std::string FileMigrantExchange::getPath(const uint64_t number) const
+{
+    return this->directory + "/" + this->sender + "-" +
+           std::to_string(number) + MIGRANT_FILE_EXTENSION;
+}
+
+bool FileMigrantExchange::readMigrant(const std::string& path,
+                                      uint32_t*          individual,
+                                      uint32_t&          fitness)
+{
+    uint32_t i;
+    uint32_t size;
+
+    std::ifstream file(path);
+
+    if(!(file >> size >> fitness) || size != this->individualSize)
+    {
+        return false;
+    }
+    /* Only permutations are valid individuals, the crossover operators
+     * rely on it */
+    memset(this->seen.data(), 0, size);
+    for(i = 0; i < size; ++i)
+    {
+        if(!(file >> individual[i]) || individual[i] >= size ||
+           this->seen[individual[i]] != 0)
+        {
+            return false;
+        }
+        this->seen[individual[i]] = 1;
+    }
+
+    return true;
+}
@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * File: FitnessCache.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Bounded concurrent fitness cache keyed by the Zobrist hash of the
+ * individuals.
+ ******************************************************************************/
+
+#include <cstdint> /* Generic int types */
+#include <atomic>  /* std::atomic */
+
+/* Header file */
+#include <solver/FitnessCache.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+FitnessCache::FitnessCache(const uint64_t slotCount)
+{
+    this->slotCount = 1;
+    while(this->slotCount < slotCount)
+    {
+        this->slotCount <<= 1;
+    }
+
+    this->checks = new std::atomic<uint64_t>[this->slotCount];
+    this->data   = new std::atomic<uint64_t>[this->slotCount];
+
+    clear();
+}
+
+FitnessCache::~FitnessCache(void)
+{
+    delete[] this->checks;
+    delete[] this->data;
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+bool FitnessCache::lookup(const uint64_t hash, uint32_t& fitness) const
+{
+    uint64_t slot;
+    uint64_t value;
+    uint64_t check;
+
+    slot  = hash & (this->slotCount - 1);
+    value = this->data[slot].load(std::memory_order_relaxed);
+    check = this->checks[slot].load(std::memory_order_relaxed);
+
+    /* Empty, replaced or torn slots fail the check */
+    if(value == 0 || (check ^ value) != hash)
+    {
+        return false;
+    }
+
+    fitness = value - 1;
+    return true;
+}
+
+void FitnessCache::store(const uint64_t hash, const uint32_t fitness)
+{
+    uint64_t slot;
+    uint64_t value;
+
+    slot  = hash & (this->slotCount - 1);
+    value = (uint64_t)fitness + 1;
+
+    this->data[slot].store(value, std::memory_order_relaxed);
+    this->checks[slot].store(hash ^ value, std::memory_order_relaxed);
+}
+
+void FitnessCache::addStats(const uint64_t hitCount, const uint64_t missCount)
+{
+    this->hits.fetch_add(hitCount, std::memory_order_relaxed);
+    this->misses.fetch_add(missCount, std::memory_order_relaxed);
+}
+
+uint64_t FitnessCache::getHits(void) const
+{
+    return this->hits.load();
+}
+
+uint64_t FitnessCache::getMisses(void) const
+{
+    return this->misses.load();
+}
+
+void FitnessCache::clear(void)
+{
+    uint64_t i;
+
+    for(i = 0; i < this->slotCount; ++i)
+    {
+        this->checks[i].store(0, std::memory_order_relaxed);
+        this->data[i].store(0, std::memory_order_relaxed);
+    }
+    this->hits.store(0);
+    this->misses.store(0);
+}
+
+uint64_t FitnessCache::getHash(const uint32_t* individual,
+                               const uint32_t  individualSize)
+{
+    uint32_t i;
+    uint64_t hash;
+
+    hash = 0;
+    for(i = 0; i < individualSize; ++i)
+    {
+        hash ^= getGeneKey(i, individual[i]);
+    }
+
+    return hash;
+}
+
+uint64_t FitnessCache::swapHash(const uint64_t hash,
+                                const uint32_t colA,
+                                const uint32_t lineA,
+                                const uint32_t colB,
+                                const uint32_t lineB)
+{
+    return hash ^
+           getGeneKey(colA, lineA) ^ getGeneKey(colB, lineB) ^
+           getGeneKey(colA, lineB) ^ getGeneKey(colB, lineA);
+}
@@ -0,0 +1,153 @@
+/*******************************************************************************
+ * File: FitnessHeap.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Indexed max heap of the population fitness. Gives the worst individual of
+ * the population in O(1) and updates a fitness in O(log P).
+ ******************************************************************************/
+
+#include <cstdint> /* Generic int types */
+
+/* Header file */
+#include <solver/FitnessHeap.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+FitnessHeap::FitnessHeap(const uint32_t capacity)
+{
+    this->capacity = capacity;
+    this->count    = 0;
+    this->heap     = new uint32_t[capacity];
+    this->position = new uint32_t[capacity];
+    this->fitness  = new uint32_t[capacity];
+}
+
+FitnessHeap::~FitnessHeap(void)
+{
+    delete[] this->heap;
+    delete[] this->position;
+    delete[] this->fitness;
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+void FitnessHeap::build(const uint32_t* popFitness, const uint32_t popSize)
+{
+    uint32_t i;
+
+    this->count = popSize;
+    if(this->count > this->capacity)
+    {
+        this->count = this->capacity;
+    }
+
+    for(i = 0; i < this->count; ++i)
+    {
+        this->heap[i]     = i;
+        this->position[i] = i;
+        this->fitness[i]  = popFitness[i];
+    }
+
+    /* Bottom-up construction */
+    for(i = this->count / 2; i > 0; --i)
+    {
+        siftDown(i - 1);
+    }
+}
+
+uint32_t FitnessHeap::top(void) const
+{
+    return this->heap[0];
+}
+
+uint32_t FitnessHeap::getFitness(const uint32_t index) const
+{
+    return this->fitness[index];
+}
+
+void FitnessHeap::update(const uint32_t index, const uint32_t newFitness)
+{
+    uint32_t oldFitness;
+
+    oldFitness           = this->fitness[index];
+    this->fitness[index] = newFitness;
+
+    if(newFitness > oldFitness)
+    {
+        siftUp(this->position[index]);
+    }
+    else if(newFitness < oldFitness)
+    {
+        siftDown(this->position[index]);
+    }
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+void FitnessHeap::siftUp(uint32_t pos)
+{
+    uint32_t parent;
+
+    while(pos > 0)
+    {
+        parent = (pos - 1) / 2;
+        if(this->fitness[this->heap[parent]] >=
+           this->fitness[this->heap[pos]])
+        {
+            break;
+        }
+        swap(pos, parent);
+        pos = parent;
+    }
+}
+
+void FitnessHeap::siftDown(uint32_t pos)
+{
+    uint32_t child;
+    uint32_t worst;
+
+    while(true)
+    {
+        worst = pos;
+        child = 2 * pos + 1;
+        if(child < this->count &&
+           this->fitness[this->heap[child]] > this->fitness[this->heap[worst]])
+        {
+            worst = child;
+        }
+        ++child;
+        if(child < this->count &&
+           this->fitness[this->heap[child]] > this->fitness[this->heap[worst]])
+        {
+            worst = child;
+        }
+        if(worst == pos)
+        {
+            break;
+        }
+        swap(pos, worst);
+        pos = worst;
+    }
+}
+
+void FitnessHeap::swap(const uint32_t posA, const uint32_t posB)
+{
+    uint32_t tmp;
+
+    tmp              = this->heap[posA];
+    this->heap[posA] = this->heap[posB];
+    this->heap[posB] = tmp;
+
+    this->position[this->heap[posA]] = posA;
+    this->position[this->heap[posB]] = posB;
+}
@@ -68,9 +68,11 @@ FitnessPopulationSelector::FitnessPopulationSelector(void)
 void FitnessPopulationSelector::operator()(uint32_t**       population,
                                            const uint32_t   popSize,
                                            uint32_t*        popFitness,
+                                           uint64_t*        popHash,
                                            const uint32_t** children,
                                            const uint32_t   childrenSize,
                                            const uint32_t*  childrenFitness,
+                                           const uint64_t*  childrenHash,
                                            const uint32_t   individualSize)
 {
     uint32_t i;
@@ -106,6 +108,7 @@ void FitnessPopulationSelector::operator()(uint32_t**       population,
             /* Push the new element and update fitness */
             popElem.push(std::make_pair(index, childrenFitness[childElem[i].first]));
             popFitness[index] = childElem[i].second;
+            popHash[index]    = childrenHash[childElem[i].first];
         }
     }
 }
@@ -0,0 +1,345 @@
+/*******************************************************************************
+ * File: GeneticParameters.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Runtime parameters of the genetic solver. The parameters can be set from
+ * key=value pairs given on the command line, in a configuration file or in a
+ * per board size table written by the autotune tool.
+ ******************************************************************************/
+
+#include <cstdint>   /* Generic int types */
+#include <string>    /* std::string, std::stoul, std::stod */
+#include <fstream>   /* std::ifstream */
+#include <sstream>   /* std::istringstream, std::ostringstream */
+#include <stdexcept> /* std::exception, std::invalid_argument,
+                      * std::out_of_range */
+
+#include <solver/HugePageAllocator.h> /* nsSolver::HugePageAllocator */
+
+/* Header file */
+#include <solver/GeneticParameters.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/**
+ * @brief Parses a count parameter. std::stoul accepts a minus sign and wraps
+ * the value around, negative and too large values are rejected before the
+ * conversion to 32 bits.
+ *
+ * @param[in] value The text of the count.
+ * @param[out] parsed The number of characters parsed.
+ *
+ * @return uint32_t The count.
+ */
+static uint32_t parseCount(const std::string& value, size_t& parsed)
+{
+    size_t        start;
+    unsigned long count;
+
+    start = value.find_first_not_of(" \t\n\v\f\r");
+    if(start != std::string::npos && value[start] == '-')
+    {
+        throw std::invalid_argument(value);
+    }
+
+    count = std::stoul(value, &parsed);
+    if(count > UINT32_MAX)
+    {
+        throw std::out_of_range(value);
+    }
+
+    return (uint32_t)count;
+}
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+GeneticParameters::GeneticParameters(void)
+{
+    this->populationSize    = GEN_POPULATION_SIZE;
+    this->matingPoolSize    = GEN_MATING_POOL_SIZE;
+    this->injectionPoolSize = GEN_INJECTION_POOL_SIZE;
+    this->crossoverProba    = GEN_CROSSOVER_PROBA;
+    this->mutationProba     = GEN_MUTATION_PROBA;
+    this->mutationSize      = GEN_MUTATION_SIZE;
+    this->adaptiveRates     = false;
+    this->crossoverOperator = GEN_CROSSOVER_OPERATOR;
+    this->hugePages         = GEN_HUGE_PAGES;
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+bool GeneticParameters::set(const std::string& key,
+                            const std::string& value,
+                            std::string&       error)
+{
+    size_t            parsed;
+    HugePageMode      mode;
+    GeneticParameters previous;
+
+    /* A rejected value must leave the parameters untouched */
+    previous = *this;
+
+    try
+    {
+        if(key == "population")
+        {
+            this->populationSize = parseCount(value, parsed);
+        }
+        else if(key == "mating-pool")
+        {
+            this->matingPoolSize = parseCount(value, parsed);
+        }
+        else if(key == "injection-pool")
+        {
+            this->injectionPoolSize = parseCount(value, parsed);
+        }
+        else if(key == "crossover")
+        {
+            this->crossoverProba = std::stod(value, &parsed);
+        }
+        else if(key == "mutation")
+        {
+            this->mutationProba = std::stod(value, &parsed);
+        }
+        else if(key == "mutation-size")
+        {
+            this->mutationSize = parseCount(value, parsed);
+        }
+        else if(key == "adaptive")
+        {
+            this->adaptiveRates = (parseCount(value, parsed) != 0);
+        }
+        else if(key == "crossover-operator")
+        {
+            if(value != "order1" && value != "pmx" && value != "cycle")
+            {
+                throw std::invalid_argument(value);
+            }
+            this->crossoverOperator = value;
+            parsed = value.size();
+        }
+        else if(key == "huge-pages")
+        {
+            if(!HugePageAllocator::parseMode(value, mode))
+            {
+                throw std::invalid_argument(value);
+            }
+            this->hugePages = value;
+            parsed = value.size();
+        }
+        else
+        {
+            error = "Unknown genetic parameter: " + key;
+            return false;
+        }
+    }
+    catch(const std::exception&)
+    {
+        parsed = std::string::npos;
+    }
+
+    if(parsed != value.size())
+    {
+        *this = previous;
+        error = "Wrong value for genetic parameter " + key + ": " + value;
+        return false;
+    }
+
+    return true;
+}
+
+bool GeneticParameters::loadFile(const std::string& path, std::string& error)
+{
+    size_t      separator;
+    uint32_t    lineNumber;
+    std::string line;
+    std::string key;
+    std::string value;
+
+    std::ifstream file(path);
+
+    if(!file.is_open())
+    {
+        error = "Cannot open genetic configuration file: " + path;
+        return false;
+    }
+
+    lineNumber = 0;
+    while(std::getline(file, line))
+    {
+        ++lineNumber;
+
+        /* Remove the surrounding blanks, skip empty lines and comments */
+        line.erase(0, line.find_first_not_of(" \t\r"));
+        line.erase(line.find_last_not_of(" \t\r") + 1);
+        if(line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        separator = line.find('=');
+        if(separator == std::string::npos)
+        {
+            error = path + ":" + std::to_string(lineNumber) +
+                    ": expected key=value";
+            return false;
+        }
+        key   = line.substr(0, separator);
+        value = line.substr(separator + 1);
+        key.erase(key.find_last_not_of(" \t") + 1);
+        value.erase(0, value.find_first_not_of(" \t"));
+
+        if(!set(key, value, error))
+        {
+            error = path + ":" + std::to_string(lineNumber) + ": " + error;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool GeneticParameters::loadTable(const std::string& path,
+                                  const uint32_t     queensCount,
+                                  std::string&       error)
+{
+    size_t      separator;
+    size_t      parsed;
+    uint32_t    lineNumber;
+    uint32_t    size;
+    uint32_t    bestSize;
+    bool        found;
+    std::string line;
+    std::string token;
+    std::string entry;
+
+    std::ifstream file(path);
+
+    if(!file.is_open())
+    {
+        error = "Cannot open genetic parameter table: " + path;
+        return false;
+    }
+
+    /* Select the entry of the closest size */
+    found      = false;
+    bestSize   = 0;
+    lineNumber = 0;
+    while(std::getline(file, line))
+    {
+        ++lineNumber;
+
+        std::istringstream tokens(line);
+        if(!(tokens >> token) || token[0] == '#')
+        {
+            continue;
+        }
+        try
+        {
+            if(token.compare(0, 2, "N=") != 0)
+            {
+                throw std::invalid_argument(token);
+            }
+            size = parseCount(token.substr(2), parsed);
+        }
+        catch(const std::exception&)
+        {
+            error = path + ":" + std::to_string(lineNumber) +
+                    ": expected N=size";
+            return false;
+        }
+
+        if(!found ||
+           (size <= queensCount && (bestSize > queensCount ||
+                                    size > bestSize)) ||
+           (size > queensCount && bestSize > queensCount && size < bestSize))
+        {
+            found    = true;
+            bestSize = size;
+            entry    = line;
+        }
+    }
+
+    /* Apply the entry */
+    if(found)
+    {
+        std::istringstream tokens(entry);
+        tokens >> token;
+        while(tokens >> token)
+        {
+            separator = token.find('=');
+            if(separator == std::string::npos)
+            {
+                error = path + ": expected key=value in entry N=" +
+                        std::to_string(bestSize);
+                return false;
+            }
+            if(!set(token.substr(0, separator), token.substr(separator + 1),
+                    error))
+            {
+                error = path + ": " + error;
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+std::string GeneticParameters::toString(void) const
+{
+    std::ostringstream output;
+
+    output << "population=" << this->populationSize
+           << " mating-pool=" << this->matingPoolSize
+           << " injection-pool=" << this->injectionPoolSize
+           << " crossover=" << this->crossoverProba
+           << " mutation=" << this->mutationProba
+           << " mutation-size=" << this->mutationSize
+           << " adaptive=" << (this->adaptiveRates ? 1 : 0)
+           << " crossover-operator=" << this->crossoverOperator
+           << " huge-pages=" << this->hugePages;
+
+    return output.str();
+}
+
+bool GeneticParameters::validate(std::string& error) const
+{
+    if(this->populationSize < 2)
+    {
+        error = "The population must contain at least 2 individuals";
+        return false;
+    }
+    if(this->matingPoolSize < 2 || this->matingPoolSize % 2 != 0 ||
+       this->matingPoolSize > this->populationSize)
+    {
+        error = "The mating pool must be even, at least 2 and at most the "
+                "population size";
+        return false;
+    }
+    if(this->injectionPoolSize > this->populationSize)
+    {
+        error = "The injection pool cannot exceed the population size";
+        return false;
+    }
+    if(this->mutationSize > this->populationSize)
+    {
+        error = "The mutation size cannot exceed the population size";
+        return false;
+    }
+    if(this->crossoverProba < 0 || this->crossoverProba > 1 ||
+       this->mutationProba < 0 || this->mutationProba > 1)
+    {
+        error = "The crossover and mutation probabilities must be in [0, 1]";
+        return false;
+    }
+
+    return true;
+}
@@ -12,22 +12,38 @@
  * The algorithm used to solvle the problem is a genetic algorithm.
  ******************************************************************************/
 
-#include <cstdint>  /* uint32_t */
-#include <vector>   /* std::vector */
-#include <set>      /* std::set */
-#include <iostream> /* std::cout, std::endl */
-#include <thread>   /* std::thread */
-#include <random>   /* std::random_device, std::mt19937,
-                       std::uniform_int_distribution */
+#include <cstdint>    /* uint32_t */
+#include <vector>     /* std::vector */
+#include <iostream>   /* std::cout, std::endl */
+#include <thread>     /* std::thread */
+#include <atomic>     /* std::atomic */
+#include <algorithm>  /* std::min, std::fill, std::sort, std::unique */
+#include <utility>    /* std::swap */
+#include <cstring>    /* memcpy */
+#include <functional> /* std::greater */
+#include <random>     /* std::random_device, std::mt19937,
+                         std::uniform_int_distribution */
 
 /* nsSolver::FitnessPropMatingPoolSelector */
 #include <solver/FitnessPropMatingPoolSelector.h>
 /* nsSolver::OrderOneCrossoverOperator */
 #include <solver/OrderOneCrossoverOperator.h>
+/* nsSolver::PMXCrossoverOperator */
+#include <solver/PMXCrossoverOperator.h>
+/* nsSolver::CycleCrossoverOperator */
+#include <solver/CycleCrossoverOperator.h>
 /* nsSolver::SwapMutationOperator */
 #include <solver/SwapMutationOperator.h>
 /* nsSolver::FitnessPopulationSelector */
 #include <solver/FitnessPopulationSelector.h>
+/* nsSolver::SwapLocalSearchOperator */
+#include <solver/SwapLocalSearchOperator.h>
+/* nsSolver::FitnessHeap */
+#include <solver/FitnessHeap.h>
+/* nsSolver::FitnessCache */
+#include <solver/FitnessCache.h>
+/* nsSolver::HugePageAllocator */
+#include <solver/HugePageAllocator.h>
 
 /* Header filed */
 #include <solver/GeneticSolver.h>
@@ -38,49 +54,92 @@ using namespace nsSolver; /* Solver's namespace */
  * Constructors / Destructors
  ******************************************************************************/
 GeneticSolver::GeneticSolver(const uint32_t queensCount,
-                             const uint32_t iterCount)
+                             const uint32_t iterCount):
+    GeneticSolver(queensCount, iterCount, GeneticParameters())
 {
-    uint32_t i;
+}
+
+GeneticSolver::GeneticSolver(const uint32_t           queensCount,
+                             const uint32_t           iterCount,
+                             const GeneticParameters& parameters)
+{
+    uint32_t     i;
+    HugePageMode hugePageMode;
 
     /* Initialize the internal data */
     this->queensCount    = queensCount;
     this->iterCount      = iterCount;
 
     /* Genetic paramters */
-    this->populationSize    = GEN_POPULATION_SIZE;
-    this->matingPoolSize    = GEN_MATING_POOL_SIZE;
-    this->injectionPoolSize = GEN_INJECTION_POOL_SIZE;
-    this->mutationSize      = GEN_MUTATION_SIZE;
+    this->populationSize    = parameters.populationSize;
+    this->matingPoolSize    = parameters.matingPoolSize;
+    this->injectionPoolSize = parameters.injectionPoolSize;
+    this->mutationSize      = parameters.mutationSize;
+    this->crossoverProba    = parameters.crossoverProba;
+    this->mutationProba     = parameters.mutationProba;
+    this->adaptiveRates     = parameters.adaptiveRates;
+    this->crossoverSuccess  = 0;
+    this->mutationSuccess   = 0;
+    this->generationCount   = 0;
+    this->publishedFitness  = UINT32_MAX;
+    this->migrantsSent      = 0;
+    this->migrantsReceived  = 0;
 
     /* Operators initialization */
     this->matingPoolSelector = new FitnessPropMatingPoolSelector();
-    this->crossoverOperator  = new OrderOneCrossoverOperator();
+    if(parameters.crossoverOperator == "pmx")
+    {
+        this->crossoverOperator = new PMXCrossoverOperator();
+    }
+    else if(parameters.crossoverOperator == "cycle")
+    {
+        this->crossoverOperator = new CycleCrossoverOperator();
+    }
+    else
+    {
+        this->crossoverOperator = new OrderOneCrossoverOperator();
+    }
     this->mutationOperator   = new SwapMutationOperator();
     this->populationSelector = new FitnessPopulationSelector();
 
-    /* Data and structures initialization */
-    this->population = new uint32_t*[this->populationSize];
-    for(i = 0; i < this->populationSize; ++i)
+    /* Data and structures initialization, the individuals of each
+     * population are stored contiguously in buffers that may be backed by
+     * huge pages */
+    if(!HugePageAllocator::parseMode(parameters.hugePages, hugePageMode))
     {
-        this->population[i] = new uint32_t[this->queensCount];
+        hugePageMode = HUGE_PAGES_OFF;
     }
+    this->allocator = new HugePageAllocator(hugePageMode);
+
+    this->population        = allocateIndividuals(this->populationSize);
     this->populationFitness = new uint32_t[this->populationSize];
+    this->populationHash    = new uint64_t[this->populationSize];
 
     this->matingPool = new uint32_t[this->matingPoolSize];
 
-    this->children = new uint32_t*[this->matingPoolSize];
-    for(i = 0; i < this->matingPoolSize; ++i)
-    {
-        this->children[i] = new uint32_t[this->queensCount];
-    }
+    this->children        = allocateIndividuals(this->matingPoolSize);
     this->childrenFitness = new uint32_t[this->matingPoolSize];
+    this->childrenHash    = new uint64_t[this->matingPoolSize];
 
-    this->injectionPool = new uint32_t*[this->injectionPoolSize];
-    for(i = 0; i < this->injectionPoolSize; ++i)
+    this->injectionPool    = allocateIndividuals(this->injectionPoolSize);
+    this->injectionFitness = new uint32_t[this->injectionPoolSize];
+    this->injectionHash    = new uint64_t[this->injectionPoolSize];
+
+    this->elite        = new uint32_t[this->queensCount];
+    this->eliteFitness = UINT32_MAX;
+    this->eliteHash    = 0;
+
+    this->fitnessCache = new FitnessCache(GEN_CACHE_SLOTS);
+
+    /* Shared counters of the up and down diagonals of the split fitness */
+    this->splitDiagonals = new std::atomic<uint32_t>[4 * this->queensCount];
+    for(i = 0; i < 4 * this->queensCount; ++i)
     {
-        this->injectionPool[i] = new uint32_t[this->queensCount];
+        this->splitDiagonals[i].store(0, std::memory_order_relaxed);
     }
-    this->injectionFitness = new uint32_t[this->injectionPoolSize];
+
+    /* Get cores count */
+    this->coreCount = detectCores();
 
     /* Initialize the random generator */
     std::random_device rd;
@@ -89,33 +148,34 @@ GeneticSolver::GeneticSolver(const uint32_t queensCount,
 
 GeneticSolver::~GeneticSolver(void)
 {
-    uint32_t i;
-
     /* Delete heaped data */
     delete this->matingPoolSelector;
+    delete this->crossoverOperator;
+    delete this->mutationOperator;
+    delete this->populationSelector;
+    delete this->localSearchOperator;
+    delete this->fitnessCache;
+    delete this->affinity;
+
+    /* The individual buffers are released with the allocator */
+    delete this->allocator;
 
-    for(i = 0; i < this->populationSize; ++i)
-    {
-        delete[] this->population[i];
-    }
     delete[] this->population;
     delete[] this->populationFitness;
+    delete[] this->populationHash;
 
     delete[] this->matingPool;
 
-    for(i = 0; i < this->matingPoolSize; ++i)
-    {
-        delete[] this->children[i];
-    }
     delete[] this->children;
     delete[] this->childrenFitness;
+    delete[] this->childrenHash;
 
-    for(i = 0; i < this->injectionPoolSize; ++i)
-    {
-        delete[] this->injectionPool[i];
-    }
     delete[] this->injectionPool;
     delete[] this->injectionFitness;
+    delete[] this->injectionHash;
+
+    delete[] this->elite;
+    delete[] this->splitDiagonals;
 }
 
 /*******************************************************************************
@@ -124,18 +184,15 @@ GeneticSolver::~GeneticSolver(void)
 void GeneticSolver::solve(std::vector<uint32_t>& solution,
                           uint32_t &attackCount)
 {
-    uint32_t i;
-    uint32_t j;
-    uint32_t bestFitness;
     uint32_t bestFitnessIndex;
-    bool     mated;
-    bool     mutated;
-    bool     injected;
-
-    std::vector<uint32_t> selection;
 
     /* Initializes the data */
     solution.clear();
+    attackCount            = 0;
+    this->generationCount  = 0;
+    this->publishedFitness = UINT32_MAX;
+    this->migrantsSent     = 0;
+    this->migrantsReceived = 0;
 
     /* Check parameters */
     if(this->queensCount == 0 || this->iterCount == 0)
@@ -144,32 +201,168 @@ void GeneticSolver::solve(std::vector<uint32_t>& solution,
     }
 
     /* Get cores count */
-    this->coreCount = std::thread::hardware_concurrency();
-    if(this->coreCount == 0)
-    {
-        this->coreCount = 1;
-    }
+    this->coreCount = detectCores();
 
     std::cout << "Detected " << this->coreCount << " cores." << std::endl;
 
     /* Initialize the population */
+    this->fitnessCache->clear();
     initPopulation();
 
     /* Compute the first fitness */
     computeFitness(false, false);
 
-    bestFitness      = 0;
-    bestFitnessIndex = 0;
+    /* Prepare the first immigrants while the first generations run */
+    startInjection();
+
+    /* Keep the best initial individual in case the solver is stopped before
+     * the first generation, it is also the first elite */
+    bestFitnessIndex = getBestIndex();
+    memcpy(this->elite, this->population[bestFitnessIndex],
+           this->queensCount * sizeof(uint32_t));
+    this->eliteFitness = this->populationFitness[bestFitnessIndex];
+    this->eliteHash    = this->populationHash[bestFitnessIndex];
+
+    if(this->steadyState)
+    {
+        bestFitnessIndex = solveSteadyState();
+    }
+    else
+    {
+        bestFitnessIndex = solveGenerational();
+    }
+
+    waitInjection();
+    publishElite();
+
+    std::cout << "Fitness cache: " << this->fitnessCache->getHits()
+              << " hits, " << this->fitnessCache->getMisses() << " misses"
+              << std::endl;
+    if(this->migrantExchange != nullptr)
+    {
+        std::cout << "Migrants: " << this->migrantsSent << " sent, "
+                  << this->migrantsReceived << " received" << std::endl;
+    }
+
+    /* Save the solution, its fitness is computed again in case it came from
+     * a hash collision in the cache */
+    solution.insert(solution.begin(),
+                    this->population[bestFitnessIndex],
+                    this->population[bestFitnessIndex] + this->queensCount);
+    attackCount = getAttackCount(this->population[bestFitnessIndex]);
+}
+
+void GeneticSolver::enableLocalSearch(const uint32_t budget)
+{
+    delete this->localSearchOperator;
+    this->localSearchOperator = nullptr;
+
+    if(budget != 0)
+    {
+        this->localSearchOperator =
+            new SwapLocalSearchOperator(budget, this->coreCount);
+    }
+}
+
+void GeneticSolver::enableSteadyState(const bool enable)
+{
+    this->steadyState = enable;
+}
+
+uint32_t GeneticSolver::getGenerationCount(void) const
+{
+    return this->generationCount;
+}
+
+void GeneticSolver::setMigrantExchange(MigrantExchange* exchange)
+{
+    this->migrantExchange = exchange;
+}
+
+uint32_t GeneticSolver::detectCores(void) const
+{
+    uint32_t count;
+
+    count = std::thread::hardware_concurrency();
+    if(count == 0)
+    {
+        count = 1;
+    }
+    if(this->workerLimit != 0 && this->workerLimit < count)
+    {
+        count = this->workerLimit;
+    }
+
+    return count;
+}
+
+void GeneticSolver::setWorkerCount(const uint32_t count)
+{
+    this->workerLimit = count;
+
+    this->coreCount = detectCores();
+}
+
+void GeneticSolver::enableAffinity(const bool enable)
+{
+    delete this->affinity;
+    this->affinity = nullptr;
+
+    if(enable)
+    {
+        this->affinity = new ThreadAffinity();
+    }
+}
+
+HugePageMode GeneticSolver::getHugePageBacking(void) const
+{
+    if(this->populationSize == 0)
+    {
+        return HUGE_PAGES_OFF;
+    }
+    return this->allocator->getBacking(this->population[0]);
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+uint32_t GeneticSolver::solveGenerational(void)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t bestFitness;
+    uint32_t bestFitnessIndex;
+    uint32_t worstFitnessIndex;
+    uint32_t stagnation;
+    uint32_t uniqueCount;
+    uint32_t successCount;
+    double   meanHamming;
+    double   crossoverRatio;
+    double   mutationRatio;
+    bool     mated;
+    bool     mutated;
+    bool     injected;
+
+    std::vector<uint32_t> selection;
+    std::vector<uint32_t> mutatedFitness;
+    std::vector<uint32_t> previousFitness(this->populationSize);
+
+    bestFitnessIndex = getBestIndex();
+    bestFitness      = this->populationFitness[bestFitnessIndex];
+    stagnation       = 0;
 
     std::cout << "Processing ";
     /* Generations loop */
-    for(i = 0; i < this->iterCount; ++i)
+    for(i = 0; i < this->iterCount && !isStopped(); ++i)
     {
         mated    = false;
         mutated  = false;
         injected = false;
 
-        if(tossProbability(GEN_CROSSOVER_PROBA))
+        crossoverRatio = 0;
+        mutationRatio  = 0;
+
+        if(tossProbability(this->crossoverProba))
         {
             /* Select the mating pool */
             (*this->matingPoolSelector)(this->populationFitness,
@@ -177,22 +370,38 @@ void GeneticSolver::solve(std::vector<uint32_t>& solution,
                                         this->matingPoolSize,
                                         this->matingPool);
 
-            /* Apply crossover */
+            /* Apply crossover, the children hashes are derived from their
+             * parents hashes */
             (*this->crossoverOperator)(this->queensCount,
                                        (const uint32_t**)this->population,
                                        this->populationSize,
+                                       this->populationHash,
                                        (const uint32_t*)this->matingPool,
                                        this->matingPoolSize,
-                                       this->children);
-            for(j = 0; j < this->matingPoolSize; ++j)
+                                       this->children,
+                                       this->childrenHash);
+            if(this->localSearchOperator != nullptr)
             {
-                this->childrenFitness[j] = UINT32_MAX;
+                /* Improve the children, their fitness is computed and their
+                 * hashes updated on the way */
+                (*this->localSearchOperator)(this->children,
+                                             this->matingPoolSize,
+                                             this->queensCount,
+                                             this->childrenHash,
+                                             this->childrenFitness);
+            }
+            else
+            {
+                for(j = 0; j < this->matingPoolSize; ++j)
+                {
+                    this->childrenFitness[j] = UINT32_MAX;
+                }
             }
             mated = true;
         }
 
         /* Apply mutation */
-        if(tossProbability(GEN_MUTATION_PROBA))
+        if(tossProbability(this->mutationProba))
         {
             (*this->mutationOperator)(this->population,
                                       this->populationSize,
@@ -201,20 +410,29 @@ void GeneticSolver::solve(std::vector<uint32_t>& solution,
                                       this->queensCount,
                                       selection);
 
-            /* All mutated individuals need to recompute their fitness */
+            /* All mutated individuals need to recompute their fitness, the
+             * previous one tells if the mutation succeeded */
+            mutatedFitness.resize(selection.size());
             for(j = 0; j < selection.size(); ++j)
             {
+                mutatedFitness[j] = this->populationFitness[selection[j]];
                 this->populationFitness[selection[j]] = UINT32_MAX;
             }
+            updateMutatedHashes((const uint32_t**)this->population,
+                                selection,
+                                this->populationHash);
 
             mutated = true;
         }
 
 
-        /* Apply injection */
+        /* Apply injection, the immigrants fitness is computed by the
+         * injection threads */
         if((i + 1) % GEN_INJECTION_RATE == 0)
         {
-            //injected = true;
+            waitInjection();
+            exchangeMigrants();
+            injected = true;
         }
 
         /* Compute new fitness */
@@ -222,246 +440,1116 @@ void GeneticSolver::solve(std::vector<uint32_t>& solution,
         {
             computeFitness(mated, injected);
         }
+        if(mutated && selection.size() != 0)
+        {
+            successCount = 0;
+            for(j = 0; j < selection.size(); ++j)
+            {
+                successCount += (this->populationFitness[selection[j]] <
+                                 mutatedFitness[j]);
+            }
+            mutationRatio = (double)successCount / selection.size();
+        }
 
-        /* Population selection */
+        /* Population selection, the selector only replaces individuals by
+         * strictly fitter ones: the replaced individuals are the ones whose
+         * fitness decreased. Their hash is copied with their genes */
+        memcpy(previousFitness.data(), this->populationFitness,
+               this->populationSize * sizeof(uint32_t));
         if(mated)
         {
             (*this->populationSelector)(this->population,
                                         this->populationSize,
                                         this->populationFitness,
+                                        this->populationHash,
                                         (const uint32_t**)this->children,
                                         this->matingPoolSize,
                                         (const uint32_t*)this->childrenFitness,
+                                        (const uint64_t*)this->childrenHash,
                                         this->queensCount);
+
+            /* The crossover succeeds with each child entering the
+             * population */
+            successCount = 0;
+            for(j = 0; j < this->populationSize; ++j)
+            {
+                successCount += (this->populationFitness[j] <
+                                 previousFitness[j]);
+            }
+            crossoverRatio = (double)successCount / this->matingPoolSize;
         }
         if(injected)
         {
-            (*this->populationSelector)(this->population,
-                                        this->populationSize,
-                                        this->populationFitness,
-                                        (const uint32_t**)this->injectionPool,
-                                        this->injectionPoolSize,
-                                        (const uint32_t*)this->injectionFitness,
-                                        this->queensCount);
+            (*this->populationSelector)(this->population,
+                                        this->populationSize,
+                                        this->populationFitness,
+                                        this->populationHash,
+                                        (const uint32_t**)this->injectionPool,
+                                        this->injectionPoolSize,
+                                        (const uint32_t*)this->injectionFitness,
+                                        (const uint64_t*)this->injectionHash,
+                                        this->queensCount);
+
+            /* Prepare the next immigrants */
+            startInjection();
+        }
+
+        if(this->adaptiveRates)
+        {
+            adaptRates(mated, crossoverRatio, mutated, mutationRatio);
+        }
+
+        /* Find the best solution and keep the elite in the population */
+        bestFitnessIndex = getBestIndex();
+        bestFitness      = this->populationFitness[bestFitnessIndex];
+        if(updateElite(bestFitnessIndex))
+        {
+            stagnation = 0;
+        }
+        else
+        {
+            if(bestFitness > this->eliteFitness)
+            {
+                /* The elite was lost, it replaces the worst individual */
+                worstFitnessIndex = 0;
+                for(j = 1; j < this->populationSize; ++j)
+                {
+                    if(this->populationFitness[j] >
+                       this->populationFitness[worstFitnessIndex])
+                    {
+                        worstFitnessIndex = j;
+                    }
+                }
+                memcpy(this->population[worstFitnessIndex], this->elite,
+                       this->queensCount * sizeof(uint32_t));
+                this->populationFitness[worstFitnessIndex] =
+                    this->eliteFitness;
+                this->populationHash[worstFitnessIndex] = this->eliteHash;
+                bestFitnessIndex = worstFitnessIndex;
+                bestFitness      = this->eliteFitness;
+            }
+            ++stagnation;
+        }
+
+        this->generationCount = i + 1;
+
+        computeDiversity(uniqueCount, meanHamming);
+        if(this->iterCount < 100 || i % (this->iterCount / 100) == 0)
+        {
+            std::cout << "Iteration " << i
+                    << " | Best: " << bestFitness
+                    << " | Unique: " << uniqueCount
+                    << " | Hamming: " << meanHamming;
+            if(this->adaptiveRates)
+            {
+                std::cout << " | Crossover: " << this->crossoverProba
+                          << " | Mutation: " << this->mutationProba;
+            }
+            std::cout << std::endl;
+        }
+        if(bestFitness == 0)
+        {
+            break;
+        }
+
+        /* Restart part of the population when it stagnates */
+        if(isStagnating(stagnation, uniqueCount, meanHamming))
+        {
+            std::cout << "Iteration " << i << " | Reseed" << std::endl;
+            reseedPopulation();
+            bestFitnessIndex = getBestIndex();
+            stagnation       = 0;
+            updateElite(bestFitnessIndex);
+        }
+    }
+    std::cout << std::endl;
+
+    return bestFitnessIndex;
+}
+
+uint32_t GeneticSolver::solveSteadyState(void)
+{
+    uint64_t i;
+    uint64_t stepCount;
+    uint32_t bestIndex;
+    uint32_t generationSteps;
+    uint32_t stagnation;
+    uint32_t uniqueCount;
+    uint32_t replacedCount;
+    uint32_t parents[2];
+    uint32_t pairSuccess[2];
+    uint32_t pairCount[2];
+    double   meanHamming;
+    bool     improved;
+    bool     mutated;
+
+    std::vector<uint32_t> selection;
+
+    FitnessHeap heap(this->populationSize);
+
+    /* One generation is worth matingPoolSize children */
+    generationSteps = this->matingPoolSize / 2;
+    if(generationSteps == 0)
+    {
+        generationSteps = 1;
+    }
+    stepCount  = (uint64_t)this->iterCount * generationSteps;
+    bestIndex  = getBestIndex();
+    stagnation = 0;
+
+    pairSuccess[0] = 0;
+    pairSuccess[1] = 0;
+    pairCount[0]   = 0;
+    pairCount[1]   = 0;
+
+    heap.build(this->populationFitness, this->populationSize);
+
+    std::cout << "Processing ";
+    for(i = 0;
+        i < stepCount &&
+        this->populationFitness[bestIndex] != 0 &&
+        !isStopped();
+        ++i)
+    {
+        improved = false;
+
+        /* Breed one pair */
+        if(this->populationSize >= 2)
+        {
+            (*this->matingPoolSelector)(this->populationFitness,
+                                        this->populationSize,
+                                        2,
+                                        parents);
+            (*this->crossoverOperator)(this->queensCount,
+                                       (const uint32_t**)this->population,
+                                       this->populationSize,
+                                       this->populationHash,
+                                       parents,
+                                       2,
+                                       this->children,
+                                       this->childrenHash);
+            this->childrenFitness[0] = UINT32_MAX;
+            this->childrenFitness[1] = UINT32_MAX;
+
+            mutated = tossProbability(this->mutationProba);
+            if(mutated)
+            {
+                (*this->mutationOperator)(this->children,
+                                          2,
+                                          2,
+                                          this->childrenFitness,
+                                          this->queensCount,
+                                          selection);
+                updateMutatedHashes((const uint32_t**)this->children,
+                                    selection,
+                                    this->childrenHash);
+            }
+
+            /* Evaluate both children at once */
+            if(this->localSearchOperator != nullptr)
+            {
+                (*this->localSearchOperator)(this->children,
+                                             2,
+                                             this->queensCount,
+                                             this->childrenHash,
+                                             this->childrenFitness);
+            }
+            else
+            {
+                evaluateIndividuals((const uint32_t**)this->children, 2,
+                                    this->childrenHash,
+                                    this->childrenFitness);
+            }
+
+            improved = replaceWorst(heap, (const uint32_t**)this->children,
+                                    this->childrenFitness, this->childrenHash,
+                                    2, bestIndex, replacedCount);
+
+            /* Every pair is mated, a pair succeeds with each child entering
+             * the population: the mutated pairs credit the mutation, the
+             * others the crossover */
+            pairSuccess[mutated] += replacedCount;
+            pairCount[mutated]   += 2;
+        }
+
+        /* Merge the immigrants every GEN_INJECTION_RATE generations */
+        if((i + 1) % ((uint64_t)GEN_INJECTION_RATE * generationSteps) == 0)
+        {
+            waitInjection();
+            exchangeMigrants();
+            improved |= replaceWorst(heap,
+                                     (const uint32_t**)this->injectionPool,
+                                     this->injectionFitness,
+                                     this->injectionHash,
+                                     this->injectionPoolSize,
+                                     bestIndex,
+                                     replacedCount);
+            startInjection();
+        }
+
+        if(improved)
+        {
+            stagnation = 0;
+            std::cout << "Iteration " << i / generationSteps
+                      << " | Best: " << this->populationFitness[bestIndex]
+                      << std::endl;
+        }
+        else
+        {
+            ++stagnation;
+        }
+
+        /* Adapt the rates and check the diversity once per generation */
+        if((i + 1) % generationSteps == 0)
+        {
+            if(this->adaptiveRates)
+            {
+                adaptRates(pairCount[0] != 0,
+                           (pairCount[0] != 0) ?
+                           (double)pairSuccess[0] / pairCount[0] : 0,
+                           pairCount[1] != 0,
+                           (pairCount[1] != 0) ?
+                           (double)pairSuccess[1] / pairCount[1] : 0);
+                pairSuccess[0] = 0;
+                pairSuccess[1] = 0;
+                pairCount[0]   = 0;
+                pairCount[1]   = 0;
+            }
+
+            computeDiversity(uniqueCount, meanHamming);
+            if(isStagnating(stagnation / generationSteps,
+                            uniqueCount, meanHamming))
+            {
+                std::cout << "Iteration " << i / generationSteps
+                          << " | Reseed" << std::endl;
+                reseedPopulation();
+                heap.build(this->populationFitness, this->populationSize);
+                bestIndex  = getBestIndex();
+                stagnation = 0;
+
+                /* A reseeded individual can beat the elite */
+                updateElite(bestIndex);
+            }
+        }
+    }
+    std::cout << std::endl;
+
+    this->generationCount = (i + generationSteps - 1) / generationSteps;
+
+    return bestIndex;
+}
+
+bool GeneticSolver::replaceWorst(FitnessHeap&     heap,
+                                 const uint32_t** candidates,
+                                 const uint32_t*  candidatesFitness,
+                                 const uint64_t*  candidatesHash,
+                                 const uint32_t   candidatesCount,
+                                 uint32_t&        bestIndex,
+                                 uint32_t&        replacedCount)
+{
+    uint32_t i;
+    uint32_t worst;
+    bool     improved;
+
+    improved      = false;
+    replacedCount = 0;
+    for(i = 0; i < candidatesCount; ++i)
+    {
+        worst = heap.top();
+        if(candidatesFitness[i] < this->populationFitness[worst])
+        {
+            memcpy(this->population[worst], candidates[i],
+                   this->queensCount * sizeof(uint32_t));
+            this->populationFitness[worst] = candidatesFitness[i];
+            this->populationHash[worst]    = candidatesHash[i];
+            heap.update(worst, candidatesFitness[i]);
+            ++replacedCount;
+
+            if(candidatesFitness[i] < this->populationFitness[bestIndex])
+            {
+                bestIndex = worst;
+                improved  = true;
+
+                /* Keep the elite published to the other processes */
+                updateElite(worst);
+            }
+        }
+    }
+
+    return improved;
+}
+
+bool GeneticSolver::isStagnating(const uint32_t stagnation,
+                                 const uint32_t uniqueCount,
+                                 const double   meanHamming) const
+{
+    /* Restart part of the population when the best individual stopped
+     * improving, sooner if the population collapsed */
+    return stagnation >= GEN_STAGNATION_LIMIT ||
+           (stagnation >= GEN_STAGNATION_LIMIT / 4 &&
+            (uniqueCount < this->populationSize * GEN_MIN_UNIQUE_RATIO ||
+             meanHamming < GEN_MIN_HAMMING));
+}
+
+uint32_t
+GeneticSolver::getAttackCount(const uint32_t* solution) const
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t attackCount;
+
+    attackCount = 0;
+    for(i = 0; i < this->queensCount; ++i)
+    {
+        for(j = i + 1; j < this->queensCount; ++j)
+        {
+            /* Check same lines, first diagonal and second diagonal */
+            if(solution[i] == solution[j] ||
+               (j - i) == abs(solution[i] - solution[j]))
+            {
+                ++attackCount;
+            }
+        }
+    }
+
+    return attackCount;
+}
+
+void GeneticSolver::initPopulation(void)
+{
+    uint32_t i;
+    uint32_t blockSize;
+
+    std::vector<std::thread> threads;
+
+    if(this->coreCount == 1)
+    {
+        initPopulationThread(0, 0, this->populationSize, this->generator());
+        return;
+    }
+
+    /* Same blocks as the fitness computation */
+    blockSize = this->populationSize / this->coreCount;
+    if(this->populationSize % this->coreCount != 0)
+    {
+        ++blockSize;
+    }
+
+    for(i = 0;
+        i < this->coreCount && i * blockSize < this->populationSize;
+        ++i)
+    {
+        threads.push_back(std::thread(&GeneticSolver::initPopulationThread,
+                                      this,
+                                      i,
+                                      i * blockSize,
+                                      std::min((i + 1) * blockSize,
+                                               this->populationSize),
+                                      (uint32_t)this->generator()));
+    }
+    for(i = 0; i < threads.size(); ++i)
+    {
+        threads[i].join();
+    }
+}
+
+void GeneticSolver::initPopulationThread(const uint32_t worker,
+                                         const uint32_t start,
+                                         const uint32_t end,
+                                         const uint32_t seed)
+{
+    uint32_t  i;
+    uint32_t  j;
+    uint32_t  index;
+    uint32_t* individual;
+
+    std::mt19937 generator(seed);
+
+    pinWorker(worker);
+
+    /* For each individual, generate a random permutation: one queen per line
+     * is only usefull when using crossover and mutations operators that keep
+     * the number of queens on one line contant */
+    for(i = start; i < end; ++i)
+    {
+        individual = this->population[i];
+        for(j = 0; j < this->queensCount; ++j)
+        {
+            individual[j] = j;
+        }
+        for(j = this->queensCount; j > 1; --j)
+        {
+            index = std::uniform_int_distribution<uint32_t>(0, j - 1)(
+                                                                generator);
+            std::swap(individual[j - 1], individual[index]);
+        }
+
+        /* Init fitness */
+        this->populationFitness[i] = UINT32_MAX;
+        this->populationHash[i]    = FitnessCache::getHash(individual,
+                                                           this->queensCount);
+    }
+}
+
+void GeneticSolver::pinWorker(const uint32_t worker) const
+{
+    if(this->affinity != nullptr)
+    {
+        this->affinity->pin(worker);
+    }
+}
+
+uint32_t** GeneticSolver::allocateIndividuals(const uint32_t count)
+{
+    uint32_t   i;
+    uint32_t*  buffer;
+    uint32_t** individuals;
+
+    individuals = new uint32_t*[count];
+    buffer      = (uint32_t*)this->allocator->allocate(
+                                (size_t)count * this->queensCount *
+                                sizeof(uint32_t));
+    for(i = 0; i < count; ++i)
+    {
+        individuals[i] = buffer + (size_t)i * this->queensCount;
+    }
+
+    return individuals;
+}
+
+void GeneticSolver::computeFitnessThread(const uint32_t index,
+                                         const uint32_t blockSize,
+                                         const uint32_t** population,
+                                         const uint32_t popSize,
+                                         const uint64_t* popHash,
+                                         uint32_t* popFitness)
+{
+    uint32_t i;
+    uint32_t lastItem;
+    uint64_t hits;
+    uint64_t misses;
+
+    pinWorker(index / blockSize);
+
+    lastItem = index + blockSize;
+    if(lastItem > popSize)
+    {
+        lastItem = popSize;
+    }
+
+    hits   = 0;
+    misses = 0;
+    for(i = index; i < lastItem; ++i)
+    {
+        /* If the fitness is UINT32_MAX, we need to compute it, unless the
+         * individual was already evaluated */
+        if(popFitness[i] == UINT32_MAX)
+        {
+            if(this->fitnessCache->lookup(popHash[i], popFitness[i]))
+            {
+                ++hits;
+            }
+            else
+            {
+                popFitness[i] = getAttackCount(population[i]);
+                this->fitnessCache->store(popHash[i], popFitness[i]);
+                ++misses;
+            }
+        }
+    }
+
+    /* Tally once per thread to avoid contention on the counters */
+    this->fitnessCache->addStats(hits, misses);
+}
+
+void GeneticSolver::updateMutatedHashes(const uint32_t**             individuals,
+                                        const std::vector<uint32_t>& selection,
+                                        uint64_t*                    hashes)
+{
+    uint32_t i;
+    uint32_t geneA;
+    uint32_t geneB;
+    uint32_t index;
+
+    for(i = 0; i < selection.size(); ++i)
+    {
+        index = selection[i];
+        if(this->mutationOperator->getSwappedGenes(i, geneA, geneB))
+        {
+            /* The swap is symmetric, the lines after the swap can be used */
+            hashes[index] = FitnessCache::swapHash(hashes[index],
+                                                   geneA,
+                                                   individuals[index][geneA],
+                                                   geneB,
+                                                   individuals[index][geneB]);
+        }
+        else
+        {
+            hashes[index] = FitnessCache::getHash(individuals[index],
+                                                  this->queensCount);
+        }
+    }
+}
+
+void GeneticSolver::computeFitness(const bool computeChildren,
+                                   const bool computeInjectionPool)
+{
+    /* Compute the population fitness */
+    evaluateIndividuals((const uint32_t**)this->population,
+                        this->populationSize,
+                        this->populationHash,
+                        this->populationFitness);
+
+    /* If we need to compute children fitness */
+    if(computeChildren)
+    {
+        evaluateIndividuals((const uint32_t**)this->children,
+                            this->matingPoolSize,
+                            this->childrenHash,
+                            this->childrenFitness);
+    }
+
+    /* If we need to compute the inject pool fitness */
+    if(computeInjectionPool)
+    {
+        evaluateIndividuals((const uint32_t**)this->injectionPool,
+                            this->injectionPoolSize,
+                            this->injectionHash,
+                            this->injectionFitness);
+    }
+}
+
+void GeneticSolver::evaluateIndividuals(const uint32_t** individuals,
+                                        const uint32_t   count,
+                                        const uint64_t*  hashes,
+                                        uint32_t*        fitness)
+{
+    uint32_t i;
+    uint32_t blockSize;
+    uint32_t dirtyCount;
+    uint64_t hits;
+    uint64_t misses;
+
+    std::vector<std::thread> threads;
+
+    dirtyCount = 0;
+    for(i = 0; i < count; ++i)
+    {
+        if(fitness[i] == UINT32_MAX)
+        {
+            ++dirtyCount;
+        }
+    }
+    if(dirtyCount == 0)
+    {
+        return;
+    }
+
+    /* Few large individuals: split each individual across the cores */
+    if(dirtyCount < this->coreCount &&
+       this->queensCount >= GEN_SPLIT_MIN_QUEENS)
+    {
+        hits   = 0;
+        misses = 0;
+        for(i = 0; i < count; ++i)
+        {
+            if(fitness[i] != UINT32_MAX)
+            {
+                continue;
+            }
+            if(this->fitnessCache->lookup(hashes[i], fitness[i]))
+            {
+                ++hits;
+            }
+            else
+            {
+                fitness[i] = getSplitAttackCount(individuals[i],
+                                                 this->coreCount);
+                this->fitnessCache->store(hashes[i], fitness[i]);
+                ++misses;
+            }
+        }
+        this->fitnessCache->addStats(hits, misses);
+        return;
+    }
+
+    if(this->coreCount == 1)
+    {
+        computeFitnessThread(0, count, individuals, count, hashes, fitness);
+        return;
+    }
+
+    /* Compute the number of parallel blocks */
+    blockSize = count / this->coreCount;
+    if(count % this->coreCount != 0)
+    {
+        ++blockSize;
+    }
+
+    for(i = 0; i < this->coreCount && i * blockSize < count; ++i)
+    {
+        threads.push_back(std::thread(&GeneticSolver::computeFitnessThread,
+                                      this,
+                                      i * blockSize,
+                                      blockSize,
+                                      individuals,
+                                      count,
+                                      hashes,
+                                      fitness));
+    }
+    for(i = 0; i < threads.size(); ++i)
+    {
+        threads[i].join();
+    }
+}
+
+uint32_t GeneticSolver::getSplitAttackCount(const uint32_t* individual,
+                                            const uint32_t  threadCount)
+{
+    uint32_t i;
+    uint32_t blockSize;
+    uint32_t counterSize;
+    uint64_t attacks;
+
+    std::vector<std::thread> threads;
+    std::vector<uint64_t>    partialAttacks(threadCount, 0);
+
+    /* Count the queens of each block of columns on the shared diagonal
+     * counters */
+    blockSize = this->queensCount / threadCount;
+    if(this->queensCount % threadCount != 0)
+    {
+        ++blockSize;
+    }
+    for(i = 0; i < threadCount; ++i)
+    {
+        threads.push_back(std::thread(&GeneticSolver::splitCountThread,
+                                      this,
+                                      individual,
+                                      std::min(i * blockSize,
+                                               this->queensCount),
+                                      std::min((i + 1) * blockSize,
+                                               this->queensCount)));
+    }
+    for(i = 0; i < threadCount; ++i)
+    {
+        threads[i].join();
+    }
+    threads.clear();
+
+    /* Reduce and clear the counters by ranges */
+    counterSize = 4 * this->queensCount - 2;
+    blockSize   = counterSize / threadCount;
+    if(counterSize % threadCount != 0)
+    {
+        ++blockSize;
+    }
+    for(i = 0; i < threadCount; ++i)
+    {
+        threads.push_back(std::thread(&GeneticSolver::splitReduceThread,
+                                      this,
+                                      std::min(i * blockSize, counterSize),
+                                      std::min((i + 1) * blockSize,
+                                               counterSize),
+                                      &partialAttacks[i]));
+    }
+    attacks = 0;
+    for(i = 0; i < threadCount; ++i)
+    {
+        threads[i].join();
+        attacks += partialAttacks[i];
+    }
+
+    return attacks;
+}
+
+void GeneticSolver::splitCountThread(const uint32_t* individual,
+                                     const uint32_t  start,
+                                     const uint32_t  end)
+{
+    uint32_t i;
+
+    std::atomic<uint32_t>* diagUp;
+    std::atomic<uint32_t>* diagDown;
+
+    diagUp   = this->splitDiagonals;
+    diagDown = diagUp + 2 * this->queensCount - 1;
+
+    /* The individuals are permutations, the lines hold one queen each */
+    for(i = start; i < end; ++i)
+    {
+        diagUp[i + individual[i]].fetch_add(1, std::memory_order_relaxed);
+        diagDown[i + this->queensCount - 1 - individual[i]].fetch_add(
+                                                1, std::memory_order_relaxed);
+    }
+}
+
+void GeneticSolver::splitReduceThread(const uint32_t start,
+                                      const uint32_t end,
+                                      uint64_t*      attacks)
+{
+    uint32_t i;
+    uint64_t count;
+    uint64_t total;
+
+    total = 0;
+    for(i = start; i < end; ++i)
+    {
+        /* Leave the counters cleared for the next individual */
+        count = this->splitDiagonals[i].exchange(0, std::memory_order_relaxed);
+        if(count > 1)
+        {
+            total += count * (count - 1) / 2;
+        }
+    }
+    *attacks = total;
+}
+
+void GeneticSolver::startInjection(void)
+{
+    uint32_t i;
+    uint32_t blockSize;
+    uint32_t threadCount;
+
+    waitInjection();
+
+    threadCount = this->coreCount;
+    if(threadCount > this->injectionPoolSize)
+    {
+        threadCount = this->injectionPoolSize;
+    }
+    if(threadCount == 0)
+    {
+        return;
+    }
+
+    /* Compute the number of parallel blocks */
+    blockSize = this->injectionPoolSize / threadCount;
+    if(this->injectionPoolSize % threadCount != 0)
+    {
+        ++blockSize;
+    }
+
+    for(i = 0; i < threadCount && i * blockSize < this->injectionPoolSize; ++i)
+    {
+        this->injectionThreads.push_back(
+            std::thread(&GeneticSolver::immigrantThread,
+                        this,
+                        this->injectionPool,
+                        this->injectionFitness,
+                        this->injectionHash,
+                        i * blockSize,
+                        std::min((i + 1) * blockSize, this->injectionPoolSize),
+                        (uint32_t)this->generator()));
+    }
+}
+
+void GeneticSolver::waitInjection(void)
+{
+    uint32_t i;
+
+    for(i = 0; i < this->injectionThreads.size(); ++i)
+    {
+        this->injectionThreads[i].join();
+    }
+    this->injectionThreads.clear();
+}
+
+bool GeneticSolver::updateElite(const uint32_t index)
+{
+    if(this->populationFitness[index] >= this->eliteFitness)
+    {
+        return false;
+    }
+
+    memcpy(this->elite, this->population[index],
+           this->queensCount * sizeof(uint32_t));
+    this->eliteFitness = this->populationFitness[index];
+    this->eliteHash    = this->populationHash[index];
+
+    return true;
+}
+
+void GeneticSolver::publishElite(void)
+{
+    if(this->migrantExchange != nullptr &&
+       this->eliteFitness < this->publishedFitness &&
+       this->migrantExchange->publish(this->elite, this->eliteFitness))
+    {
+        this->publishedFitness = this->eliteFitness;
+        ++this->migrantsSent;
+    }
+}
+
+void GeneticSolver::exchangeMigrants(void)
+{
+    uint32_t i;
+    uint32_t count;
+
+    if(this->migrantExchange == nullptr)
+    {
+        return;
+    }
+
+    publishElite();
+
+    /* The migrants replace the first immigrants, their fitness comes from
+     * another process and is not trusted */
+    count = this->migrantExchange->consume(this->injectionPool,
+                                           this->injectionFitness,
+                                           this->injectionPoolSize);
+    for(i = 0; i < count; ++i)
+    {
+        this->injectionFitness[i] = UINT32_MAX;
+        this->injectionHash[i]    =
+            FitnessCache::getHash(this->injectionPool[i], this->queensCount);
+    }
+    evaluateIndividuals((const uint32_t**)this->injectionPool, count,
+                        this->injectionHash, this->injectionFitness);
+
+    this->migrantsReceived += count;
+}
+
+void GeneticSolver::immigrantThread(uint32_t**     individuals,
+                                    uint32_t*      fitness,
+                                    uint64_t*      hashes,
+                                    const uint32_t start,
+                                    const uint32_t end,
+                                    const uint32_t seed)
+{
+    uint32_t  i;
+    uint32_t  j;
+    uint32_t  k;
+    uint32_t  tries;
+    uint32_t  index;
+    uint32_t  line;
+    uint32_t  shift;
+    uint32_t  remaining;
+    uint32_t* individual;
+    int64_t   attacks;
+
+    std::vector<uint32_t> freeLines(this->queensCount);
+    std::vector<uint32_t> diagUp(2 * this->queensCount);
+    std::vector<uint32_t> diagDown(2 * this->queensCount);
+
+    std::mt19937 generator(seed);
+
+    shift = this->queensCount - 1;
+    for(i = start; i < end; ++i)
+    {
+        individual = individuals[i];
+        tries      = (i % 2 == 0) ? 1 : GEN_INJECTION_TRIES;
+
+        for(j = 0; j < this->queensCount; ++j)
+        {
+            freeLines[j] = j;
         }
+        std::fill(diagUp.begin(), diagUp.end(), 0);
+        std::fill(diagDown.begin(), diagDown.end(), 0);
 
-        /* Find the best solution */
-        bestFitness      = this->populationFitness[0];
-        bestFitnessIndex = 0;
-        for(j = 1; j < this->populationSize; ++j)
+        /* Draw the line of each column in the remaining lines */
+        remaining = this->queensCount;
+        for(j = 0; j < this->queensCount; ++j)
         {
-            if(this->populationFitness[j] < bestFitness)
+            index = 0;
+            for(k = 0; k < tries; ++k)
             {
-                bestFitness      = this->populationFitness[j];
-                bestFitnessIndex = j;
+                index = generator() % remaining;
+                line  = freeLines[index];
+                if(diagUp[j + line] == 0 && diagDown[j + shift - line] == 0)
+                {
+                    break;
+                }
             }
+
+            line          = freeLines[index];
+            individual[j] = line;
+            ++diagUp[j + line];
+            ++diagDown[j + shift - line];
+
+            freeLines[index] = freeLines[--remaining];
         }
-        if(i  % (this->iterCount / 100) == 0)
-        {
-            std::cout << "Iteration " << i
-                    << " | Best: " << bestFitness << std::endl;
-        }
-        if(bestFitness == 0)
+
+        /* Lines are unique, only the diagonals hold attacks */
+        attacks = 0;
+        for(j = 0; j < 2 * this->queensCount; ++j)
         {
-            break;
+            attacks += (int64_t)diagUp[j] * ((int64_t)diagUp[j] - 1) / 2;
+            attacks += (int64_t)diagDown[j] * ((int64_t)diagDown[j] - 1) / 2;
         }
+        fitness[i] = attacks;
+        hashes[i]  = FitnessCache::getHash(individual, this->queensCount);
     }
-    std::cout << std::endl;
-
-    /* Save the solution */
-    solution.insert(solution.begin(),
-                    this->population[bestFitnessIndex],
-                    this->population[bestFitnessIndex] + this->queensCount);
-    attackCount = bestFitness;
 }
 
-/*******************************************************************************
- * Private methods
- ******************************************************************************/
-uint32_t
-GeneticSolver::getAttackCount(const uint32_t* solution) const
+void GeneticSolver::adaptRates(const bool   mated,
+                               const double crossoverRatio,
+                               const bool   mutated,
+                               const double mutationRatio)
 {
-    uint32_t i;
-    uint32_t j;
-    uint32_t attackCount;
+    double total;
 
-    attackCount = 0;
-    for(i = 0; i < this->queensCount; ++i)
+    if(mated)
     {
-        for(j = i + 1; j < this->queensCount; ++j)
-        {
-            /* Check same lines, first diagonal and second diagonal */
-            if(solution[i] == solution[j] ||
-               (j - i) == abs(solution[i] - solution[j]))
-            {
-                ++attackCount;
-            }
-        }
+        this->crossoverSuccess += GEN_ADAPT_RATE *
+                                  (crossoverRatio - this->crossoverSuccess);
+    }
+    if(mutated)
+    {
+        this->mutationSuccess += GEN_ADAPT_RATE *
+                                 (mutationRatio - this->mutationSuccess);
     }
 
-    return attackCount;
+    total = this->crossoverSuccess + this->mutationSuccess;
+    if(total <= 0)
+    {
+        return;
+    }
+
+    /* Probability matching: each operator moves toward its share of the
+     * recent successes */
+    this->crossoverProba += GEN_ADAPT_RATE *
+        (GEN_ADAPT_MIN_PROBA +
+         (GEN_ADAPT_MAX_PROBA - GEN_ADAPT_MIN_PROBA) *
+         this->crossoverSuccess / total - this->crossoverProba);
+    this->mutationProba += GEN_ADAPT_RATE *
+        (GEN_ADAPT_MIN_PROBA +
+         (GEN_ADAPT_MAX_PROBA - GEN_ADAPT_MIN_PROBA) *
+         this->mutationSuccess / total - this->mutationProba);
 }
 
-void GeneticSolver::initPopulation(void)
+uint32_t GeneticSolver::getBestIndex(void) const
 {
     uint32_t i;
-    uint32_t j;
-    uint32_t index;
-
-    uint32_t* individual;
-
-    std::set<uint32_t> possiblePos;
-    std::set<uint32_t> currentPossiblePos;
-
-    std::uniform_int_distribution<uint32_t> randGen;
-
-    /* Init the possible position set */
-    for(i = 0; i < this->queensCount; ++i)
-    {
-        possiblePos.insert(i);
-    }
+    uint32_t bestIndex;
 
-    /* For each individual, generate random positions */
-    for(i = 0; i < this->populationSize; ++i)
+    bestIndex = 0;
+    for(i = 1; i < this->populationSize; ++i)
     {
-        currentPossiblePos = std::set<uint32_t> (possiblePos);
-        individual = this->population[i];
-
-        /* With the set of possible position, we avoid multiple queens on the
-         * same line
-         * This is only usefull when using crossover and mutations operators
-         * that keep the number of queens on one line contant.
-         */
-        for(j = 0; j < this->queensCount; ++j)
+        if(this->populationFitness[i] < this->populationFitness[bestIndex])
         {
-            randGen =
-            std::uniform_int_distribution<uint32_t>(0,
-                                                currentPossiblePos.size() - 1);
-            std::set<uint32_t>::const_iterator it(currentPossiblePos.begin());
-            index = randGen(this->generator);
-            std::advance(it, index);
-            individual[j] = *it;
-            currentPossiblePos.erase(it);
+            bestIndex = i;
         }
-
-        /* Init fitness */
-        this->populationFitness[i] = UINT32_MAX;
     }
+
+    return bestIndex;
 }
 
-void GeneticSolver::computeFitnessThread(const uint32_t index,
-                                         const uint32_t blockSize,
-                                         const uint32_t** population,
-                                         const uint32_t popSize,
-                                         uint32_t* popFitness)
+void GeneticSolver::computeDiversity(uint32_t& uniqueCount,
+                                     double& meanHamming)
 {
     uint32_t i;
-    uint32_t lastItem;
+    uint32_t j;
+    uint32_t first;
+    uint32_t second;
+    uint32_t column;
+    uint32_t columns;
+    uint64_t differences;
 
-    lastItem = index + blockSize;
-    if(lastItem > popSize)
+    std::vector<uint64_t> hashes(this->populationSize);
+
+    /* Unique genotypes */
+    for(i = 0; i < this->populationSize; ++i)
     {
-        lastItem = popSize;
+        hashes[i] = this->populationHash[i];
     }
+    std::sort(hashes.begin(), hashes.end());
+    uniqueCount = std::unique(hashes.begin(), hashes.end()) - hashes.begin();
 
-    for(i = index; i < lastItem; ++i)
+    /* Mean Hamming distance on sampled pairs and columns */
+    meanHamming = 0;
+    if(this->populationSize < 2 || this->queensCount == 0)
     {
-        /* If the fitness is UINT32_MAX, we need to compute it */
-        if(popFitness[i] == UINT32_MAX)
+        return;
+    }
+    columns = std::min((uint32_t)GEN_HAMMING_COLUMNS, this->queensCount);
+    std::uniform_int_distribution<uint32_t> randIndiv(0,
+                                                    this->populationSize - 1);
+    std::uniform_int_distribution<uint32_t> randColumn(0,
+                                                    this->queensCount - 1);
+    differences = 0;
+    for(i = 0; i < GEN_HAMMING_PAIRS; ++i)
+    {
+        first  = randIndiv(this->generator);
+        second = randIndiv(this->generator);
+        if(first == second)
+        {
+            second = (second + 1) % this->populationSize;
+        }
+        for(j = 0; j < columns; ++j)
         {
-            popFitness[i] = getAttackCount(population[i]);
+            column = randColumn(this->generator);
+            differences += (this->population[first][column] !=
+                            this->population[second][column]);
         }
     }
+    meanHamming = (double)differences / (GEN_HAMMING_PAIRS * columns);
 }
 
-void GeneticSolver::computeFitness(const bool computeChildren,
-                                   const bool computeInjectionPool)
+void GeneticSolver::reseedPopulation(void)
 {
     uint32_t i;
     uint32_t blockSize;
+    uint32_t threadCount;
+    uint32_t reseedCount;
 
+    std::vector<std::pair<uint32_t, uint32_t>> fitIndex;
+    std::vector<uint32_t*>   targets;
+    std::vector<uint32_t>    targetFitness;
+    std::vector<uint64_t>    targetHash;
     std::vector<std::thread> threads;
 
-    /* Compute the number of parallel blocks */
-    blockSize  = this->populationSize / this->coreCount;
-    if(this->populationSize % this->coreCount != 0)
+    /* Select the worst individuals, the fittest is always kept */
+    reseedCount = this->populationSize * GEN_RESEED_RATIO;
+    if(reseedCount >= this->populationSize)
     {
-        ++blockSize;
+        reseedCount = this->populationSize - 1;
     }
-
-    /* Compute the population fitness */
-    for(i = 0; i < this->coreCount; ++i)
+    if(reseedCount == 0)
     {
-        threads.push_back(std::thread(&GeneticSolver::computeFitnessThread,
-                                      this,
-                                      i * blockSize,
-                                      blockSize,
-                                      (const uint32_t**)this->population,
-                                      this->populationSize,
-                                      this->populationFitness));
+        return;
     }
-    for(i = 0; i < this->coreCount; ++i)
+    for(i = 0; i < this->populationSize; ++i)
     {
-        threads[i].join();
+        fitIndex.push_back(std::make_pair(this->populationFitness[i], i));
     }
-#if 0
-    for(i = 0; i < this->populationSize; ++i)
+    std::sort(fitIndex.begin(), fitIndex.end(),
+              std::greater<std::pair<uint32_t, uint32_t>>());
+    for(i = 0; i < reseedCount; ++i)
     {
-        /* If the fitness is UINT32_MAX, we need to compute it */
-        if(this->populationFitness[i] == UINT32_MAX)
-        {
-            this->populationFitness[i] = getAttackCount(this->population[i]);
-        }
+        targets.push_back(this->population[fitIndex[i].second]);
     }
-#endif
-    /* If we need to compute children fitness */
-    if(computeChildren)
+    targetFitness = std::vector<uint32_t>(reseedCount);
+    targetHash    = std::vector<uint64_t>(reseedCount);
+
+    /* Generate the new individuals in parallel */
+    threadCount = std::min(this->coreCount, reseedCount);
+    blockSize   = reseedCount / threadCount;
+    if(reseedCount % threadCount != 0)
     {
-        threads.clear();
-        /* Compute the number of parallel blocks */
-        blockSize  = this->matingPoolSize / this->coreCount;
-        if(this->matingPoolSize % this->coreCount != 0)
-        {
-            ++blockSize;
-        }
-        for(i = 0; i < this->coreCount; ++i)
-        {
-            threads.push_back(std::thread(&GeneticSolver::computeFitnessThread,
-                                        this,
-                                        i * blockSize,
-                                        blockSize,
-                                        (const uint32_t**)this->children,
-                                        this->matingPoolSize,
-                                        this->childrenFitness));
-        }
-        for(i = 0; i < this->coreCount; ++i)
-        {
-            threads[i].join();
-        }
-#if 0
-        for(i = 0; i < this->matingPoolSize; ++i)
-        {
-            /* If the fitness is UINT32_MAX, we need to compute it */
-            if(this->childrenFitness[i] == UINT32_MAX)
-            {
-                this->childrenFitness[i] = getAttackCount(this->children[i]);
-            }
-        }
-#endif
+        ++blockSize;
+    }
+    for(i = 0; i < threadCount && i * blockSize < reseedCount; ++i)
+    {
+        threads.push_back(std::thread(&GeneticSolver::immigrantThread,
+                                      this,
+                                      targets.data(),
+                                      targetFitness.data(),
+                                      targetHash.data(),
+                                      i * blockSize,
+                                      std::min((i + 1) * blockSize,
+                                               reseedCount),
+                                      (uint32_t)this->generator()));
+    }
+    for(i = 0; i < threads.size(); ++i)
+    {
+        threads[i].join();
     }
 
-    /* If we need to compute the inject pool fitness */
-    if(computeInjectionPool)
+    for(i = 0; i < reseedCount; ++i)
     {
-        for(i = 0; i < this->injectionPoolSize; ++i)
-        {
-            /* If the fitness is UINT32_MAX, we need to compute it */
-            if(this->injectionFitness[i] == UINT32_MAX)
-            {
-                this->injectionFitness[i] =
-                    getAttackCount(this->injectionPool[i]);
-            }
-        }
+        this->populationFitness[fitIndex[i].second] = targetFitness[i];
+        this->populationHash[fitIndex[i].second]    = targetHash[i];
     }
 }
 
@@ -581,17 +1669,19 @@ void GeneticSolver::testComputeFitness(void)
 
     computeFitness(false, false);
 
-    memcpy(this->children, this->population,
-           sizeof(uint32_t*) * this->matingPoolSize);
     for(i = 0; i < this->matingPoolSize; ++i)
     {
+        memcpy(this->children[i], this->population[i],
+               sizeof(uint32_t) * this->queensCount);
         this->childrenFitness[i] = UINT32_MAX;
+        this->childrenHash[i]    = this->populationHash[i];
     }
-    memcpy(this->injectionPool, this->population,
-           sizeof(uint32_t*) * this->injectionPoolSize);
     for(i = 0; i < this->injectionPoolSize; ++i)
     {
+        memcpy(this->injectionPool[i], this->population[i],
+               sizeof(uint32_t) * this->queensCount);
         this->injectionFitness[i] = UINT32_MAX;
+        this->injectionHash[i]    = this->populationHash[i];
     }
 
 
@@ -678,6 +1768,267 @@ void GeneticSolver::testComputeFitness(void)
     }
 }
 
+void GeneticSolver::testInjection(void)
+{
+    uint32_t i;
+    uint32_t j;
+    std::vector<bool> used;
+
+    startInjection();
+    waitInjection();
+
+    for(i = 0; i < this->injectionPoolSize; ++i)
+    {
+        used = std::vector<bool>(this->queensCount, false);
+        for(j = 0; j < this->queensCount; ++j)
+        {
+            if(this->injectionPool[i][j] >= this->queensCount ||
+               used[this->injectionPool[i][j]])
+            {
+                throw std::runtime_error(
+                    std::string("Erroneous position found in immigrant"));
+            }
+            used[this->injectionPool[i][j]] = true;
+        }
+        if(this->injectionFitness[i] != getAttackCount(this->injectionPool[i]))
+        {
+            throw std::runtime_error("Wrong immigrant fitness: " +
+                        std::to_string(this->injectionFitness[i]) + ":" +
+                        std::to_string(getAttackCount(this->injectionPool[i])));
+        }
+    }
+}
+
+void GeneticSolver::testDiversity(void)
+{
+    uint32_t i;
+    uint32_t uniqueCount;
+    uint32_t bestIndex;
+    uint32_t bestFitness;
+    double   meanHamming;
+    std::vector<uint32_t> best;
+
+    initPopulation();
+    computeFitness(false, false);
+
+    /* Random permutations are all different */
+    computeDiversity(uniqueCount, meanHamming);
+    if(uniqueCount != this->populationSize || meanHamming < 0.5)
+    {
+        throw std::runtime_error("Wrong initial diversity: " +
+                                 std::to_string(uniqueCount) + ":" +
+                                 std::to_string(meanHamming));
+    }
+
+    /* Collapse the population on its best individual */
+    bestIndex   = getBestIndex();
+    bestFitness = this->populationFitness[bestIndex];
+    best = std::vector<uint32_t>(this->population[bestIndex],
+                                 this->population[bestIndex] +
+                                 this->queensCount);
+    for(i = 0; i < this->populationSize; ++i)
+    {
+        memcpy(this->population[i], best.data(),
+               this->queensCount * sizeof(uint32_t));
+        this->populationFitness[i] = bestFitness;
+        this->populationHash[i]    = this->populationHash[bestIndex];
+    }
+    computeDiversity(uniqueCount, meanHamming);
+    if(uniqueCount != 1 || meanHamming != 0)
+    {
+        throw std::runtime_error("Wrong collapsed diversity: " +
+                                 std::to_string(uniqueCount) + ":" +
+                                 std::to_string(meanHamming));
+    }
+
+    /* The reseed restores diversity and keeps the fittest individual */
+    this->populationFitness[bestIndex] = 0;
+    reseedPopulation();
+    computeDiversity(uniqueCount, meanHamming);
+    if(uniqueCount < this->populationSize * GEN_RESEED_RATIO)
+    {
+        throw std::runtime_error("Reseed did not restore diversity: " +
+                                 std::to_string(uniqueCount));
+    }
+    if(memcmp(this->population[bestIndex], best.data(),
+              this->queensCount * sizeof(uint32_t)) != 0)
+    {
+        throw std::runtime_error("Reseed replaced the fittest individual");
+    }
+    for(i = 0; i < this->populationSize; ++i)
+    {
+        if(i != bestIndex &&
+           this->populationFitness[i] != getAttackCount(this->population[i]))
+        {
+            throw std::runtime_error("Wrong fitness after reseed");
+        }
+    }
+}
+
+void GeneticSolver::testHashes(void)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t val;
+    std::vector<uint32_t> sol;
+
+    /* Both loops must keep the hashes and the cached fitness in sync with the
+     * individuals */
+    for(i = 0; i < 2; ++i)
+    {
+        enableSteadyState(i == 1);
+        solve(sol, val);
+
+        if(val != getAttackCount(sol.data()))
+        {
+            throw std::runtime_error("Wrong solution fitness: " +
+                                     std::to_string(val) + ":" +
+                                     std::to_string(getAttackCount(sol.data())));
+        }
+        for(j = 0; j < this->populationSize; ++j)
+        {
+            if(this->populationHash[j] !=
+               FitnessCache::getHash(this->population[j], this->queensCount))
+            {
+                throw std::runtime_error("Wrong hash for individual " +
+                                         std::to_string(j));
+            }
+            if(this->populationFitness[j] !=
+               getAttackCount(this->population[j]))
+            {
+                throw std::runtime_error("Wrong fitness for individual " +
+                                         std::to_string(j));
+            }
+        }
+        if(this->fitnessCache->getMisses() == 0)
+        {
+            throw std::runtime_error("Fitness cache was not used");
+        }
+    }
+}
+
+void GeneticSolver::testSplitFitness(void)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t val;
+    uint32_t threads[4] = {1, 2, 3, 7};
+
+    initPopulation();
+    computeFitness(false, false);
+
+    /* The split count must match the pairwise count for any thread count,
+     * including blocks left empty */
+    for(i = 0; i < 4; ++i)
+    {
+        for(j = 0; j < this->populationSize; ++j)
+        {
+            val = getSplitAttackCount(this->population[j], threads[i]);
+            if(val != this->populationFitness[j])
+            {
+                throw std::runtime_error("Wrong split fitness: " +
+                                    std::to_string(val) + ":" +
+                                    std::to_string(this->populationFitness[j]));
+            }
+        }
+    }
+
+    /* Queens sharing the main diagonals, the counters must also be left
+     * cleared between two individuals */
+    for(i = 0; i < 2; ++i)
+    {
+        for(j = 0; j < this->queensCount; ++j)
+        {
+            this->population[0][j] = (i == 0) ? j : this->queensCount - 1 - j;
+        }
+        val = getSplitAttackCount(this->population[0], 3);
+        if(val != getAttackCount(this->population[0]) ||
+           val != this->queensCount * (this->queensCount - 1) / 2)
+        {
+            throw std::runtime_error("Wrong split fitness on a diagonal: " +
+                                     std::to_string(val) + ":" +
+                            std::to_string(getAttackCount(this->population[0])));
+        }
+    }
+}
+
+void GeneticSolver::testAdaptiveRates(void)
+{
+    uint32_t i;
+    uint32_t val;
+    std::string error;
+    std::vector<uint32_t> sol;
+
+    GeneticParameters parameters;
+
+    /* Parameters parsing and validation */
+    if(!parameters.set("population", "40", error) ||
+       !parameters.set("mating-pool", "20", error) ||
+       !parameters.set("mutation-size", "30", error) ||
+       !parameters.set("crossover", "0.5", error) ||
+       !parameters.set("adaptive", "1", error) ||
+       !parameters.validate(error))
+    {
+        throw std::runtime_error("Valid parameters rejected: " + error);
+    }
+    if(parameters.set("population", "4O", error) ||
+       parameters.set("crossovr", "0.5", error))
+    {
+        throw std::runtime_error("Invalid parameters accepted");
+    }
+    parameters.matingPoolSize = 21;
+    if(parameters.validate(error))
+    {
+        throw std::runtime_error("Odd mating pool accepted");
+    }
+    parameters.matingPoolSize = 20;
+
+    /* The adapted rates must stay in their bounds and the solution must stay
+     * consistent */
+    GeneticSolver solver(this->queensCount, this->iterCount, parameters);
+    if(solver.populationSize != 40 || solver.matingPoolSize != 20 ||
+       solver.mutationSize != 30 || solver.crossoverProba != 0.5)
+    {
+        throw std::runtime_error("Parameters not applied");
+    }
+    solver.solve(sol, val);
+    if(val != solver.getAttackCount(sol.data()))
+    {
+        throw std::runtime_error("Wrong solution fitness");
+    }
+    for(i = 0; i < 2; ++i)
+    {
+        val = (i == 0) ? solver.crossoverProba * 1000 :
+                         solver.mutationProba * 1000;
+        if(val < GEN_ADAPT_MIN_PROBA * 1000 - 1 ||
+           val > GEN_ADAPT_MAX_PROBA * 1000)
+        {
+            throw std::runtime_error("Adapted rate out of bounds: " +
+                                     std::to_string(val));
+        }
+    }
+    if(solver.crossoverProba == 0.5 &&
+       solver.mutationProba == GEN_MUTATION_PROBA)
+    {
+        throw std::runtime_error("Rates were not adapted");
+    }
+
+    /* The steady-state loop adapts the rates from the pairs success */
+    GeneticSolver steadySolver(this->queensCount, this->iterCount, parameters);
+    steadySolver.enableSteadyState(true);
+    steadySolver.solve(sol, val);
+    if(val != steadySolver.getAttackCount(sol.data()))
+    {
+        throw std::runtime_error("Wrong steady-state solution fitness");
+    }
+    if(steadySolver.generationCount != 0 &&
+       steadySolver.crossoverProba == 0.5 &&
+       steadySolver.mutationProba == GEN_MUTATION_PROBA)
+    {
+        throw std::runtime_error("Steady-state rates were not adapted");
+    }
+}
+
 void GeneticSolver::testTossProbability(void)
 {
     uint32_t i;
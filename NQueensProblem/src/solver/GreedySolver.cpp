@@ -69,7 +69,7 @@ void GreedySolver::solve(std::vector<uint32_t>& solution,
     solution.push_back(this->randDist(this->generator));
 
     /* Now we fill the array until we reached the amount of queens */
-    for(i = 1; i < this->queensCount; ++i)
+    for(i = 1; i < this->queensCount && !isStopped(); ++i)
     {
         /* Init bound data */
         bestPosition    = 0;
@@ -78,7 +78,7 @@ void GreedySolver::solve(std::vector<uint32_t>& solution,
         solution.push_back(0);
 
         /* Search for best position */
-        for(j = 0; j < this->queensCount; ++j)
+        for(j = 0; j < this->queensCount && !isStopped(); ++j)
         {
             solution[i] = j;
             currentAttackCount = getAttackCount(solution);
@@ -73,7 +73,8 @@ void HillClimbingSolver::solve(std::vector<uint32_t>& solution,
     }
 
     /* Search for the best solution now */
-    for(i = 0; i < this->iterCount && bestAttackCount != 0; ++i)
+    for(i = 0; i < this->iterCount && bestAttackCount != 0 && !isStopped();
+        ++i)
     {
         /* Select a random position to modify */
         index = this->randDist(this->generator);
@@ -0,0 +1,680 @@
+/******************************************************************************
+ * File: MinConflictsSolver.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * MinConflictsSolver implements the Solver class. Any class implementing the
+ * Solver interface is assumed to solve the N Queens Problem.
+ * The algorithm used to solve the problem is a parallel min-conflicts
+ * algorithm working on permutations and shared atomic diagonal counters.
+ ******************************************************************************/
+
+#include <cstdint> /* uint32_t, uint64_t, int64_t */
+#include <cstdlib> /* abs */
+#include <vector>    /* std::vector */
+#include <algorithm> /* std::sort, std::unique */
+#include <atomic>  /* std::atomic */
+#include <thread>  /* std::thread */
+#include <random>  /* std::random_device, std::mt19937,
+                      std::uniform_int_distribution */
+
+/* Header file */
+#include <solver/MinConflictsSolver.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/**
+ * @brief Computes the greatest common divisor of two integers.
+ *
+ * @param[in] a The first integer.
+ * @param[in] b The second integer.
+ *
+ * @return uint64_t The greatest common divisor of a and b.
+ */
+static uint64_t gcd(uint64_t a, uint64_t b)
+{
+    uint64_t tmp;
+
+    while(b != 0)
+    {
+        tmp = a % b;
+        a   = b;
+        b   = tmp;
+    }
+    return a;
+}
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+MinConflictsSolver::MinConflictsSolver(const uint32_t queensCount,
+                                       const uint32_t iterCount,
+                                       const uint32_t threadCount)
+{
+    this->queensCount = queensCount;
+    this->iterCount   = iterCount;
+    this->diagUp      = nullptr;
+    this->diagDown    = nullptr;
+
+    /* Get cores count */
+    this->threadCount = threadCount;
+    if(this->threadCount == 0)
+    {
+        this->threadCount = std::thread::hardware_concurrency();
+    }
+    /* Keep at least two columns per block */
+    if(this->threadCount > this->queensCount / 2)
+    {
+        this->threadCount = this->queensCount / 2;
+    }
+    if(this->threadCount == 0)
+    {
+        this->threadCount = 1;
+    }
+
+    /* Initialize the random generator */
+    std::random_device rd;
+    generator = std::mt19937(rd());
+}
+
+MinConflictsSolver::~MinConflictsSolver(void)
+{
+    delete[] this->diagUp;
+    delete[] this->diagDown;
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+void MinConflictsSolver::solve(std::vector<uint32_t>& solution,
+                               uint32_t &attackCount)
+{
+    uint32_t i;
+    uint32_t round;
+    uint32_t blockSize;
+    uint32_t diagCount;
+    uint32_t stalledRounds;
+    uint32_t block;
+    uint64_t conflictCount;
+    uint64_t lastCount;
+    uint64_t attacks;
+    uint64_t prime;
+    uint64_t offset;
+
+    std::vector<std::thread> threads;
+    std::vector<uint32_t>    candidates;
+    std::vector<std::vector<uint32_t>> blockCandidates(this->threadCount);
+    std::vector<std::vector<uint32_t>> nextCandidates(this->threadCount);
+
+    /* Initializes the data */
+    solution.clear();
+    attackCount = 0;
+
+    /* Check parameters */
+    if(this->queensCount == 0 || this->iterCount == 0)
+    {
+        return;
+    }
+
+    /* Allocate the diagonal counters */
+    diagCount = 2 * this->queensCount - 1;
+    delete[] this->diagUp;
+    delete[] this->diagDown;
+    this->diagUp   = new std::atomic<uint16_t>[diagCount];
+    this->diagDown = new std::atomic<uint16_t>[diagCount];
+    for(i = 0; i < diagCount; ++i)
+    {
+        this->diagUp[i].store(0, std::memory_order_relaxed);
+        this->diagDown[i].store(0, std::memory_order_relaxed);
+    }
+
+    /* Spread the lines over the blocks with a line = a * column + b mod N
+     * permutation, each block then shuffles its own lines.
+     */
+    std::uniform_int_distribution<uint64_t> primeDist(1, this->queensCount);
+    do
+    {
+        prime = primeDist(this->generator);
+    } while(gcd(prime, this->queensCount) != 1);
+    offset = primeDist(this->generator) - 1;
+
+    solution.resize(this->queensCount);
+    for(i = 0; i < this->queensCount; ++i)
+    {
+        solution[i] = (i * prime + offset) % this->queensCount;
+    }
+
+    blockSize = this->queensCount / this->threadCount;
+    for(i = 0; i < this->threadCount; ++i)
+    {
+        threads.push_back(std::thread(&MinConflictsSolver::initThread,
+                                      this,
+                                      &solution,
+                                      i * blockSize,
+                                      (i == this->threadCount - 1) ?
+                                        this->queensCount :
+                                        (i + 1) * blockSize,
+                                      this->generator()));
+    }
+    for(i = 0; i < this->threadCount; ++i)
+    {
+        threads[i].join();
+    }
+
+    /* Repair rounds, the blocks are rotated at each round so queens of
+     * different blocks can be swapped together. The first round scans the
+     * whole board, the next ones only visit the queens that were still
+     * conflicted or that moved: any new conflict involves a moved queen.
+     */
+    std::uniform_int_distribution<uint32_t> offsetDist(0,
+                                                       this->queensCount - 1);
+    conflictCount = this->queensCount;
+    lastCount     = conflictCount;
+    stalledRounds = 0;
+    for(round = 0;
+        round < this->iterCount && conflictCount != 0 && !isStopped();
+        ++round)
+    {
+        offset = offsetDist(this->generator);
+
+        /* Dispatch the candidates to the block owning them */
+        for(i = 0; i < this->threadCount; ++i)
+        {
+            blockCandidates[i].clear();
+        }
+        for(i = 0; i < candidates.size(); ++i)
+        {
+            block = ((candidates[i] + this->queensCount - offset) %
+                     this->queensCount) / blockSize;
+            if(block >= this->threadCount)
+            {
+                block = this->threadCount - 1;
+            }
+            blockCandidates[block].push_back(candidates[i]);
+        }
+
+        threads.clear();
+        for(i = 0; i < this->threadCount; ++i)
+        {
+            threads.push_back(std::thread(&MinConflictsSolver::repairThread,
+                                          this,
+                                          &solution,
+                                          (offset + i * blockSize) %
+                                            this->queensCount,
+                                          (i == this->threadCount - 1) ?
+                                            this->queensCount - i * blockSize :
+                                            blockSize,
+                                          this->generator(),
+                                          stalledRounds >= MINC_STALL_ROUNDS,
+                                          (round == 0) ?
+                                            nullptr : &blockCandidates[i],
+                                          &nextCandidates[i]));
+        }
+        for(i = 0; i < this->threadCount; ++i)
+        {
+            threads[i].join();
+        }
+
+        /* Merge the candidates and keep the conflicted ones */
+        candidates.clear();
+        for(i = 0; i < this->threadCount; ++i)
+        {
+            candidates.insert(candidates.end(),
+                              nextCandidates[i].begin(),
+                              nextCandidates[i].end());
+        }
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                         candidates.end());
+        conflictCount = 0;
+        for(i = 0; i < candidates.size(); ++i)
+        {
+            if(isConflicted(candidates[i], solution[candidates[i]]))
+            {
+                candidates[conflictCount++] = candidates[i];
+            }
+        }
+        candidates.resize(conflictCount);
+
+        if(conflictCount < lastCount)
+        {
+            stalledRounds = 0;
+            lastCount     = conflictCount;
+        }
+        else if(stalledRounds >= MINC_STALL_ROUNDS)
+        {
+            /* The perturbation round is done, climb again */
+            stalledRounds = 0;
+            lastCount     = conflictCount;
+        }
+        else
+        {
+            ++stalledRounds;
+        }
+    }
+
+    /* Verification pass: the counters are rebuilt from the board */
+    rebuildCounters(solution);
+    attacks = getCounterAttackCount();
+    if(attacks > UINT32_MAX)
+    {
+        attacks = UINT32_MAX;
+    }
+    attackCount = attacks;
+
+    /* Release the counters */
+    delete[] this->diagUp;
+    delete[] this->diagDown;
+    this->diagUp   = nullptr;
+    this->diagDown = nullptr;
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+uint32_t
+MinConflictsSolver::getAttackCount(const std::vector<uint32_t>& solution) const
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t attackCount;
+
+    attackCount = 0;
+    for(i = 0; i < this->queensCount; ++i)
+    {
+        for(j = i + 1; j < this->queensCount; ++j)
+        {
+            /* Check same lines, first diagonal and second diagonal */
+            if(solution[i] == solution[j] ||
+               (j - i) == abs(solution[i] - solution[j]))
+            {
+                ++attackCount;
+            }
+        }
+    }
+
+    return attackCount;
+}
+
+uint64_t MinConflictsSolver::getCounterAttackCount(void) const
+{
+    uint32_t i;
+    uint32_t blockSize;
+    uint32_t diagCount;
+    uint64_t attacks;
+
+    std::vector<std::thread> threads;
+    std::vector<uint64_t>    partialAttacks(this->threadCount, 0);
+
+    diagCount = 2 * this->queensCount - 1;
+    blockSize = diagCount / this->threadCount;
+    for(i = 0; i < this->threadCount; ++i)
+    {
+        threads.push_back(std::thread(&MinConflictsSolver::counterAttackThread,
+                                      this,
+                                      i * blockSize,
+                                      (i == this->threadCount - 1) ?
+                                        diagCount : (i + 1) * blockSize,
+                                      &partialAttacks[i]));
+    }
+
+    /* Reduction */
+    attacks = 0;
+    for(i = 0; i < this->threadCount; ++i)
+    {
+        threads[i].join();
+        attacks += partialAttacks[i];
+    }
+
+    return attacks;
+}
+
+void MinConflictsSolver::counterAttackThread(const uint32_t start,
+                                             const uint32_t end,
+                                             uint64_t* attacks) const
+{
+    uint32_t i;
+    uint64_t count;
+    uint64_t sum;
+
+    /* Each diagonal holding c queens contains c * (c - 1) / 2 attacks */
+    sum = 0;
+    for(i = start; i < end; ++i)
+    {
+        count = this->diagUp[i].load(std::memory_order_relaxed);
+        sum  += count * (count - 1) / 2;
+        count = this->diagDown[i].load(std::memory_order_relaxed);
+        sum  += count * (count - 1) / 2;
+    }
+    *attacks = sum;
+}
+
+void MinConflictsSolver::rebuildCounters(const std::vector<uint32_t>& solution)
+{
+    uint32_t i;
+    uint32_t blockSize;
+    uint32_t diagCount;
+
+    std::vector<std::thread> threads;
+
+    diagCount = 2 * this->queensCount - 1;
+    for(i = 0; i < diagCount; ++i)
+    {
+        this->diagUp[i].store(0, std::memory_order_relaxed);
+        this->diagDown[i].store(0, std::memory_order_relaxed);
+    }
+
+    blockSize = this->queensCount / this->threadCount;
+    for(i = 0; i < this->threadCount; ++i)
+    {
+        threads.push_back(std::thread(&MinConflictsSolver::countThread,
+                                      this,
+                                      &solution,
+                                      i * blockSize,
+                                      (i == this->threadCount - 1) ?
+                                        this->queensCount :
+                                        (i + 1) * blockSize));
+    }
+    for(i = 0; i < this->threadCount; ++i)
+    {
+        threads[i].join();
+    }
+}
+
+void MinConflictsSolver::countThread(const std::vector<uint32_t>* solution,
+                                     const uint32_t start,
+                                     const uint32_t end)
+{
+    uint32_t i;
+    uint32_t line;
+
+    for(i = start; i < end; ++i)
+    {
+        line = (*solution)[i];
+        this->diagUp[i + line].fetch_add(1, std::memory_order_relaxed);
+        this->diagDown[i + this->queensCount - 1 - line].fetch_add(
+                                                1, std::memory_order_relaxed);
+    }
+}
+
+void MinConflictsSolver::initThread(std::vector<uint32_t>* solution,
+                                    const uint32_t start,
+                                    const uint32_t end,
+                                    const uint32_t seed)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+    uint32_t line;
+    uint32_t tmp;
+
+    std::mt19937 threadGenerator(seed);
+    std::uniform_int_distribution<uint32_t> randDist;
+
+    /* Random shuffle of the block, each column tries a few lines to find one
+     * with free diagonals.
+     */
+    for(i = start; i < end; ++i)
+    {
+        randDist = std::uniform_int_distribution<uint32_t>(i, end - 1);
+        j = i;
+        for(k = 0; k < MINC_INIT_TRIES; ++k)
+        {
+            j    = randDist(threadGenerator);
+            line = (*solution)[j];
+            if(this->diagUp[i + line].load(std::memory_order_relaxed) == 0 &&
+               this->diagDown[i + this->queensCount - 1 - line].load(
+                                            std::memory_order_relaxed) == 0)
+            {
+                break;
+            }
+        }
+
+        tmp             = (*solution)[i];
+        (*solution)[i]  = (*solution)[j];
+        (*solution)[j]  = tmp;
+
+        line = (*solution)[i];
+        this->diagUp[i + line].fetch_add(1, std::memory_order_relaxed);
+        this->diagDown[i + this->queensCount - 1 - line].fetch_add(
+                                                1, std::memory_order_relaxed);
+    }
+}
+
+void MinConflictsSolver::repairThread(std::vector<uint32_t>* solution,
+                                      const uint32_t start,
+                                      const uint32_t size,
+                                      const uint32_t seed,
+                                      const bool perturb,
+                                      const std::vector<uint32_t>* candidates,
+                                      std::vector<uint32_t>* next)
+{
+    uint32_t i;
+    uint32_t k;
+    uint32_t column;
+    uint32_t partner;
+    uint32_t sideways;
+    int64_t  delta;
+
+    std::vector<uint32_t> conflicted;
+    std::mt19937 threadGenerator(seed);
+    std::uniform_int_distribution<uint32_t> randDist(0, size - 1);
+
+    /* Gather the conflicted queens of the block */
+    if(candidates == nullptr)
+    {
+        for(i = 0; i < size; ++i)
+        {
+            column = (start + i) % this->queensCount;
+            if(isConflicted(column, (*solution)[column]))
+            {
+                conflicted.push_back(column);
+            }
+        }
+        candidates = &conflicted;
+    }
+
+    next->clear();
+    for(i = 0; i < candidates->size(); ++i)
+    {
+        column = (*candidates)[i];
+
+        /* Keep the remaining candidates when cancelled */
+        if(isStopped())
+        {
+            next->insert(next->end(), candidates->begin() + i,
+                         candidates->end());
+            break;
+        }
+
+        /* Another swap may already have repaired the queen */
+        if(!isConflicted(column, (*solution)[column]))
+        {
+            continue;
+        }
+
+        /* Take the first improving swap, fall back on a sideways swap, or
+         * on any swap when the search stalled.
+         */
+        sideways = column;
+        for(k = 0; k < MINC_SWAP_TRIES; ++k)
+        {
+            partner = (start + randDist(threadGenerator)) % this->queensCount;
+            if(partner == column)
+            {
+                continue;
+            }
+
+            if(perturb)
+            {
+                sideways = partner;
+                break;
+            }
+
+            delta = getSwapDelta(column, (*solution)[column],
+                                 partner, (*solution)[partner]);
+            if(delta < 0)
+            {
+                break;
+            }
+            else if(delta == 0)
+            {
+                sideways = partner;
+            }
+        }
+        if(k == MINC_SWAP_TRIES || perturb)
+        {
+            partner = sideways;
+        }
+
+        /* Both moved queens may be conflicted in their new position */
+        next->push_back(column);
+        if(partner != column)
+        {
+            swapQueens(*solution, column, partner);
+            next->push_back(partner);
+        }
+    }
+}
+
+bool MinConflictsSolver::isConflicted(const uint32_t column,
+                                      const uint32_t line) const
+{
+    return
+        this->diagUp[column + line].load(std::memory_order_relaxed) > 1 ||
+        this->diagDown[column + this->queensCount - 1 - line].load(
+                                                std::memory_order_relaxed) > 1;
+}
+
+int64_t MinConflictsSolver::getSwapDelta(const uint32_t colA,
+                                         const uint32_t lineA,
+                                         const uint32_t colB,
+                                         const uint32_t lineB) const
+{
+    int64_t  oldAttacks;
+    int64_t  newAttacks;
+    uint32_t upA;
+    uint32_t upB;
+    uint32_t downA;
+    uint32_t downB;
+    uint32_t newUpA;
+    uint32_t newUpB;
+    uint32_t newDownA;
+    uint32_t newDownB;
+    uint32_t shift;
+
+    shift = this->queensCount - 1;
+
+    upA      = colA + lineA;
+    upB      = colB + lineB;
+    downA    = colA + shift - lineA;
+    downB    = colB + shift - lineB;
+    newUpA   = colA + lineB;
+    newUpB   = colB + lineA;
+    newDownA = colA + shift - lineB;
+    newDownB = colB + shift - lineA;
+
+    /* Attacks are counted as if both queens were first removed from the
+     * board, the counters are then corrected for the removed queens.
+     */
+    oldAttacks =
+        (int64_t)this->diagUp[upA].load(std::memory_order_relaxed) - 1 -
+            (upA == upB) +
+        (int64_t)this->diagUp[upB].load(std::memory_order_relaxed) - 1 -
+            (upA == upB) +
+        (upA == upB) +
+        (int64_t)this->diagDown[downA].load(std::memory_order_relaxed) - 1 -
+            (downA == downB) +
+        (int64_t)this->diagDown[downB].load(std::memory_order_relaxed) - 1 -
+            (downA == downB) +
+        (downA == downB);
+
+    newAttacks =
+        (int64_t)this->diagUp[newUpA].load(std::memory_order_relaxed) -
+            (newUpA == upA) - (newUpA == upB) +
+        (int64_t)this->diagUp[newUpB].load(std::memory_order_relaxed) -
+            (newUpB == upA) - (newUpB == upB) +
+        (newUpA == newUpB) +
+        (int64_t)this->diagDown[newDownA].load(std::memory_order_relaxed) -
+            (newDownA == downA) - (newDownA == downB) +
+        (int64_t)this->diagDown[newDownB].load(std::memory_order_relaxed) -
+            (newDownB == downA) - (newDownB == downB) +
+        (newDownA == newDownB);
+
+    return newAttacks - oldAttacks;
+}
+
+void MinConflictsSolver::swapQueens(std::vector<uint32_t>& solution,
+                                    const uint32_t colA, const uint32_t colB)
+{
+    uint32_t lineA;
+    uint32_t lineB;
+    uint32_t shift;
+
+    shift = this->queensCount - 1;
+    lineA = solution[colA];
+    lineB = solution[colB];
+
+    this->diagUp[colA + lineA].fetch_sub(1, std::memory_order_relaxed);
+    this->diagUp[colB + lineB].fetch_sub(1, std::memory_order_relaxed);
+    this->diagDown[colA + shift - lineA].fetch_sub(1,
+                                                   std::memory_order_relaxed);
+    this->diagDown[colB + shift - lineB].fetch_sub(1,
+                                                   std::memory_order_relaxed);
+
+    this->diagUp[colA + lineB].fetch_add(1, std::memory_order_relaxed);
+    this->diagUp[colB + lineA].fetch_add(1, std::memory_order_relaxed);
+    this->diagDown[colA + shift - lineB].fetch_add(1,
+                                                   std::memory_order_relaxed);
+    this->diagDown[colB + shift - lineA].fetch_add(1,
+                                                   std::memory_order_relaxed);
+
+    solution[colA] = lineB;
+    solution[colB] = lineA;
+}
+
+#ifdef _TESTMODE
+/*******************************************************************************
+ * Test methods
+ ******************************************************************************/
+/* LCOV_EXCL_START */
+
+#include <stdexcept> /* std::runtime_error */
+void MinConflictsSolver::testSolve(void)
+{
+    uint32_t val;
+    uint32_t i;
+    std::vector<uint32_t> sol;
+    std::vector<bool>     used;
+
+    solve(sol, val);
+    if(sol.size() != this->queensCount)
+    {
+        throw std::runtime_error("Wrong solution size: " +
+                                 std::to_string(sol.size()));
+    }
+    if(getAttackCount(sol) != val)
+    {
+        throw std::runtime_error("Solution does not match" +
+                                 std::to_string(val) + ":" +
+                                 std::to_string(getAttackCount(sol)));
+    }
+
+    /* The board must stay a permutation */
+    used = std::vector<bool>(sol.size(), false);
+    for(i = 0; i < sol.size(); ++i)
+    {
+        if(sol[i] >= sol.size() || used[sol[i]])
+        {
+            throw std::runtime_error("Erroneous line found in solution");
+        }
+        used[sol[i]] = true;
+    }
+}
+
+/* LCOV_EXCL_STOP */
+#endif
@@ -17,8 +17,13 @@
  ******************************************************************************/
 
 
-#include <cstdint> /* Generic int types */
-#include <random>  /* std::random_device, std::uniform_int_distribution */
+#include <cstdint>   /* Generic int types */
+#include <vector>    /* std::vector */
+#include <random>    /* std::random_device, std::uniform_int_distribution */
+#include <algorithm> /* std::fill */
+
+/* nsSolver::FitnessCache */
+#include <solver/FitnessCache.h>
 
 /* Header file */
 #include <solver/OrderOneCrossoverOperator.h>
@@ -41,13 +46,16 @@ OrderOneCrossoverOperator::OrderOneCrossoverOperator(void)
 void OrderOneCrossoverOperator::operator()(const uint32_t   individualSize,
                                            const uint32_t** pop,
                                            const uint32_t   popSize,
+                                           const uint64_t*  popHash,
                                            const uint32_t*  matingPool,
                                            const uint32_t   matingPoolSize,
-                                           uint32_t**       newChildren)
+                                           uint32_t**       newChildren,
+                                           uint64_t*        childrenHash)
 {
     uint32_t i;
     uint32_t offset;
 
+    uint64_t        parentsHash[2];
     const uint32_t* parents[2] = {nullptr, nullptr};
     uint32_t*       children[2];
 
@@ -57,23 +65,32 @@ void OrderOneCrossoverOperator::operator()(const uint32_t   individualSize,
         return;
     }
 
+    /* The table only grows, the next calls do not allocate */
+    if(this->placed.size() < individualSize)
+    {
+        this->placed.resize(individualSize);
+    }
+
     /* We mate the parents */
     offset = 0;
     for(i = 0; i < matingPoolSize; ++i)
     {
         if(parents[0] == nullptr && matingPool[i] < popSize)
         {
-            parents[0] = pop[matingPool[i]];
+            parents[0]     = pop[matingPool[i]];
+            parentsHash[0] = popHash[matingPool[i]];
         }
         else if(matingPool[i] < popSize)
         {
 
-            parents[1] = pop[matingPool[i]];
+            parents[1]     = pop[matingPool[i]];
+            parentsHash[1] = popHash[matingPool[i]];
 
             children[0] = newChildren[offset];
             children[1] = newChildren[offset + 1];
 
-            mate(individualSize, parents, children);
+            mate(individualSize, parents, parentsHash, children,
+                 childrenHash + offset);
 
             parents[0] = nullptr;
             parents[1] = nullptr;
@@ -87,7 +104,9 @@ void OrderOneCrossoverOperator::operator()(const uint32_t   individualSize,
  ******************************************************************************/
 void OrderOneCrossoverOperator::mate(const uint32_t   individualSize,
                                      const uint32_t** parents,
-                                     uint32_t**       children)
+                                     const uint64_t*  parentsHash,
+                                     uint32_t**       children,
+                                     uint64_t*        childrenHash)
 {
     uint32_t startIndex;
     uint32_t endIndex;
@@ -98,14 +117,13 @@ void OrderOneCrossoverOperator::mate(const uint32_t   individualSize,
     uint32_t pindex;
     uint32_t pSel;
     uint32_t placedCount;
-    std::vector<bool> placed;
     std::uniform_int_distribution<uint64_t> distributionInt;
 
     /* Create two children */
     for(i = 0; i < 2; ++i)
     {
-        placed      = std::vector<bool>(individualSize, false);
-        placedCount = 0;
+        std::fill(this->placed.begin(),
+                  this->placed.begin() + individualSize, 0);
 
         /* Select two random points */
         distributionInt = std::uniform_int_distribution<uint64_t>(0,
@@ -115,12 +133,14 @@ void OrderOneCrossoverOperator::mate(const uint32_t   individualSize,
                             individualSize - 1);
         endIndex = distributionInt(this->randomGenerator);
 
-        /* Copy first parent's material */
+        /* Copy first parent's material, the hash starts from the first
+         * parent and changes with each filled gene that differs */
+        childrenHash[i] = parentsHash[i];
         for(j = startIndex; j <= endIndex; ++j)
         {
             value = parents[i][j];
             children[i][j] = value;
-            placed[value] = true;
+            this->placed[value] = 1;
         }
         placedCount = endIndex - startIndex + 1;
 
@@ -132,11 +152,17 @@ void OrderOneCrossoverOperator::mate(const uint32_t   individualSize,
         while(placedCount != individualSize)
         {
             value = parents[pSel][pindex];
-            if(!placed[value])
+            if(this->placed[value] == 0)
             {
+                if(value != parents[i][cindex])
+                {
+                    childrenHash[i] ^=
+                        FitnessCache::getGeneKey(cindex, parents[i][cindex]) ^
+                        FitnessCache::getGeneKey(cindex, value);
+                }
                 children[i][cindex] = value;
                 ++placedCount;
-                placed[value] = true;
+                this->placed[value] = 1;
                 cindex = (cindex + 1) % individualSize;
             }
             pindex = (pindex + 1) % individualSize;
@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * File: PMXCrossoverOperator.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Crossover operator implementing the partially mapped crossover (PMX).
+ * A swath of consecutive alleles from parent 1 is copied at the same
+ * positions in the child, the rest of the child keeps the alleles of parent 2
+ * at their positions, the conflicting alleles being placed through the
+ * mapping defined by the swath.
+ ******************************************************************************/
+
+#include <cstdint> /* Generic int types */
+#include <vector>  /* std::vector */
+#include <random>  /* std::random_device, std::uniform_int_distribution */
+#include <cstring> /* memcpy */
+
+/* nsSolver::FitnessCache */
+#include <solver/FitnessCache.h>
+
+/* Header file */
+#include <solver/PMXCrossoverOperator.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+PMXCrossoverOperator::PMXCrossoverOperator(void)
+{
+    /* Initialize the random generator */
+    std::random_device rd;
+    this->randomGenerator.seed(rd());
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+void PMXCrossoverOperator::operator()(const uint32_t   individualSize,
+                                      const uint32_t** pop,
+                                      const uint32_t   popSize,
+                                      const uint64_t*  popHash,
+                                      const uint32_t*  matingPool,
+                                      const uint32_t   matingPoolSize,
+                                      uint32_t**       newChildren,
+                                      uint64_t*        childrenHash)
+{
+    uint32_t i;
+    uint32_t offset;
+
+    uint64_t        parentsHash[2];
+    const uint32_t* parents[2] = {nullptr, nullptr};
+    uint32_t*       children[2];
+
+    /* We cannot mate less than two parents */
+    if(matingPoolSize < 2 || individualSize == 0)
+    {
+        return;
+    }
+
+    /* The table only grows, the next calls do not allocate */
+    if(this->positions.size() < individualSize)
+    {
+        this->positions.resize(individualSize);
+    }
+
+    /* We mate the parents */
+    offset = 0;
+    for(i = 0; i < matingPoolSize; ++i)
+    {
+        if(parents[0] == nullptr && matingPool[i] < popSize)
+        {
+            parents[0]     = pop[matingPool[i]];
+            parentsHash[0] = popHash[matingPool[i]];
+        }
+        else if(matingPool[i] < popSize)
+        {
+            parents[1]     = pop[matingPool[i]];
+            parentsHash[1] = popHash[matingPool[i]];
+
+            children[0] = newChildren[offset];
+            children[1] = newChildren[offset + 1];
+
+            mate(individualSize, parents, parentsHash, children,
+                 childrenHash + offset);
+
+            parents[0] = nullptr;
+            parents[1] = nullptr;
+            offset += 2;
+        }
+    }
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+void PMXCrossoverOperator::mate(const uint32_t   individualSize,
+                                const uint32_t** parents,
+                                const uint64_t*  parentsHash,
+                                uint32_t**       children,
+                                uint64_t*        childrenHash)
+{
+    uint32_t startIndex;
+    uint32_t endIndex;
+    uint32_t i;
+    uint32_t j;
+    uint32_t value;
+    uint32_t position;
+    uint32_t* child;
+    std::uniform_int_distribution<uint64_t> distributionInt;
+
+    /* Create two children */
+    for(i = 0; i < 2; ++i)
+    {
+        child = children[i];
+
+        /* Start from the second parent */
+        memcpy(child, parents[(i + 1) % 2], individualSize * sizeof(uint32_t));
+        childrenHash[i] = parentsHash[(i + 1) % 2];
+        for(j = 0; j < individualSize; ++j)
+        {
+            this->positions[child[j]] = j;
+        }
+
+        /* Select two random points */
+        distributionInt = std::uniform_int_distribution<uint64_t>(0,
+                            individualSize - 1);
+        startIndex = distributionInt(this->randomGenerator);
+        distributionInt = std::uniform_int_distribution<uint64_t>(startIndex,
+                            individualSize - 1);
+        endIndex = distributionInt(this->randomGenerator);
+
+        /* Swap the first parent's material into place, the displaced allele
+         * goes where the swath allele was: this follows the PMX mapping */
+        for(j = startIndex; j <= endIndex; ++j)
+        {
+            value    = parents[i][j];
+            position = this->positions[value];
+            if(position != j)
+            {
+                /* Only the two swapped genes change the hash */
+                childrenHash[i] = FitnessCache::swapHash(childrenHash[i],
+                                                         j, child[j],
+                                                         position, value);
+                child[position] = child[j];
+                child[j]        = value;
+
+                this->positions[child[position]] = position;
+                this->positions[value]           = j;
+            }
+        }
+    }
+}
@@ -0,0 +1,285 @@
+/******************************************************************************
+ * File: PortfolioSolver.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * PortfolioSolver implements the Solver class. Any class implementing the
+ * Solver interface is assumed to solve the N Queens Problem.
+ * The solver races the other search solvers on separate threads and keeps the
+ * first zero conflict solution.
+ ******************************************************************************/
+
+#include <cstdint>            /* uint32_t */
+#include <vector>             /* std::vector */
+#include <string>             /* std::string */
+#include <thread>             /* std::thread */
+#include <mutex>              /* std::mutex, std::unique_lock */
+#include <condition_variable> /* std::condition_variable */
+#include <chrono>             /* std::chrono::milliseconds */
+#include <cstdlib>            /* abs */
+
+#include <solver/GreedySolver.h>       /* nsSolver::GreedySolver */
+#include <solver/HillClimbingSolver.h> /* nsSolver::HillClimbingSolver */
+#include <solver/GeneticSolver.h>      /* nsSolver::GeneticSolver */
+#include <solver/MinConflictsSolver.h> /* nsSolver::MinConflictsSolver */
+
+/* Header file */
+#include <solver/PortfolioSolver.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+PortfolioSolver::PortfolioSolver(const uint32_t queensCount,
+                                 const uint32_t iterCount)
+{
+    uint32_t i;
+
+    this->queensCount = queensCount;
+    this->iterCount   = iterCount;
+
+    /* Create the engines */
+    this->engines.push_back(new GreedySolver(queensCount));
+    this->engineNames.push_back("GREEDY");
+    this->engineBounded.push_back(false);
+
+    this->engines.push_back(new HillClimbingSolver(queensCount, iterCount));
+    this->engineNames.push_back("HILL");
+    this->engineBounded.push_back(true);
+
+    this->engines.push_back(new GeneticSolver(queensCount, iterCount));
+    this->engineNames.push_back("GEN");
+    this->engineBounded.push_back(true);
+
+    this->engines.push_back(new GeneticSolver(queensCount, iterCount));
+    static_cast<GeneticSolver*>(this->engines.back())->enableLocalSearch(
+                                                    GEN_LOCAL_SEARCH_BUDGET);
+    this->engineNames.push_back("MEMETIC");
+    this->engineBounded.push_back(true);
+
+    this->engines.push_back(new MinConflictsSolver(queensCount, iterCount, 0));
+    this->engineNames.push_back("MINCONF");
+    this->engineBounded.push_back(true);
+
+    /* All the engines share the same stop flag */
+    this->engineStop.store(false);
+    for(i = 0; i < this->engines.size(); ++i)
+    {
+        this->engines[i]->setStopFlag(&this->engineStop);
+    }
+
+    this->finishedCount        = 0;
+    this->finishedBoundedCount = 0;
+    this->winnerIndex          = UINT32_MAX;
+}
+
+PortfolioSolver::~PortfolioSolver(void)
+{
+    uint32_t i;
+
+    for(i = 0; i < this->engines.size(); ++i)
+    {
+        delete this->engines[i];
+    }
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+void PortfolioSolver::solve(std::vector<uint32_t>& solution,
+                            uint32_t &attackCount)
+{
+    uint32_t i;
+    uint32_t bestIndex;
+    uint32_t boundedCount;
+
+    std::vector<std::thread>           threads;
+    std::vector<std::vector<uint32_t>> results;
+    std::vector<uint32_t>              attacks;
+
+    /* Initializes the data */
+    solution.clear();
+    attackCount = 0;
+    this->winnerName.clear();
+
+    /* Check parameters */
+    if(this->queensCount == 0)
+    {
+        return;
+    }
+
+    this->engineStop.store(false);
+    this->finishedCount        = 0;
+    this->finishedBoundedCount = 0;
+    this->winnerIndex          = UINT32_MAX;
+
+    boundedCount = 0;
+    for(i = 0; i < this->engines.size(); ++i)
+    {
+        if(this->engineBounded[i])
+        {
+            ++boundedCount;
+        }
+    }
+
+    /* Start the race */
+    results = std::vector<std::vector<uint32_t>>(this->engines.size());
+    attacks = std::vector<uint32_t>(this->engines.size(), UINT32_MAX);
+    for(i = 0; i < this->engines.size(); ++i)
+    {
+        threads.push_back(std::thread(&PortfolioSolver::engineThread, this,
+                                      i, &results[i], &attacks[i]));
+    }
+
+    /* Wait for the engines, forward our own cancellation and stop the
+     * unbounded engines once the bounded ones are done */
+    {
+        std::unique_lock<std::mutex> lock(this->raceLock);
+        while(this->finishedCount < this->engines.size())
+        {
+            this->raceSignal.wait_for(lock,
+                            std::chrono::milliseconds(PORTFOLIO_POLL_MS));
+            if(isStopped() || this->finishedBoundedCount == boundedCount)
+            {
+                this->engineStop.store(true);
+            }
+        }
+    }
+
+    for(i = 0; i < threads.size(); ++i)
+    {
+        threads[i].join();
+    }
+
+    /* Keep the winner, or the best complete solution */
+    bestIndex = this->winnerIndex;
+    if(bestIndex == UINT32_MAX)
+    {
+        for(i = 0; i < this->engines.size(); ++i)
+        {
+            if(results[i].size() == this->queensCount &&
+               (bestIndex == UINT32_MAX || attacks[i] < attacks[bestIndex]))
+            {
+                bestIndex = i;
+            }
+        }
+    }
+
+    if(bestIndex != UINT32_MAX)
+    {
+        solution.swap(results[bestIndex]);
+        attackCount      = attacks[bestIndex];
+        this->winnerName = this->engineNames[bestIndex];
+    }
+}
+
+const std::string& PortfolioSolver::getWinner(void) const
+{
+    return this->winnerName;
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+void PortfolioSolver::engineThread(const uint32_t index,
+                                   std::vector<uint32_t>* solution,
+                                   uint32_t* attackCount)
+{
+    this->engines[index]->solve(*solution, *attackCount);
+
+    std::lock_guard<std::mutex> lock(this->raceLock);
+
+    ++this->finishedCount;
+    if(this->engineBounded[index])
+    {
+        ++this->finishedBoundedCount;
+    }
+
+    /* The first complete zero conflict solution cancels the other engines */
+    if(this->winnerIndex == UINT32_MAX &&
+       solution->size() == this->queensCount &&
+       *attackCount == 0)
+    {
+        this->winnerIndex = index;
+        this->engineStop.store(true);
+    }
+
+    this->raceSignal.notify_one();
+}
+
+uint32_t
+PortfolioSolver::getAttackCount(const std::vector<uint32_t>& solution) const
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t attackCount;
+
+    attackCount = 0;
+    for(i = 0; i < this->queensCount; ++i)
+    {
+        for(j = i + 1; j < this->queensCount; ++j)
+        {
+            /* Check same lines, first diagonal and second diagonal */
+            if(solution[i] == solution[j] ||
+               (j - i) == abs(solution[i] - solution[j]))
+            {
+                ++attackCount;
+            }
+        }
+    }
+
+    return attackCount;
+}
+
+#ifdef _TESTMODE
+/*******************************************************************************
+ * Test methods
+ ******************************************************************************/
+/* LCOV_EXCL_START */
+
+#include <stdexcept> /* std::runtime_error */
+void PortfolioSolver::testSolve(void)
+{
+    uint32_t val;
+    std::vector<uint32_t> sol;
+
+    solve(sol, val);
+    if(sol.size() != this->queensCount)
+    {
+        throw std::runtime_error("Wrong solution size: " +
+                                 std::to_string(sol.size()));
+    }
+    if(this->queensCount == 0)
+    {
+        return;
+    }
+    if(getAttackCount(sol) != val)
+    {
+        throw std::runtime_error("Solution does not match" +
+                                 std::to_string(val) + ":" +
+                                 std::to_string(getAttackCount(sol)));
+    }
+    if(this->queensCount >= 4 && val != 0)
+    {
+        throw std::runtime_error("Solution has conflicts for N = " +
+                                 std::to_string(this->queensCount));
+    }
+    if(this->winnerName.empty())
+    {
+        throw std::runtime_error("No winner reported");
+    }
+
+    /* A winner must cancel all the other engines */
+    if(val == 0 && !this->engineStop.load())
+    {
+        throw std::runtime_error("Engines were not cancelled");
+    }
+}
+
+/* LCOV_EXCL_STOP */
+#endif
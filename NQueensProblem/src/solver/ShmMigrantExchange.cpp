@@ -0,0 +1,456 @@
+/*******************************************************************************
+ * File: ShmMigrantExchange.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Migrant exchange between the processes of one machine through a POSIX
+ * shared memory ring.
+ ******************************************************************************/
+
+#include <cstdint>    /* Generic int types */
+#include <cstring>    /* memcpy, memset, strerror */
+#include <cerrno>     /* errno, EEXIST, ESRCH */
+#include <string>     /* std::string */
+#include <atomic>     /* std::atomic, std::atomic_thread_fence */
+#include <thread>     /* std::this_thread */
+#include <chrono>     /* std::chrono */
+#include <random>     /* std::random_device */
+#include <fcntl.h>    /* O_CREAT, O_EXCL, O_RDWR */
+#include <unistd.h>   /* ftruncate, close, getpid */
+#include <signal.h>   /* kill */
+#include <sys/mman.h> /* shm_open, shm_unlink, mmap, munmap */
+#include <sys/stat.h> /* fstat */
+
+/* Header file */
+#include <solver/ShmMigrantExchange.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+#define SHM_STATE_READY 0x4D494752U
+
+#define SHM_SEQUENCE_MASK 0xFFFFFFFFULL
+#define SHM_OWNER_SHIFT   32
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+ShmMigrantExchange::ShmMigrantExchange(void)
+{
+    std::random_device rd;
+
+    this->segment        = nullptr;
+    this->segmentSize    = 0;
+    this->individualSize = 0;
+    this->slotCount      = 0;
+    this->slotSize       = 0;
+    this->readIndex      = 0;
+    this->sender         = ((uint64_t)rd() << 32) | rd();
+}
+
+ShmMigrantExchange::~ShmMigrantExchange(void)
+{
+    close();
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+bool ShmMigrantExchange::open(const std::string& name,
+                              const uint32_t     individualSize,
+                              const uint32_t     slotCount,
+                              std::string&       error)
+{
+    int         fd;
+    bool        stale;
+    ino_t       staleInode;
+    struct stat status;
+
+    if(openSegment(name, individualSize, slotCount, stale, staleInode, error))
+    {
+        return true;
+    }
+    if(!stale)
+    {
+        return false;
+    }
+
+    /* The creator died before initializing the segment: replace it, unless
+     * another process already did */
+    fd = shm_open(name.c_str(), O_RDWR, 0);
+    if(fd >= 0)
+    {
+        if(fstat(fd, &status) == 0 && status.st_ino == staleInode)
+        {
+            shm_unlink(name.c_str());
+        }
+        ::close(fd);
+    }
+
+    return openSegment(name, individualSize, slotCount, stale, staleInode,
+                       error);
+}
+
+void ShmMigrantExchange::close(void)
+{
+    if(this->segment != nullptr)
+    {
+        munmap(this->segment, this->segmentSize);
+        this->segment = nullptr;
+    }
+}
+
+void ShmMigrantExchange::remove(const std::string& name)
+{
+    shm_unlink(name.c_str());
+}
+
+bool ShmMigrantExchange::publish(const uint32_t* individual,
+                                 const uint32_t  fitness)
+{
+    uint64_t   index;
+    uint64_t   sequence;
+    ShmSlot*   slot;
+    ShmHeader* header;
+
+    if(this->segment == nullptr)
+    {
+        return false;
+    }
+    header = (ShmHeader*)this->segment;
+
+    index = header->writeIndex.fetch_add(1, std::memory_order_acq_rel);
+    slot  = (ShmSlot*)getSlot(index);
+
+    /* Lock the slot, a publisher that went around the ring may hold it */
+    if(!lockSlot(slot, sequence))
+    {
+        return false;
+    }
+
+    slot->index.store(index, std::memory_order_relaxed);
+    slot->sender  = this->sender;
+    slot->fitness = fitness;
+    memcpy((uint32_t*)(slot + 1), individual,
+           this->individualSize * sizeof(uint32_t));
+
+    return unlockSlot(slot, sequence);
+}
+
+uint32_t ShmMigrantExchange::consume(uint32_t**     individuals,
+                                     uint32_t*      fitness,
+                                     const uint32_t maxCount)
+{
+    uint32_t   i;
+    uint32_t   count;
+    uint32_t   slotFitness;
+    uint64_t   index;
+    uint64_t   first;
+    uint64_t   writeIndex;
+    uint64_t   sequence;
+    uint64_t   slotSender;
+    bool       valid;
+    ShmSlot*   slot;
+    ShmHeader* header;
+
+    if(this->segment == nullptr)
+    {
+        return 0;
+    }
+    header = (ShmHeader*)this->segment;
+
+    writeIndex = header->writeIndex.load(std::memory_order_acquire);
+    first      = this->readIndex;
+    if(writeIndex > this->slotCount && first < writeIndex - this->slotCount)
+    {
+        first = writeIndex - this->slotCount;
+    }
+
+    /* Read the most recent slots first */
+    count = 0;
+    for(index = writeIndex; index > first && count < maxCount; --index)
+    {
+        slot     = (ShmSlot*)getSlot(index - 1);
+        sequence = slot->sequence.load(std::memory_order_acquire);
+        if((sequence & 1) != 0)
+        {
+            /* Free the slots of the dead publishers for the next ones */
+            if(isAbandoned(slot, sequence) && lockSlot(slot, sequence))
+            {
+                slot->index.store(UINT64_MAX, std::memory_order_relaxed);
+                unlockSlot(slot, sequence);
+            }
+            continue;
+        }
+        if(slot->index.load(std::memory_order_relaxed) != index - 1)
+        {
+            continue;
+        }
+
+        slotSender  = slot->sender;
+        slotFitness = slot->fitness;
+        memcpy(individuals[count], (const uint32_t*)(slot + 1),
+               this->individualSize * sizeof(uint32_t));
+
+        /* Drop the copy if a publisher wrote the slot meanwhile */
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(slot->sequence.load(std::memory_order_relaxed) != sequence ||
+           slotSender == this->sender)
+        {
+            continue;
+        }
+
+        /* Only permutations are valid individuals, the crossover operators
+         * rely on it */
+        valid = true;
+        memset(this->seen.data(), 0, this->individualSize);
+        for(i = 0; i < this->individualSize && valid; ++i)
+        {
+            valid = (individuals[count][i] < this->individualSize &&
+                     this->seen[individuals[count][i]] == 0);
+            if(valid)
+            {
+                this->seen[individuals[count][i]] = 1;
+            }
+        }
+        if(valid)
+        {
+            fitness[count] = slotFitness;
+            ++count;
+        }
+    }
+    this->readIndex = writeIndex;
+
+    return count;
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+bool ShmMigrantExchange::openSegment(const std::string& name,
+                                     const uint32_t     individualSize,
+                                     const uint32_t     slotCount,
+                                     bool&              stale,
+                                     ino_t&             staleInode,
+                                     std::string&       error)
+{
+    int         fd;
+    bool        creator;
+    uint32_t    waited;
+    uint64_t    writeIndex;
+    struct stat status;
+    ShmHeader*  header;
+
+    close();
+
+    stale      = false;
+    staleInode = 0;
+
+    if(individualSize == 0 || slotCount == 0)
+    {
+        error = "The migrant exchange needs individuals and slots";
+        return false;
+    }
+
+    /* The first process creates the segment */
+    creator = true;
+    fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if(fd < 0 && errno == EEXIST)
+    {
+        creator = false;
+        fd = shm_open(name.c_str(), O_RDWR, 0);
+    }
+    if(fd < 0)
+    {
+        error = "Cannot open shared memory " + name + ": " + strerror(errno);
+        return false;
+    }
+
+    if(creator)
+    {
+        this->individualSize = individualSize;
+        this->slotCount      = slotCount;
+        this->slotSize       = (sizeof(ShmSlot) +
+                                individualSize * sizeof(uint32_t) + 7) & ~7UL;
+        this->segmentSize    = sizeof(ShmHeader) +
+                               this->slotSize * slotCount;
+        if(ftruncate(fd, this->segmentSize) != 0)
+        {
+            error = "Cannot size shared memory " + name + ": " +
+                    strerror(errno);
+            ::close(fd);
+            shm_unlink(name.c_str());
+            return false;
+        }
+    }
+    else
+    {
+        /* Wait for the creator to size the segment */
+        waited = 0;
+        while(fstat(fd, &status) == 0 &&
+              (size_t)status.st_size < sizeof(ShmHeader) &&
+              waited < MIGRANT_OPEN_TIMEOUT_MS)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            ++waited;
+        }
+        if(fstat(fd, &status) != 0 ||
+           (size_t)status.st_size < sizeof(ShmHeader))
+        {
+            error = "Shared memory " + name + " was not initialized";
+            stale      = true;
+            staleInode = status.st_ino;
+            ::close(fd);
+            return false;
+        }
+        this->segmentSize = status.st_size;
+        staleInode        = status.st_ino;
+    }
+
+    this->segment = (uint8_t*)mmap(nullptr, this->segmentSize,
+                                   PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if(this->segment == MAP_FAILED)
+    {
+        this->segment = nullptr;
+        error = "Cannot map shared memory " + name + ": " + strerror(errno);
+        return false;
+    }
+    header = (ShmHeader*)this->segment;
+
+    if(creator)
+    {
+        header->individualSize = individualSize;
+        header->slotCount      = slotCount;
+        header->writeIndex.store(0, std::memory_order_relaxed);
+        header->state.store(SHM_STATE_READY, std::memory_order_release);
+    }
+    else
+    {
+        /* Wait for the creator to write the header */
+        waited = 0;
+        while(header->state.load(std::memory_order_acquire) !=
+              SHM_STATE_READY &&
+              waited < MIGRANT_OPEN_TIMEOUT_MS)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            ++waited;
+        }
+        if(header->state.load(std::memory_order_acquire) != SHM_STATE_READY)
+        {
+            error = "Shared memory " + name + " was not initialized";
+            stale = true;
+            close();
+            return false;
+        }
+
+        this->individualSize = header->individualSize;
+        this->slotCount      = header->slotCount;
+        this->slotSize       = (sizeof(ShmSlot) +
+                                this->individualSize * sizeof(uint32_t) + 7) &
+                               ~7UL;
+        if(this->individualSize != individualSize ||
+           this->slotCount == 0 ||
+           sizeof(ShmHeader) + this->slotSize * this->slotCount >
+           this->segmentSize)
+        {
+            error = "Shared memory " + name + " holds individuals of size " +
+                    std::to_string(this->individualSize) + ", expected " +
+                    std::to_string(individualSize);
+            close();
+            return false;
+        }
+    }
+
+    this->seen.assign(this->individualSize, 0);
+
+    /* Start with the migrants still in the ring */
+    writeIndex = header->writeIndex.load(std::memory_order_acquire);
+    this->readIndex = (writeIndex > this->slotCount) ?
+                      writeIndex - this->slotCount : 0;
+
+    return true;
+}
+
+uint8_t* ShmMigrantExchange::getSlot(const uint64_t index) const
+{
+    return this->segment + sizeof(ShmHeader) +
+           (index % this->slotCount) * this->slotSize;
+}
+
+bool ShmMigrantExchange::isAbandoned(const ShmSlot* slot,
+                                     const uint64_t sequence) const
+{
+    pid_t    owner;
+    uint64_t lockTime;
+    uint64_t now;
+
+    owner = (pid_t)(sequence >> SHM_OWNER_SHIFT);
+    if(owner > 0 && kill(owner, 0) != 0 && errno == ESRCH)
+    {
+        return true;
+    }
+
+    /* The lock time is zero between the lock and its write, a living owner
+     * writes it right away */
+    lockTime = slot->lockTime.load(std::memory_order_relaxed);
+    now      = std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+                   .count();
+
+    return lockTime != 0 && now > lockTime + MIGRANT_SLOT_TIMEOUT_MS;
+}
+
+bool ShmMigrantExchange::lockSlot(ShmSlot* slot, uint64_t& sequence) const
+{
+    uint64_t current;
+    uint64_t locked;
+
+    current = slot->sequence.load(std::memory_order_relaxed);
+    if((current & 1) != 0 && !isAbandoned(slot, current))
+    {
+        return false;
+    }
+
+    /* Taking an abandoned slot keeps the sequence odd, the readers drop
+     * any copy made across the reclaim */
+    locked = ((uint64_t)getpid() << SHM_OWNER_SHIFT) |
+             ((current + 1 + (current & 1)) & SHM_SEQUENCE_MASK);
+    if(!slot->sequence.compare_exchange_strong(current, locked,
+                                               std::memory_order_acquire))
+    {
+        return false;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot->lockTime.store(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count(),
+        std::memory_order_relaxed);
+    sequence = locked;
+
+    return true;
+}
+
+bool ShmMigrantExchange::unlockSlot(ShmSlot* slot,
+                                    const uint64_t sequence) const
+{
+    uint64_t expected;
+
+    /* A writer stalled past the timeout finds its slot reclaimed and must
+     * not release the new owner's lock */
+    if(slot->sequence.load(std::memory_order_relaxed) != sequence)
+    {
+        return false;
+    }
+    slot->lockTime.store(0, std::memory_order_relaxed);
+    expected = sequence;
+
+    return slot->sequence.compare_exchange_strong(
+        expected,
+        (sequence & ~SHM_SEQUENCE_MASK) | ((sequence + 1) & SHM_SEQUENCE_MASK),
+        std::memory_order_release);
+}
@@ -0,0 +1,246 @@
+/*******************************************************************************
+ * File: SwapLocalSearchOperator.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Local search operator. Implements the LocalSearchOperator interface.
+ * The Swap local search operator swaps conflicted queens with random queens
+ * of the same individual while the swaps reduce the attack count.
+ ******************************************************************************/
+
+#include <cstdint>   /* Generic int types */
+#include <vector>    /* std::vector */
+#include <thread>    /* std::thread */
+#include <algorithm> /* std::min, std::fill */
+#include <random>    /* std::random_device, std::uniform_int_distribution */
+
+/* nsSolver::FitnessCache */
+#include <solver/FitnessCache.h>
+
+/* Header file */
+#include <solver/SwapLocalSearchOperator.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+SwapLocalSearchOperator::SwapLocalSearchOperator(const uint32_t budget,
+                                                 const uint32_t threadCount)
+{
+    this->budget      = budget;
+    this->threadCount = threadCount;
+    if(this->threadCount == 0)
+    {
+        this->threadCount = std::thread::hardware_concurrency();
+    }
+    if(this->threadCount == 0)
+    {
+        this->threadCount = 1;
+    }
+
+    /* Initialize the random generator */
+    std::random_device rd;
+    this->randomGenerator.seed(rd());
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+void SwapLocalSearchOperator::operator()(uint32_t**     individuals,
+                                         const uint32_t individualCount,
+                                         const uint32_t individualSize,
+                                         uint64_t*      hashes,
+                                         uint32_t*      fitness)
+{
+    uint32_t i;
+    uint32_t blockSize;
+    uint32_t threadCount;
+
+    std::vector<std::thread> threads;
+
+    if(individualCount == 0)
+    {
+        return;
+    }
+
+    threadCount = this->threadCount;
+    if(threadCount > individualCount)
+    {
+        threadCount = individualCount;
+    }
+
+    /* Compute the number of parallel blocks */
+    blockSize = individualCount / threadCount;
+    if(individualCount % threadCount != 0)
+    {
+        ++blockSize;
+    }
+
+    for(i = 0; i < threadCount && i * blockSize < individualCount; ++i)
+    {
+        threads.push_back(std::thread(&SwapLocalSearchOperator::searchThread,
+                                      this,
+                                      individuals,
+                                      i * blockSize,
+                                      std::min((i + 1) * blockSize,
+                                               individualCount),
+                                      individualSize,
+                                      hashes,
+                                      fitness,
+                                      (uint32_t)this->randomGenerator()));
+    }
+    for(i = 0; i < threads.size(); ++i)
+    {
+        threads[i].join();
+    }
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+void SwapLocalSearchOperator::searchThread(uint32_t**     individuals,
+                                           const uint32_t start,
+                                           const uint32_t end,
+                                           const uint32_t individualSize,
+                                           uint64_t*      hashes,
+                                           uint32_t*      fitness,
+                                           const uint32_t seed)
+{
+    uint32_t  i;
+    uint32_t  j;
+    uint32_t  k;
+    uint32_t  tries;
+    uint32_t  cursor;
+    uint32_t  scanned;
+    uint32_t  colA;
+    uint32_t  colB;
+    uint32_t  lineA;
+    uint32_t  lineB;
+    uint32_t  shift;
+    uint32_t* individual;
+    int64_t   attacks;
+    int64_t   oldAttacks;
+    int64_t   newAttacks;
+
+    std::vector<uint32_t> lines(individualSize, 0);
+    std::vector<uint32_t> diagUp(2 * individualSize, 0);
+    std::vector<uint32_t> diagDown(2 * individualSize, 0);
+
+    std::default_random_engine              generator(seed);
+    std::uniform_int_distribution<uint32_t> randColumn(0, individualSize - 1);
+
+    if(individualSize == 0)
+    {
+        return;
+    }
+
+    shift = individualSize - 1;
+    for(i = start; i < end; ++i)
+    {
+        individual = individuals[i];
+
+        /* Count the queens on each line and diagonal */
+        std::fill(lines.begin(), lines.end(), 0);
+        std::fill(diagUp.begin(), diagUp.end(), 0);
+        std::fill(diagDown.begin(), diagDown.end(), 0);
+        for(j = 0; j < individualSize; ++j)
+        {
+            ++lines[individual[j]];
+            ++diagUp[j + individual[j]];
+            ++diagDown[j + shift - individual[j]];
+        }
+
+        /* Each counter c holds c(c - 1) / 2 attacks */
+        attacks = 0;
+        for(j = 0; j < 2 * individualSize; ++j)
+        {
+            attacks += (int64_t)diagUp[j] * ((int64_t)diagUp[j] - 1) / 2;
+            attacks += (int64_t)diagDown[j] * ((int64_t)diagDown[j] - 1) / 2;
+            if(j < individualSize)
+            {
+                attacks += (int64_t)lines[j] * ((int64_t)lines[j] - 1) / 2;
+            }
+        }
+
+        /* Swap conflicted queens while the budget allows it, swaps keep the
+         * line counters unchanged. The conflicted queens are found with a
+         * rotating cursor, the search stops after a full pass without any.
+         */
+        tries = this->budget * individualSize;
+        if(individualSize < 2)
+        {
+            tries = 0;
+        }
+        cursor  = randColumn(generator);
+        scanned = 0;
+        while(tries != 0 && attacks != 0 && scanned < individualSize)
+        {
+            colA   = cursor;
+            lineA  = individual[colA];
+            cursor = (cursor + 1) % individualSize;
+            ++scanned;
+            if(diagUp[colA + lineA] < 2 && diagDown[colA + shift - lineA] < 2)
+            {
+                continue;
+            }
+            scanned = 0;
+
+            for(k = 0; k < LS_SWAP_TRIES && tries != 0; ++k)
+            {
+                --tries;
+                colB  = randColumn(generator);
+                lineB = individual[colB];
+                if(colA == colB)
+                {
+                    continue;
+                }
+
+                /* Remove both queens, then count the attacks each placement
+                 * adds back */
+                --diagUp[colA + lineA];
+                --diagDown[colA + shift - lineA];
+                --diagUp[colB + lineB];
+                --diagDown[colB + shift - lineB];
+
+                oldAttacks = (int64_t)diagUp[colA + lineA] +
+                             diagDown[colA + shift - lineA] +
+                             diagUp[colB + lineB] +
+                             diagDown[colB + shift - lineB] +
+                             (colA + lineA == colB + lineB) +
+                             (colA + shift - lineA == colB + shift - lineB);
+                newAttacks = (int64_t)diagUp[colA + lineB] +
+                             diagDown[colA + shift - lineB] +
+                             diagUp[colB + lineA] +
+                             diagDown[colB + shift - lineA] +
+                             (colA + lineB == colB + lineA) +
+                             (colA + shift - lineB == colB + shift - lineA);
+
+                if(newAttacks < oldAttacks)
+                {
+                    hashes[i] = FitnessCache::swapHash(hashes[i], colA, lineA,
+                                                       colB, lineB);
+                    individual[colA] = lineB;
+                    individual[colB] = lineA;
+                    attacks += newAttacks - oldAttacks;
+                }
+
+                ++diagUp[colA + individual[colA]];
+                ++diagDown[colA + shift - individual[colA]];
+                ++diagUp[colB + individual[colB]];
+                ++diagDown[colB + shift - individual[colB]];
+
+                if(newAttacks < oldAttacks)
+                {
+                    break;
+                }
+            }
+        }
+
+        fitness[i] = (uint32_t)attacks;
+    }
+}
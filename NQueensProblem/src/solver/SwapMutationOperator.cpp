@@ -52,10 +52,12 @@ void SwapMutationOperator::operator()(uint32_t**             population,
     std::uniform_int_distribution<uint32_t> distributionInt;
 
     /* Vector of pair : key = fitness, value = index */
-    std::vector<std::pair<uint32_t, uint32_t>> fitIndex(populationSize);
+    std::vector<std::pair<uint32_t, uint32_t>> fitIndex;
 
     /* Get the less fittest individuals */
     selection.clear();
+    this->swappedGenes.clear();
+    fitIndex.reserve(populationSize);
     for(i = 0; i < populationSize; ++i)
     {
         fitIndex.push_back(std::make_pair(popFitness[i], i));
@@ -83,7 +85,24 @@ void SwapMutationOperator::operator()(uint32_t**             population,
         population[fitIndex[i].second][startIndex] =
             population[fitIndex[i].second][endIndex];
         population[fitIndex[i].second][endIndex] = tmp;
+
+        this->swappedGenes.push_back(std::make_pair(startIndex, endIndex));
+    }
+}
+
+bool SwapMutationOperator::getSwappedGenes(const uint32_t rank,
+                                           uint32_t&      geneA,
+                                           uint32_t&      geneB) const
+{
+    if(rank >= this->swappedGenes.size())
+    {
+        return false;
     }
+
+    geneA = this->swappedGenes[rank].first;
+    geneB = this->swappedGenes[rank].second;
+
+    return true;
 }
 
 /*******************************************************************************
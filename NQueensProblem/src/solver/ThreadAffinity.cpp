@@ -0,0 +1,202 @@
+/*******************************************************************************
+ * File: ThreadAffinity.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Placement of the solver worker threads on the cores and NUMA nodes of the
+ * machine.
+ ******************************************************************************/
+
+#include <cstdint>   /* Generic int types */
+#include <string>    /* std::string, std::stoul */
+#include <vector>    /* std::vector */
+#include <fstream>   /* std::ifstream */
+#include <sstream>   /* std::istringstream */
+#include <stdexcept> /* std::exception */
+#include <pthread.h> /* pthread_setaffinity_np, pthread_self */
+#include <sched.h>   /* sched_getaffinity, cpu_set_t, CPU_* */
+
+/* Header file */
+#include <solver/ThreadAffinity.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+ThreadAffinity::ThreadAffinity(void)
+{
+    uint32_t  i;
+    uint32_t  node;
+    uint32_t  missing;
+    cpu_set_t allowed;
+    cpu_set_t placed;
+
+    std::string           list;
+    std::vector<uint32_t> nodeCpus;
+
+    CPU_ZERO(&allowed);
+    CPU_ZERO(&placed);
+    if(sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+    {
+        for(i = 0; i < CPU_SETSIZE; ++i)
+        {
+            CPU_SET(i, &allowed);
+        }
+    }
+
+    /* Group the allowed cores by node, node numbers may have holes */
+    this->nodeCount = 0;
+    missing         = 0;
+    for(node = 0; node < CPU_SETSIZE && missing < 64; ++node)
+    {
+        std::ifstream file(std::string(AFFINITY_NODE_PATH) + "/node" +
+                           std::to_string(node) + "/cpulist");
+        if(!file.is_open())
+        {
+            ++missing;
+            continue;
+        }
+        missing = 0;
+
+        if(!std::getline(file, list) || !parseCpuList(list, nodeCpus))
+        {
+            continue;
+        }
+        for(i = 0; i < nodeCpus.size(); ++i)
+        {
+            if(nodeCpus[i] < CPU_SETSIZE && CPU_ISSET(nodeCpus[i], &allowed) &&
+               !CPU_ISSET(nodeCpus[i], &placed))
+            {
+                CPU_SET(nodeCpus[i], &placed);
+                this->cpus.push_back(nodeCpus[i]);
+                this->cpuNodes.push_back(this->nodeCount);
+            }
+        }
+        if(this->cpuNodes.size() != 0 &&
+           this->cpuNodes.back() == this->nodeCount)
+        {
+            ++this->nodeCount;
+        }
+    }
+
+    /* Cores unknown to sysfs go to the first node */
+    for(i = 0; i < CPU_SETSIZE; ++i)
+    {
+        if(CPU_ISSET(i, &allowed) && !CPU_ISSET(i, &placed))
+        {
+            this->cpus.push_back(i);
+            this->cpuNodes.push_back(0);
+        }
+    }
+    if(this->nodeCount == 0)
+    {
+        this->nodeCount = 1;
+    }
+    if(this->cpus.size() == 0)
+    {
+        this->cpus.push_back(0);
+        this->cpuNodes.push_back(0);
+    }
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+uint32_t ThreadAffinity::getCpuCount(void) const
+{
+    return this->cpus.size();
+}
+
+uint32_t ThreadAffinity::getNodeCount(void) const
+{
+    return this->nodeCount;
+}
+
+uint32_t ThreadAffinity::getCpu(const uint32_t worker) const
+{
+    return this->cpus[worker % this->cpus.size()];
+}
+
+uint32_t ThreadAffinity::getNode(const uint32_t worker) const
+{
+    return this->cpuNodes[worker % this->cpuNodes.size()];
+}
+
+bool ThreadAffinity::pin(const uint32_t worker) const
+{
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(getCpu(worker), &set);
+
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+bool ThreadAffinity::unpin(void) const
+{
+    uint32_t  i;
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    for(i = 0; i < this->cpus.size(); ++i)
+    {
+        CPU_SET(this->cpus[i], &set);
+    }
+
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+bool ThreadAffinity::parseCpuList(const std::string&     list,
+                                  std::vector<uint32_t>& cpus)
+{
+    size_t      separator;
+    uint32_t    first;
+    uint32_t    last;
+    uint32_t    cpu;
+    std::string range;
+
+    std::istringstream ranges(list);
+
+    cpus.clear();
+    try
+    {
+        while(std::getline(ranges, range, ','))
+        {
+            range.erase(0, range.find_first_not_of(" \t\n"));
+            range.erase(range.find_last_not_of(" \t\n") + 1);
+            if(range.empty())
+            {
+                continue;
+            }
+
+            separator = range.find('-');
+            first     = std::stoul(range.substr(0, separator));
+            last      = first;
+            if(separator != std::string::npos)
+            {
+                last = std::stoul(range.substr(separator + 1));
+            }
+            if(last < first)
+            {
+                cpus.clear();
+                return false;
+            }
+            for(cpu = first; cpu <= last; ++cpu)
+            {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    catch(const std::exception&)
+    {
+        cpus.clear();
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,36 @@
+#include <iostream>
+
+#include "solver/ConstructiveSolver.h"
+
+using namespace nsSolver;
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    uint32_t i;
+    ConstructiveSolver* solver;
+
+    /* Covers every N mod 6 class several times, plus the unsolvable sizes */
+    for(i = 0; i < 300; ++i)
+    {
+        solver = new ConstructiveSolver(i);
+        solver->testSolve();
+        delete solver;
+    }
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
@@ -0,0 +1,174 @@
+#include <solver/CycleCrossoverOperator.h>
+#include <solver/FitnessCache.h>
+
+#include <iostream>  /* std::cout, std::endl */
+#include <cstring>   /* strncmp */
+#include <algorithm> /* std::sort */
+#include <iomanip>   /* std::setw */
+#include <stdexcept> /* std::runtime_exception */
+#include <set>       /* std::set */
+#include <vector>    /* std::vector */
+
+using namespace nsSolver;
+
+#define POP_SIZE        100U
+#define SELECTION_COUNT 100U
+#define QUEENSCOUNT     100U
+
+static void initPopulation(uint32_t* individual)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t index;
+    std::random_device rd;
+    std::default_random_engine randomGenerator;
+    randomGenerator.seed(rd());
+
+    std::set<uint32_t> possiblePos;
+
+    std::uniform_int_distribution<uint32_t> randGen;
+
+    /* Init the possible position set */
+    for(i = 0; i < QUEENSCOUNT; ++i)
+    {
+        possiblePos.insert(i);
+    }
+
+    /* With the set of possible position, we avoid multiple queens on the
+        * same line
+        * This is only usefull when using crossover and mutations operators
+        * that keep the number of queens on one line contant.
+        */
+    for(j = 0; j < QUEENSCOUNT; ++j)
+    {
+        randGen =
+        std::uniform_int_distribution<uint32_t>(0,
+                                                possiblePos.size() - 1);
+        std::set<uint32_t>::const_iterator it(possiblePos.begin());
+        index = randGen(randomGenerator);
+        std::advance(it, index);
+        individual[j] = *it;
+        possiblePos.erase(it);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+    uint32_t **pop = new uint32_t*[POP_SIZE];
+    uint32_t *matePool = new uint32_t[POP_SIZE];
+    uint32_t **children = new uint32_t*[POP_SIZE];
+    uint64_t *popHash = new uint64_t[POP_SIZE];
+    uint64_t *childrenHash = new uint64_t[POP_SIZE];
+    std::vector<bool> seen;
+
+    for(i = 0; i < POP_SIZE; ++i)
+    {
+        pop[i] = new uint32_t[QUEENSCOUNT];
+        children[i] = new uint32_t[QUEENSCOUNT];
+        initPopulation(pop[i]);
+        popHash[i] = FitnessCache::getHash(pop[i], QUEENSCOUNT);
+        matePool[i] = i;
+    }
+
+    CycleCrossoverOperator crossover;
+
+    crossover(QUEENSCOUNT, (const uint32_t **)pop, POP_SIZE, popHash,
+              (const uint32_t *)matePool, 0, children,
+              childrenHash);
+
+    /* Mate twice to check the tables kept between calls */
+    for(k = 0; k < 2; ++k)
+    {
+        crossover(QUEENSCOUNT, (const uint32_t **)pop, POP_SIZE, popHash,
+                  (const uint32_t *)matePool, POP_SIZE, children,
+                  childrenHash);
+
+        for(i = 0; i < POP_SIZE; ++i)
+        {
+            seen = std::vector<bool>(QUEENSCOUNT, false);
+            for(j = 0; j < QUEENSCOUNT; ++j)
+            {
+                if(children[i][j] >= QUEENSCOUNT || seen[children[i][j]])
+                {
+                    throw std::runtime_error("Children has duplicate!");
+                }
+                seen[children[i][j]] = true;
+            }
+            if(childrenHash[i] != FitnessCache::getHash(children[i],
+                                                        QUEENSCOUNT))
+            {
+                throw std::runtime_error("Child hash is wrong!");
+            }
+        }
+    }
+
+    /* Each gene comes from one parent at the same column, the two children of
+     * a pair take complementary genes */
+    for(i = 0; i < POP_SIZE; i += 2)
+    {
+        for(j = 0; j < QUEENSCOUNT; ++j)
+        {
+            if(!((children[i][j] == pop[i][j] &&
+                  children[i + 1][j] == pop[i + 1][j]) ||
+                 (children[i][j] == pop[i + 1][j] &&
+                  children[i + 1][j] == pop[i][j])))
+            {
+                throw std::runtime_error("Gene moved to another column!");
+            }
+        }
+    }
+
+    /* Identical parents give identical children */
+    for(i = 0; i < POP_SIZE; ++i)
+    {
+        matePool[i] = 0;
+    }
+    crossover(QUEENSCOUNT, (const uint32_t **)pop, POP_SIZE, popHash,
+              (const uint32_t *)matePool, POP_SIZE, children,
+              childrenHash);
+    for(i = 0; i < POP_SIZE; ++i)
+    {
+        for(j = 0; j < QUEENSCOUNT; ++j)
+        {
+            if(children[i][j] != pop[0][j])
+            {
+                throw std::runtime_error("Clone parents changed the child!");
+            }
+        }
+        if(childrenHash[i] != popHash[0])
+        {
+            throw std::runtime_error("Clone parents changed the hash!");
+        }
+    }
+
+    for(i = 0; i < POP_SIZE; ++i)
+    {
+        delete[] pop[i];
+        delete[] children[i];
+    }
+    delete[] pop;
+    delete[] matePool;
+    delete[] children;
+    delete[] popHash;
+    delete[] childrenHash;
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
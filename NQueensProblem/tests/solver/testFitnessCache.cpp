@@ -0,0 +1,153 @@
+#include <solver/FitnessCache.h>
+
+#include <iostream>  /* std::cout, std::endl */
+#include <vector>    /* std::vector */
+#include <thread>    /* std::thread */
+#include <random>    /* std::random_device, std::default_random_engine */
+#include <algorithm> /* std::shuffle, std::swap */
+#include <stdexcept> /* std::runtime_exception */
+
+using namespace nsSolver;
+
+#define CACHE_SLOTS    1024U
+#define INDIV_SIZE     100U
+#define SWAPS          10000U
+#define THREAD_COUNT   4U
+#define THREAD_STORES  100000U
+
+static uint32_t getFitness(const uint64_t hash)
+{
+    return hash % 5000;
+}
+
+static void storeThread(FitnessCache* cache, const uint32_t seed)
+{
+    uint32_t i;
+    uint64_t hash;
+    uint32_t fitness;
+
+    std::default_random_engine randomGenerator(seed);
+
+    /* Writers race on the same slots, readers must never see a torn entry */
+    for(i = 0; i < THREAD_STORES; ++i)
+    {
+        hash = ((uint64_t)randomGenerator() << 32) | randomGenerator();
+        cache->store(hash, getFitness(hash));
+
+        hash = ((uint64_t)randomGenerator() << 32) | (i % CACHE_SLOTS);
+        if(cache->lookup(hash, fitness) && fitness != getFitness(hash))
+        {
+            throw std::runtime_error("Torn entry read from cache");
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    uint32_t i;
+    uint32_t colA;
+    uint32_t colB;
+    uint32_t fitness;
+    uint64_t hash;
+
+    std::vector<uint32_t>    individual(INDIV_SIZE);
+    std::vector<std::thread> threads;
+
+    std::random_device rd;
+    std::default_random_engine randomGenerator(rd());
+    std::uniform_int_distribution<uint32_t> randColumn(0, INDIV_SIZE - 1);
+
+    FitnessCache cache(CACHE_SLOTS - 1);
+
+    /* Empty cache */
+    if(cache.lookup(42, fitness))
+    {
+        throw std::runtime_error("Empty cache returned a fitness");
+    }
+
+    /* Store and lookup, including the zero fitness */
+    cache.store(42, 0);
+    cache.store(43, 17);
+    if(!cache.lookup(42, fitness) || fitness != 0)
+    {
+        throw std::runtime_error("Wrong zero fitness lookup");
+    }
+    if(!cache.lookup(43, fitness) || fitness != 17)
+    {
+        throw std::runtime_error("Wrong fitness lookup");
+    }
+
+    /* Colliding hashes replace each other */
+    cache.store(42 + CACHE_SLOTS, 5);
+    if(cache.lookup(42, fitness))
+    {
+        throw std::runtime_error("Replaced entry returned a fitness");
+    }
+    if(!cache.lookup(42 + CACHE_SLOTS, fitness) || fitness != 5)
+    {
+        throw std::runtime_error("Wrong replacing fitness lookup");
+    }
+
+    /* Statistics */
+    cache.addStats(3, 4);
+    cache.addStats(1, 1);
+    if(cache.getHits() != 4 || cache.getMisses() != 5)
+    {
+        throw std::runtime_error("Wrong cache statistics");
+    }
+    cache.clear();
+    if(cache.getHits() != 0 || cache.getMisses() != 0 ||
+       cache.lookup(43, fitness))
+    {
+        throw std::runtime_error("Cache was not cleared");
+    }
+
+    /* Incremental hash on swaps */
+    for(i = 0; i < INDIV_SIZE; ++i)
+    {
+        individual[i] = i;
+    }
+    std::shuffle(individual.begin(), individual.end(), randomGenerator);
+    hash = FitnessCache::getHash(individual.data(), INDIV_SIZE);
+    for(i = 0; i < SWAPS; ++i)
+    {
+        colA = randColumn(randomGenerator);
+        colB = randColumn(randomGenerator);
+        hash = FitnessCache::swapHash(hash, colA, individual[colA],
+                                      colB, individual[colB]);
+        std::swap(individual[colA], individual[colB]);
+
+        if(hash != FitnessCache::getHash(individual.data(), INDIV_SIZE))
+        {
+            throw std::runtime_error("Wrong incremental hash after swap " +
+                                     std::to_string(i));
+        }
+    }
+
+    /* Concurrent stores and lookups */
+    for(i = 0; i < THREAD_COUNT; ++i)
+    {
+        threads.push_back(std::thread(storeThread, &cache, rd()));
+    }
+    for(i = 0; i < THREAD_COUNT; ++i)
+    {
+        threads[i].join();
+    }
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
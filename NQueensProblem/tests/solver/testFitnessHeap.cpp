@@ -0,0 +1,97 @@
+#include <solver/FitnessHeap.h>
+
+#include <iostream>  /* std::cout, std::endl */
+#include <random>    /* std::random_device, std::default_random_engine */
+#include <stdexcept> /* std::runtime_exception */
+
+using namespace nsSolver;
+
+#define POP_SIZE    1000U
+#define UPDATES     100000U
+#define MAX_FITNESS 5000U
+
+static uint32_t getWorst(const uint32_t* popFitness)
+{
+    uint32_t i;
+    uint32_t worst;
+
+    worst = 0;
+    for(i = 1; i < POP_SIZE; ++i)
+    {
+        if(popFitness[i] > popFitness[worst])
+        {
+            worst = i;
+        }
+    }
+
+    return worst;
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    uint32_t  i;
+    uint32_t  index;
+    uint32_t* popFitness = new uint32_t[POP_SIZE];
+
+    std::random_device rd;
+    std::default_random_engine randomGenerator(rd());
+    std::uniform_int_distribution<uint32_t> randIndex(0, POP_SIZE - 1);
+    std::uniform_int_distribution<uint32_t> randFitness(0, MAX_FITNESS);
+
+    for(i = 0; i < POP_SIZE; ++i)
+    {
+        popFitness[i] = randFitness(randomGenerator);
+    }
+
+    FitnessHeap heap(POP_SIZE);
+    heap.build(popFitness, POP_SIZE);
+
+    if(popFitness[heap.top()] != popFitness[getWorst(popFitness)])
+    {
+        throw std::runtime_error("Wrong worst individual after build");
+    }
+
+    /* Replace the worst individual or update a random one */
+    for(i = 0; i < UPDATES; ++i)
+    {
+        if(i % 2 == 0)
+        {
+            index = heap.top();
+        }
+        else
+        {
+            index = randIndex(randomGenerator);
+        }
+        popFitness[index] = randFitness(randomGenerator);
+        heap.update(index, popFitness[index]);
+
+        if(heap.getFitness(index) != popFitness[index])
+        {
+            throw std::runtime_error("Wrong fitness stored in heap");
+        }
+        if(popFitness[heap.top()] != popFitness[getWorst(popFitness)])
+        {
+            throw std::runtime_error("Wrong worst individual after update " +
+                                     std::to_string(i));
+        }
+    }
+
+    delete[] popFitness;
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
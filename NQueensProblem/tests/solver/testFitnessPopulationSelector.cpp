@@ -27,6 +27,8 @@ int main(int argc, char** argv)
     uint32_t* children[POP_SIZE];
     uint32_t fitness[POP_SIZE] = {16, 4, 3, 32, 5};
     uint32_t childrenFitness[POP_SIZE] = {20, 15, 40, 5, 22};
+    uint64_t hash[POP_SIZE] = {0, 1, 2, 3, 4};
+    uint64_t childrenHash[POP_SIZE] = {5, 6, 7, 8, 9};
 
     FitnessPopulationSelector selector;
 
@@ -47,9 +49,11 @@ int main(int argc, char** argv)
     selector((uint32_t**)pop,
              POP_SIZE,
              (uint32_t*)fitness,
+             (uint64_t*)hash,
              (const uint32_t**)children,
              POP_SIZE,
              (const uint32_t*)childrenFitness,
+             (const uint64_t*)childrenHash,
              4);
 
     if(fitness[0] != 5 ||
@@ -62,6 +66,11 @@ int main(int argc, char** argv)
     }
     for(i = 0; i < POP_SIZE; ++i)
     {
+        /* The hash follows the genes */
+        if(hash[i] != pop[i][0])
+        {
+            throw std::runtime_error("Wrong population hash");
+        }
         for(j = 0; j < 4; ++j)
         {
             if(i == 0 && pop[i][j] != 8)
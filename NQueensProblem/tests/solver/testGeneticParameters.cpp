@@ -0,0 +1,181 @@
+#include <solver/GeneticParameters.h>
+
+#include <iostream>  /* std::cout, std::endl */
+#include <fstream>   /* std::ofstream */
+#include <string>    /* std::string */
+#include <cstdio>    /* std::remove */
+#include <stdexcept> /* std::runtime_exception */
+
+using namespace nsSolver;
+
+#define CONFIG_PATH "/tmp/testGeneticParameters.cfg"
+#define TABLE_PATH  "/tmp/testGeneticParameters.table"
+
+static void checkTable(const uint32_t queensCount,
+                       const uint32_t expectedPopulation)
+{
+    std::string       error;
+    GeneticParameters parameters;
+
+    if(!parameters.loadTable(TABLE_PATH, queensCount, error))
+    {
+        throw std::runtime_error("Table not loaded: " + error);
+    }
+    if(parameters.populationSize != expectedPopulation)
+    {
+        throw std::runtime_error("Wrong table entry for N = " +
+                                 std::to_string(queensCount) + ": " +
+                                 std::to_string(parameters.populationSize));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    std::string       error;
+    std::ofstream     file;
+    GeneticParameters parameters;
+    GeneticParameters loaded;
+    GeneticParameters bounded;
+
+    /* Configuration file */
+    file.open(CONFIG_PATH);
+    file << "# Comment" << std::endl
+         << std::endl
+         << "population = 80" << std::endl
+         << "  mating-pool=40  " << std::endl
+         << "adaptive=1" << std::endl;
+    file.close();
+    if(!parameters.loadFile(CONFIG_PATH, error) ||
+       parameters.populationSize != 80 || parameters.matingPoolSize != 40 ||
+       !parameters.adaptiveRates)
+    {
+        throw std::runtime_error("Configuration file not applied: " + error);
+    }
+
+    file.open(CONFIG_PATH);
+    file << "population" << std::endl;
+    file.close();
+    if(parameters.loadFile(CONFIG_PATH, error))
+    {
+        throw std::runtime_error("Malformed configuration file accepted");
+    }
+    if(parameters.loadFile("/nonexistent/file", error))
+    {
+        throw std::runtime_error("Missing configuration file accepted");
+    }
+
+    /* Negative and out of range counts do not wrap around */
+    if(parameters.set("population", "-1", error) ||
+       parameters.set("mutation-size", " -5", error) ||
+       parameters.populationSize != 80)
+    {
+        throw std::runtime_error("Negative count accepted");
+    }
+    if(parameters.set("population", "4294967296", error) ||
+       parameters.set("injection-pool", "99999999999999999999999", error) ||
+       parameters.populationSize != 80)
+    {
+        throw std::runtime_error("Out of range count accepted");
+    }
+    if(!parameters.set("population", "4294967295", error) ||
+       parameters.populationSize != UINT32_MAX ||
+       !parameters.set("population", "80", error))
+    {
+        throw std::runtime_error("Largest count not set: " + error);
+    }
+
+    /* The injection pool is bounded by the population */
+    if(!bounded.validate(error))
+    {
+        throw std::runtime_error("Valid parameters rejected: " + error);
+    }
+    bounded.set("injection-pool", "101", error);
+    if(bounded.validate(error))
+    {
+        throw std::runtime_error("Injection pool above population accepted");
+    }
+    bounded.set("injection-pool", "100", error);
+    if(!bounded.validate(error))
+    {
+        throw std::runtime_error("Injection pool of the population rejected");
+    }
+
+    /* Crossover operator names */
+    if(!parameters.set("crossover-operator", "pmx", error) ||
+       parameters.crossoverOperator != "pmx")
+    {
+        throw std::runtime_error("Crossover operator not set: " + error);
+    }
+    if(parameters.set("crossover-operator", "pmx2", error) ||
+       parameters.crossoverOperator != "pmx")
+    {
+        throw std::runtime_error("Unknown crossover operator accepted");
+    }
+
+    /* Huge page modes */
+    if(!parameters.set("huge-pages", "transparent", error) ||
+       parameters.hugePages != "transparent")
+    {
+        throw std::runtime_error("Huge page mode not set: " + error);
+    }
+    if(parameters.set("huge-pages", "always", error) ||
+       parameters.hugePages != "transparent")
+    {
+        throw std::runtime_error("Unknown huge page mode accepted");
+    }
+
+    /* Round trip through a table */
+    parameters.crossoverProba    = 0.75;
+    parameters.mutationSize      = 33;
+    parameters.crossoverOperator = "cycle";
+    parameters.hugePages         = "explicit";
+    file.open(TABLE_PATH);
+    file << "# Table" << std::endl
+         << "N=64 population=64" << std::endl
+         << "N=16 " << parameters.toString() << std::endl
+         << "N=256 population=256" << std::endl;
+    file.close();
+
+    if(!loaded.loadTable(TABLE_PATH, 20, error) ||
+       loaded.toString() != parameters.toString())
+    {
+        throw std::runtime_error("Wrong table round trip: " +
+                                 loaded.toString() + " " + error);
+    }
+
+    /* Closest size selection */
+    checkTable(8, 80);
+    checkTable(16, 80);
+    checkTable(63, 80);
+    checkTable(64, 64);
+    checkTable(255, 64);
+    checkTable(1000000, 256);
+
+    file.open(TABLE_PATH);
+    file << "64 population=64" << std::endl;
+    file.close();
+    if(loaded.loadTable(TABLE_PATH, 64, error))
+    {
+        throw std::runtime_error("Malformed table accepted");
+    }
+
+    std::remove(CONFIG_PATH);
+    std::remove(TABLE_PATH);
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
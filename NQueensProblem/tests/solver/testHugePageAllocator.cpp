@@ -0,0 +1,126 @@
+#include <solver/HugePageAllocator.h>
+#include <solver/GeneticParameters.h>
+#include <solver/GeneticSolver.h>
+
+#include <iostream>  /* std::cout, std::endl */
+#include <cstdint>   /* uint8_t, uintptr_t */
+#include <cstring>   /* memset */
+#include <string>    /* std::string */
+#include <stdexcept> /* std::runtime_exception */
+
+using namespace nsSolver;
+
+/* Allocates, writes and releases buffers of several sizes */
+static void checkMode(const HugePageMode mode)
+{
+    uint8_t* small;
+    uint8_t* large;
+    size_t   largeSize;
+
+    HugePageAllocator allocator(mode);
+
+    if(allocator.getMode() != mode || allocator.allocate(0) != nullptr)
+    {
+        throw std::runtime_error("Wrong allocator initialization");
+    }
+
+    /* Small buffers always come from the heap */
+    small = (uint8_t*)allocator.allocate(100);
+    if(small == nullptr || allocator.getBacking(small) != HUGE_PAGES_OFF)
+    {
+        throw std::runtime_error("Wrong small buffer");
+    }
+    memset(small, 0xA5, 100);
+
+    /* Large buffers get the requested mode or one of its fallbacks, the
+     * memory is usable in every case */
+    largeSize = 3 * HUGE_PAGE_SIZE + 12;
+    large     = (uint8_t*)allocator.allocate(largeSize);
+    if(large == nullptr || allocator.getBacking(large) > mode)
+    {
+        throw std::runtime_error("Wrong large buffer backing in mode " +
+                                 std::string(
+                                    HugePageAllocator::getModeName(mode)));
+    }
+    if(allocator.getBacking(large) != HUGE_PAGES_OFF &&
+       ((uintptr_t)large % HUGE_PAGE_SIZE) != 0)
+    {
+        throw std::runtime_error("Huge page buffer not aligned");
+    }
+    memset(large, 0x5A, largeSize);
+    if(large[0] != 0x5A || large[largeSize - 1] != 0x5A || small[99] != 0xA5)
+    {
+        throw std::runtime_error("Wrong buffer content");
+    }
+    if(allocator.getBackedBytes(allocator.getBacking(large)) < largeSize)
+    {
+        throw std::runtime_error("Wrong backed bytes");
+    }
+
+    allocator.release(small);
+    allocator.release(nullptr);
+    if(allocator.getBackedBytes(HUGE_PAGES_OFF) != 0 &&
+       allocator.getBacking(large) != HUGE_PAGES_OFF)
+    {
+        throw std::runtime_error("Small buffer not released");
+    }
+
+    /* The large buffer is released with the allocator */
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    HugePageMode      mode;
+    GeneticParameters parameters;
+
+    /* Mode names */
+    if(!HugePageAllocator::parseMode("off", mode) || mode != HUGE_PAGES_OFF ||
+       !HugePageAllocator::parseMode("transparent", mode) ||
+       mode != HUGE_PAGES_TRANSPARENT ||
+       !HugePageAllocator::parseMode("explicit", mode) ||
+       mode != HUGE_PAGES_EXPLICIT ||
+       HugePageAllocator::parseMode("always", mode))
+    {
+        throw std::runtime_error("Wrong mode parsing");
+    }
+    if(std::string(HugePageAllocator::getModeName(HUGE_PAGES_EXPLICIT)) !=
+       "explicit")
+    {
+        throw std::runtime_error("Wrong mode name");
+    }
+
+    checkMode(HUGE_PAGES_OFF);
+    checkMode(HUGE_PAGES_TRANSPARENT);
+    checkMode(HUGE_PAGES_EXPLICIT);
+
+    /* Solver populations in huge pages, 200 individuals of 2000 queens
+     * fill one huge page */
+    parameters.hugePages = "explicit";
+    parameters.populationSize = 200;
+    GeneticSolver solver(2000, 2, parameters);
+    if(solver.getHugePageBacking() == HUGE_PAGES_OFF)
+    {
+        throw std::runtime_error("Population not in huge pages");
+    }
+    solver.testInitPopulation();
+
+    GeneticSolver smallSolver(40, 2000, parameters);
+    smallSolver.testSolve();
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
@@ -0,0 +1,405 @@
+#include <solver/FileMigrantExchange.h>
+#include <solver/ShmMigrantExchange.h>
+#include <solver/GeneticSolver.h>
+
+#include <iostream>   /* std::cout, std::endl */
+#include <fstream>    /* std::ofstream */
+#include <string>     /* std::string */
+#include <vector>     /* std::vector */
+#include <cstdio>     /* std::remove */
+#include <stdexcept>  /* std::runtime_exception */
+#include <chrono>     /* std::chrono */
+#include <unistd.h>   /* rmdir, getpid, close, ftruncate, fork */
+#include <fcntl.h>    /* O_CREAT, O_RDWR */
+#include <sys/mman.h> /* shm_open, mmap */
+#include <sys/stat.h> /* fstat */
+#include <sys/wait.h> /* waitpid */
+
+using namespace nsSolver;
+
+#define EXCHANGE_DIR "/tmp/testMigrantExchange"
+#define SHM_NAME     "/testMigrantExchange"
+#define SIZE         8U
+#define SLOTS        4U
+
+/* Records the published fitness and never provides migrants */
+class RecordingExchange : public MigrantExchange
+{
+    public:
+        std::vector<uint32_t> published;
+
+        bool publish(const uint32_t* individual, const uint32_t fitness)
+        {
+            (void)individual;
+            this->published.push_back(fitness);
+            return true;
+        }
+
+        uint32_t consume(uint32_t**     individuals,
+                         uint32_t*      fitness,
+                         const uint32_t maxCount)
+        {
+            (void)individuals;
+            (void)fitness;
+            (void)maxCount;
+            return 0;
+        }
+};
+
+static void makeIndividual(uint32_t* individual, const uint32_t shift)
+{
+    uint32_t i;
+
+    for(i = 0; i < SIZE; ++i)
+    {
+        individual[i] = (i + shift) % SIZE;
+    }
+}
+
+static void checkConsume(MigrantExchange&   exchange,
+                         const uint32_t     expectedCount,
+                         const uint32_t     expectedShift,
+                         const std::string& step)
+{
+    uint32_t i;
+    uint32_t count;
+    uint32_t fitness[SLOTS * 2];
+    uint32_t buffers[SLOTS * 2][SIZE];
+    uint32_t* individuals[SLOTS * 2];
+
+    for(i = 0; i < SLOTS * 2; ++i)
+    {
+        individuals[i] = buffers[i];
+    }
+
+    count = exchange.consume(individuals, fitness, SLOTS * 2);
+    if(count != expectedCount)
+    {
+        throw std::runtime_error(step + ": wrong migrant count " +
+                                 std::to_string(count));
+    }
+    if(count == 0 || expectedShift == UINT32_MAX)
+    {
+        return;
+    }
+
+    /* The most recent migrant comes first */
+    for(i = 0; i < SIZE; ++i)
+    {
+        if(buffers[0][i] != (i + expectedShift) % SIZE)
+        {
+            throw std::runtime_error(step + ": wrong migrant genes");
+        }
+    }
+    if(fitness[0] != expectedShift)
+    {
+        throw std::runtime_error(step + ": wrong migrant fitness");
+    }
+}
+
+template<typename Exchange>
+static void testExchange(const std::string& path)
+{
+    uint32_t    i;
+    uint32_t    individual[SIZE];
+    std::string error;
+
+    Exchange first;
+    Exchange second;
+
+    if(!first.open(path, SIZE, SLOTS, error) ||
+       !second.open(path, SIZE, SLOTS, error))
+    {
+        throw std::runtime_error("Exchange not opened: " + error);
+    }
+
+    /* Migrants go to the other processes only */
+    for(i = 1; i <= 3; ++i)
+    {
+        makeIndividual(individual, i);
+        if(!first.publish(individual, i))
+        {
+            throw std::runtime_error("Migrant not published");
+        }
+    }
+    checkConsume(second, 3, 3, "Consume");
+    checkConsume(second, 0, 0, "Consume again");
+    checkConsume(first, 0, 0, "Own migrants");
+
+    /* A process joining later gets the migrants still exchanged, the ring
+     * keeps the last SLOTS migrants */
+    for(i = 4; i <= 7; ++i)
+    {
+        makeIndividual(individual, i);
+        first.publish(individual, i);
+    }
+    {
+        Exchange late;
+        if(!late.open(path, SIZE, SLOTS, error))
+        {
+            throw std::runtime_error("Late exchange not opened: " + error);
+        }
+        checkConsume(late, SLOTS, 7, "Join");
+
+        makeIndividual(individual, 2);
+        late.publish(individual, 2);
+        checkConsume(first, 1, 2, "Late migrant");
+    }
+
+    /* A process leaving does not disturb the others, the file exchange
+     * removes the migrants of the leaving process */
+    checkConsume(second, SLOTS, UINT32_MAX, "Leave");
+    makeIndividual(individual, 5);
+    second.publish(individual, 5);
+    checkConsume(first, 1, 5, "After leave");
+
+    /* Individuals with duplicate genes are rejected */
+    makeIndividual(individual, 0);
+    individual[SIZE - 1] = individual[0];
+    if(!first.publish(individual, 1))
+    {
+        throw std::runtime_error("Migrant not published");
+    }
+    checkConsume(second, 0, 0, "Duplicate genes");
+
+    /* Other board sizes are rejected */
+    {
+        Exchange other;
+        if(other.open(path, SIZE + 1, SLOTS, error))
+        {
+            uint32_t  fitness;
+            uint32_t  buffer[SIZE + 1];
+            uint32_t* buffers[1] = {buffer};
+            if(other.consume(buffers, &fitness, 1) != 0)
+            {
+                throw std::runtime_error("Wrong size migrant accepted");
+            }
+        }
+    }
+}
+
+/* Returns a slot of the ring of a mapped segment */
+static ShmSlot* getSlot(uint8_t* segment, const uint32_t slot)
+{
+    size_t slotSize;
+
+    slotSize = (sizeof(ShmSlot) + SIZE * sizeof(uint32_t) + 7) & ~7UL;
+
+    return (ShmSlot*)(segment + sizeof(ShmHeader) + slot * slotSize);
+}
+
+/* Locks a slot of the ring as a publisher of the given pid would */
+static void lockSlot(uint8_t*       segment,
+                     const uint32_t slot,
+                     const pid_t    owner,
+                     const uint64_t lockTime)
+{
+    getSlot(segment, slot)->sequence.store(((uint64_t)owner << 32) | 1);
+    getSlot(segment, slot)->lockTime.store(lockTime);
+}
+
+/* Slots left locked by a dead or stalled publisher are reclaimed */
+static void testAbandonedSlots(const std::string& name)
+{
+    int         fd;
+    pid_t       deadPid;
+    uint64_t    now;
+    uint8_t*    segment;
+    uint32_t    individual[SIZE];
+    struct stat status;
+    std::string error;
+
+    ShmMigrantExchange first;
+    ShmMigrantExchange second;
+
+    if(!first.open(name, SIZE, SLOTS, error) ||
+       !second.open(name, SIZE, SLOTS, error))
+    {
+        throw std::runtime_error("Exchange not opened: " + error);
+    }
+
+    fd = shm_open(name.c_str(), O_RDWR, 0);
+    if(fd < 0 || fstat(fd, &status) != 0)
+    {
+        throw std::runtime_error("Segment not opened");
+    }
+    segment = (uint8_t*)mmap(nullptr, status.st_size, PROT_READ | PROT_WRITE,
+                             MAP_SHARED, fd, 0);
+    close(fd);
+    if(segment == MAP_FAILED)
+    {
+        throw std::runtime_error("Segment not mapped");
+    }
+
+    /* A child that exited gives a pid with no process */
+    deadPid = fork();
+    if(deadPid == 0)
+    {
+        _exit(0);
+    }
+    if(deadPid < 0 || waitpid(deadPid, nullptr, 0) != deadPid)
+    {
+        throw std::runtime_error("Dead publisher not created");
+    }
+    now = std::chrono::duration_cast<std::chrono::milliseconds>(
+              std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    /* Dead owner, living owner and living owner past the timeout */
+    lockSlot(segment, 0, deadPid, now);
+    lockSlot(segment, 1, getpid(), now);
+    lockSlot(segment, 2, getpid(), now - MIGRANT_SLOT_TIMEOUT_MS - 1);
+
+    makeIndividual(individual, 1);
+    if(!first.publish(individual, 1))
+    {
+        throw std::runtime_error("Slot of a dead publisher not reclaimed");
+    }
+    makeIndividual(individual, 2);
+    if(first.publish(individual, 2))
+    {
+        throw std::runtime_error("Slot of a living publisher reclaimed");
+    }
+    makeIndividual(individual, 3);
+    if(!first.publish(individual, 3))
+    {
+        throw std::runtime_error("Slot past the timeout not reclaimed");
+    }
+    checkConsume(second, 2, 3, "Reclaimed slots");
+
+    /* Readers reclaim the abandoned slots they meet */
+    lockSlot(segment, 1, deadPid, now);
+    {
+        ShmMigrantExchange late;
+        if(!late.open(name, SIZE, SLOTS, error))
+        {
+            throw std::runtime_error("Late exchange not opened: " + error);
+        }
+        checkConsume(late, 2, 3, "Reader reclaim");
+    }
+    if((getSlot(segment, 1)->sequence.load() & 1) != 0)
+    {
+        throw std::runtime_error("Slot of a dead publisher kept locked");
+    }
+
+    munmap(segment, status.st_size);
+}
+
+/* The steady-state loop publishes its elite as it improves */
+static void testSteadyStatePublish(void)
+{
+    uint32_t i;
+    uint32_t attackCount;
+
+    std::vector<uint32_t> solution;
+    RecordingExchange     exchange;
+    GeneticSolver         solver(100, 300);
+
+    solver.enableSteadyState(true);
+    solver.setMigrantExchange(&exchange);
+    solver.solve(solution, attackCount);
+
+    if(exchange.published.size() < 2)
+    {
+        throw std::runtime_error("Steady-state elite not published again");
+    }
+    for(i = 1; i < exchange.published.size(); ++i)
+    {
+        if(exchange.published[i] >= exchange.published[i - 1])
+        {
+            throw std::runtime_error("Published fitness did not decrease");
+        }
+    }
+    if(exchange.published.back() != attackCount)
+    {
+        throw std::runtime_error("Last published fitness is not the best: " +
+                                 std::to_string(exchange.published.back()) +
+                                 ":" + std::to_string(attackCount));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    int           fd;
+    uint32_t      i;
+    uint32_t      fitness;
+    uint32_t      buffer[SIZE];
+    uint32_t*     buffers[1] = {buffer};
+    std::string   error;
+    std::ofstream file;
+
+    std::string directory = EXCHANGE_DIR + std::to_string(getpid());
+    std::string shmName   = SHM_NAME + std::to_string(getpid());
+
+    /* File exchange */
+    testExchange<FileMigrantExchange>(directory);
+
+    /* Malformed files are ignored */
+    {
+        FileMigrantExchange exchange;
+        exchange.open(directory, SIZE, SLOTS, error);
+        file.open(directory + "/bad-0" MIGRANT_FILE_EXTENSION);
+        file << SIZE << " 0 0 1 2 3 4 5 6 42" << std::endl;
+        file.close();
+        if(exchange.consume(buffers, &fitness, 1) != 0)
+        {
+            throw std::runtime_error("Malformed migrant accepted");
+        }
+        std::remove((directory + "/bad-0" MIGRANT_FILE_EXTENSION).c_str());
+    }
+    if(rmdir(directory.c_str()) != 0)
+    {
+        throw std::runtime_error("Migrant files left in the directory");
+    }
+
+    /* Shared memory exchange, when the system provides it */
+    {
+        ShmMigrantExchange probe;
+        if(probe.open(shmName, SIZE, SLOTS, error))
+        {
+            probe.close();
+            testExchange<ShmMigrantExchange>(shmName);
+            ShmMigrantExchange::remove(shmName);
+            testAbandonedSlots(shmName);
+            ShmMigrantExchange::remove(shmName);
+
+            /* Segments left uninitialized by a crashed creator, before or
+             * after their sizing, are replaced */
+            for(i = 0; i < 2; ++i)
+            {
+                fd = shm_open(shmName.c_str(), O_RDWR | O_CREAT, 0600);
+                if(fd < 0 || ftruncate(fd, i * 4096) != 0)
+                {
+                    throw std::runtime_error("Stale segment not created");
+                }
+                close(fd);
+                testExchange<ShmMigrantExchange>(shmName);
+                ShmMigrantExchange::remove(shmName);
+            }
+        }
+        else
+        {
+            std::cout << "Shared memory unavailable: " << error << std::endl;
+        }
+        ShmMigrantExchange::remove(shmName);
+    }
+
+    /* Solver side of the exchange */
+    testSteadyStatePublish();
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
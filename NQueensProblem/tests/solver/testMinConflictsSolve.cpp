@@ -0,0 +1,41 @@
+#include <iostream>
+
+#include "solver/MinConflictsSolver.h"
+
+using namespace nsSolver;
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    MinConflictsSolver* solver = new MinConflictsSolver(0, 1000, 1);
+    solver->testSolve();
+    delete solver;
+    solver = new MinConflictsSolver(8, 1000, 1);
+    solver->testSolve();
+    delete solver;
+    solver = new MinConflictsSolver(3, 100, 4);
+    solver->testSolve();
+    delete solver;
+    solver = new MinConflictsSolver(1000, 1000, 4);
+    solver->testSolve();
+    delete solver;
+    solver = new MinConflictsSolver(5000, 1000, 0);
+    solver->testSolve();
+    delete solver;
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
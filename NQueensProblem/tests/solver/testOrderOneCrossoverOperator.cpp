@@ -1,4 +1,5 @@
 #include <solver/OrderOneCrossoverOperator.h>
+#include <solver/FitnessCache.h>
 
 #include <iostream>  /* std::cout, std::endl */
 #include <cstring>   /* strncmp */
@@ -63,22 +64,27 @@ int main(int argc, char** argv)
     uint32_t **pop = new uint32_t*[POP_SIZE];
     uint32_t *matePool = new uint32_t[POP_SIZE];
     uint32_t **children = new uint32_t*[POP_SIZE];
+    uint64_t *popHash = new uint64_t[POP_SIZE];
+    uint64_t *childrenHash = new uint64_t[POP_SIZE];
 
     for(i = 0; i < POP_SIZE; ++i)
     {
         pop[i] = new uint32_t[QUEENSCOUNT];
         children[i] = new uint32_t[QUEENSCOUNT];
         initPopulation(pop[i]);
+        popHash[i] = FitnessCache::getHash(pop[i], QUEENSCOUNT);
         matePool[i] = i;
     }
 
     OrderOneCrossoverOperator crossover;
 
-    crossover(QUEENSCOUNT, (const uint32_t **)pop, POP_SIZE,
-              (const uint32_t *)matePool, 0, children);
+    crossover(QUEENSCOUNT, (const uint32_t **)pop, POP_SIZE, popHash,
+              (const uint32_t *)matePool, 0, children,
+              childrenHash);
 
-    crossover(QUEENSCOUNT, (const uint32_t **)pop, POP_SIZE,
-              (const uint32_t *)matePool, POP_SIZE, children);
+    crossover(QUEENSCOUNT, (const uint32_t **)pop, POP_SIZE, popHash,
+              (const uint32_t *)matePool, POP_SIZE, children,
+              childrenHash);
 
     for(i = 0; i < POP_SIZE; ++i)
     {
@@ -102,6 +108,10 @@ int main(int argc, char** argv)
             }
             //std::cout << children[i][j] << " ";
         }
+        if(childrenHash[i] != FitnessCache::getHash(children[i], QUEENSCOUNT))
+        {
+            throw std::runtime_error("Child hash is wrong!");
+        }
         //std::cout << std::endl;
     }
 
@@ -114,6 +124,8 @@ int main(int argc, char** argv)
     delete[] pop;
     delete[] matePool;
     delete[] children;
+    delete[] popHash;
+    delete[] childrenHash;
 
     std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
 
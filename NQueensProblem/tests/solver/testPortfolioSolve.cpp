@@ -0,0 +1,40 @@
+#include <iostream>
+
+#include "solver/PortfolioSolver.h"
+
+using namespace nsSolver;
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    PortfolioSolver* solver = new PortfolioSolver(0, 1000);
+    solver->testSolve();
+    delete solver;
+    solver = new PortfolioSolver(3, 1000);
+    solver->testSolve();
+    delete solver;
+    solver = new PortfolioSolver(8, 1000);
+    solver->testSolve();
+    delete solver;
+    /* The greedy and genetic engines would run for minutes if they were not
+     * cancelled */
+    solver = new PortfolioSolver(400, 100000);
+    solver->testSolve();
+    delete solver;
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
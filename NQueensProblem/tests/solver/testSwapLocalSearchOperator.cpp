@@ -0,0 +1,170 @@
+#include <solver/SwapLocalSearchOperator.h>
+#include <solver/FitnessCache.h>
+
+#include <iostream>  /* std::cout, std::endl */
+#include <cstring>   /* memcpy */
+#include <cstdlib>   /* abs */
+#include <stdexcept> /* std::runtime_exception */
+#include <set>       /* std::set */
+
+using namespace nsSolver;
+
+#define POP_SIZE        64U
+#define QUEENSCOUNT     200U
+
+static void initPopulation(uint32_t* individual)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t index;
+    std::random_device rd;
+    std::default_random_engine randomGenerator;
+    randomGenerator.seed(rd());
+
+    std::set<uint32_t> possiblePos;
+
+    std::uniform_int_distribution<uint32_t> randGen;
+
+    /* Init the possible position set */
+    for(i = 0; i < QUEENSCOUNT; ++i)
+    {
+        possiblePos.insert(i);
+    }
+
+    for(j = 0; j < QUEENSCOUNT; ++j)
+    {
+        randGen =
+        std::uniform_int_distribution<uint32_t>(0,
+                                                possiblePos.size() - 1);
+        std::set<uint32_t>::const_iterator it(possiblePos.begin());
+        index = randGen(randomGenerator);
+        std::advance(it, index);
+        individual[j] = *it;
+        possiblePos.erase(it);
+    }
+}
+
+static uint32_t getAttackCount(const uint32_t* solution)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t attackCount;
+
+    attackCount = 0;
+    for(i = 0; i < QUEENSCOUNT; ++i)
+    {
+        for(j = i + 1; j < QUEENSCOUNT; ++j)
+        {
+            if(solution[i] == solution[j] ||
+               (j - i) == (uint32_t)abs((int32_t)solution[i] -
+                                        (int32_t)solution[j]))
+            {
+                ++attackCount;
+            }
+        }
+    }
+
+    return attackCount;
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    uint32_t   i;
+    uint32_t   j;
+    uint32_t   improved;
+    uint32_t** pop = new uint32_t*[POP_SIZE];
+    uint32_t** popSave = new uint32_t*[POP_SIZE];
+    uint32_t*  popFitness = new uint32_t[POP_SIZE];
+    uint64_t*  popHash = new uint64_t[POP_SIZE];
+    std::vector<bool> used;
+
+    for(i = 0; i < POP_SIZE; ++i)
+    {
+        pop[i] = new uint32_t[QUEENSCOUNT];
+        popSave[i] = new uint32_t[QUEENSCOUNT];
+
+        initPopulation(pop[i]);
+        memcpy(popSave[i], pop[i], sizeof(uint32_t) * QUEENSCOUNT);
+        popHash[i] = FitnessCache::getHash(pop[i], QUEENSCOUNT);
+    }
+
+    /* Without budget the operator only computes the fitness */
+    SwapLocalSearchOperator evalOp(0, 3);
+    evalOp(pop, POP_SIZE, QUEENSCOUNT, popHash, popFitness);
+    for(i = 0; i < POP_SIZE; ++i)
+    {
+        if(memcmp(pop[i], popSave[i], sizeof(uint32_t) * QUEENSCOUNT) != 0)
+        {
+            throw std::runtime_error("Individual should't have changed");
+        }
+        if(popFitness[i] != getAttackCount(pop[i]))
+        {
+            throw std::runtime_error("Wrong fitness without budget");
+        }
+    }
+
+    /* With a budget the individuals must improve and stay permutations */
+    SwapLocalSearchOperator searchOp(4, 0);
+    searchOp(pop, POP_SIZE, QUEENSCOUNT, popHash, popFitness);
+    improved = 0;
+    for(i = 0; i < POP_SIZE; ++i)
+    {
+        if(popFitness[i] != getAttackCount(pop[i]))
+        {
+            throw std::runtime_error("Wrong fitness after local search");
+        }
+        if(popHash[i] != FitnessCache::getHash(pop[i], QUEENSCOUNT))
+        {
+            throw std::runtime_error("Wrong hash after local search");
+        }
+        if(popFitness[i] > getAttackCount(popSave[i]))
+        {
+            throw std::runtime_error("Local search degraded an individual");
+        }
+        if(popFitness[i] < getAttackCount(popSave[i]))
+        {
+            ++improved;
+        }
+
+        used = std::vector<bool>(QUEENSCOUNT, false);
+        for(j = 0; j < QUEENSCOUNT; ++j)
+        {
+            if(pop[i][j] >= QUEENSCOUNT || used[pop[i][j]])
+            {
+                throw std::runtime_error("Local search broke a permutation");
+            }
+            used[pop[i][j]] = true;
+        }
+    }
+    if(improved == 0)
+    {
+        throw std::runtime_error("Local search did not improve anything");
+    }
+
+    for(i = 0; i < POP_SIZE; ++i)
+    {
+        delete[] pop[i];
+        delete[] popSave[i];
+    }
+    delete[] pop;
+    delete[] popSave;
+    delete[] popFitness;
+    delete[] popHash;
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
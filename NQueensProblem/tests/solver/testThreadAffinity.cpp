@@ -0,0 +1,95 @@
+#include <solver/ThreadAffinity.h>
+#include <solver/GeneticSolver.h>
+
+#include <iostream>  /* std::cout, std::endl */
+#include <vector>    /* std::vector */
+#include <string>    /* std::string */
+#include <stdexcept> /* std::runtime_exception */
+#include <sched.h>   /* sched_getcpu */
+
+using namespace nsSolver;
+
+static void checkList(const std::string&           list,
+                      const std::vector<uint32_t>& expected)
+{
+    std::vector<uint32_t> cpus;
+
+    if(!ThreadAffinity::parseCpuList(list, cpus) || cpus != expected)
+    {
+        throw std::runtime_error("Wrong cpulist parsing: " + list);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    uint32_t i;
+    std::vector<uint32_t> cpus;
+
+    ThreadAffinity affinity;
+
+    /* Cpulist parsing */
+    checkList("0", {0});
+    checkList("0-3,8-9\n", {0, 1, 2, 3, 8, 9});
+    checkList("4,2", {4, 2});
+    checkList("", {});
+    if(ThreadAffinity::parseCpuList("3-1", cpus) ||
+       ThreadAffinity::parseCpuList("a-b", cpus))
+    {
+        throw std::runtime_error("Wrong cpulist accepted");
+    }
+
+    /* Topology */
+    if(affinity.getCpuCount() == 0 || affinity.getNodeCount() == 0 ||
+       affinity.getNodeCount() > affinity.getCpuCount())
+    {
+        throw std::runtime_error("Wrong topology");
+    }
+    for(i = 0; i < 2 * affinity.getCpuCount(); ++i)
+    {
+        if(affinity.getCpu(i) !=
+           affinity.getCpu(i % affinity.getCpuCount()) ||
+           affinity.getNode(i) >= affinity.getNodeCount() ||
+           (i > 0 && i < affinity.getCpuCount() &&
+            affinity.getNode(i) < affinity.getNode(i - 1)))
+        {
+            throw std::runtime_error("Wrong worker placement");
+        }
+    }
+
+    /* Pinning */
+    for(i = 0; i < affinity.getCpuCount(); ++i)
+    {
+        if(!affinity.pin(i) || sched_getcpu() != (int)affinity.getCpu(i))
+        {
+            throw std::runtime_error("Worker not pinned on core " +
+                                     std::to_string(affinity.getCpu(i)));
+        }
+    }
+    if(!affinity.unpin())
+    {
+        throw std::runtime_error("Worker not unpinned");
+    }
+
+    /* Pinned solver */
+    GeneticSolver solver(40, 2000);
+    solver.enableAffinity(true);
+    solver.testInitPopulation();
+    solver.testSolve();
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
@@ -0,0 +1,345 @@
+/*******************************************************************************
+ * File: autotune.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Offline tuner of the genetic solver parameters. For each board size, a
+ * race runs the candidate parameter sets round after round and eliminates
+ * the candidates that are clearly slower than the best one. The winner of
+ * each size is written to a parameter table loaded by the solver at startup.
+ ******************************************************************************/
+
+#include <cstdint>  /* Generic int types */
+#include <iostream> /* std::cout, std::endl */
+#include <fstream>  /* std::ofstream */
+#include <string>   /* std::string, std::stoul */
+#include <vector>   /* std::vector */
+#include <thread>   /* std::thread */
+#include <atomic>   /* std::atomic */
+#include <chrono>   /* std::chrono */
+#include <random>   /* std::random_device, std::mt19937 */
+
+#include <solver/GeneticSolver.h>     /* nsSolver::GeneticSolver */
+#include <solver/GeneticParameters.h> /* nsSolver::GeneticParameters */
+
+using namespace nsSolver; /* Solver's namespace */
+
+#define AUTOTUNE_CANDIDATES      12U
+#define AUTOTUNE_ROUNDS          6U
+#define AUTOTUNE_ITERCOUNT       2000U
+#define AUTOTUNE_MIN_ROUNDS      2U
+#define AUTOTUNE_ELIMINATION     1.5
+#define AUTOTUNE_UNSOLVED_FACTOR 10.0
+
+/**
+ * @brief A candidate parameter set and the costs of its trials.
+ *
+ */
+struct Candidate
+{
+    GeneticParameters   parameters;
+    std::vector<double> costs;
+    bool                alive;
+};
+
+static const uint32_t POPULATIONS[]      = {40, 60, 100, 160, 240};
+static const double   MATING_RATIOS[]    = {0.4, 0.6, 0.8};
+static const double   CROSSOVERS[]       = {0.6, 0.8, 0.9, 1.0};
+static const double   MUTATIONS[]        = {0.05, 0.1, 0.2, 0.4};
+static const double   MUTATION_RATIOS[]  = {0.25, 0.5, 0.99};
+static const char*    OPERATORS[]        = {"order1", "pmx", "cycle"};
+
+template<typename T, size_t S>
+static T pick(const T (&values)[S], std::mt19937& generator)
+{
+    return values[generator() % S];
+}
+
+/* Draws the candidates, the first one keeps the default parameters */
+static std::vector<Candidate> drawCandidates(const uint32_t count,
+                                             std::mt19937&  generator)
+{
+    uint32_t i;
+    uint32_t populationSize;
+
+    std::vector<Candidate> candidates(count);
+
+    for(i = 1; i < count; ++i)
+    {
+        GeneticParameters& parameters = candidates[i].parameters;
+
+        populationSize            = pick(POPULATIONS, generator);
+        parameters.populationSize = populationSize;
+        parameters.matingPoolSize =
+            (uint32_t)(populationSize * pick(MATING_RATIOS, generator)) & ~1U;
+        parameters.crossoverProba = pick(CROSSOVERS, generator);
+        parameters.mutationProba  = pick(MUTATIONS, generator);
+        parameters.mutationSize   =
+            populationSize * pick(MUTATION_RATIOS, generator);
+        parameters.adaptiveRates  = (generator() % 2 == 0);
+        parameters.crossoverOperator = pick(OPERATORS, generator);
+    }
+
+    return candidates;
+}
+
+/* Runs the trials of a round until none is left, this function is used as
+ * a thread routine */
+static void trialThread(const std::vector<Candidate>* candidates,
+                        const std::vector<uint32_t>*  alive,
+                        std::vector<double>*          costs,
+                        std::atomic<uint32_t>*        next,
+                        const uint32_t                queensCount,
+                        const uint32_t                iterCount,
+                        const uint32_t                workerCount)
+{
+    uint32_t trial;
+    uint32_t attackCount;
+    double   elapsed;
+
+    std::vector<uint32_t> solution;
+    std::chrono::high_resolution_clock::time_point start;
+
+    while((trial = (*next)++) < alive->size())
+    {
+        GeneticSolver solver(queensCount, iterCount,
+                             (*candidates)[(*alive)[trial]].parameters);
+        solver.setWorkerCount(workerCount);
+
+        start = std::chrono::high_resolution_clock::now();
+        solver.solve(solution, attackCount);
+        elapsed = std::chrono::duration<double>(
+                    std::chrono::high_resolution_clock::now() - start).count();
+
+        /* Unsolved trials are penalized, PAR10 style */
+        if(attackCount != 0)
+        {
+            elapsed *= AUTOTUNE_UNSOLVED_FACTOR;
+        }
+        (*costs)[trial] = elapsed;
+    }
+}
+
+/* Runs one trial of every alive candidate, jobs trials at a time. All the
+ * trials of a round share the machine, the comparison stays fair. Each
+ * solver gets its share of the cores, the trials do not oversubscribe the
+ * machine */
+static void runRound(std::vector<Candidate>& candidates,
+                     const uint32_t          queensCount,
+                     const uint32_t          iterCount,
+                     const uint32_t          coreCount)
+{
+    uint32_t i;
+    uint32_t jobs;
+    uint32_t workerCount;
+
+    std::vector<uint32_t>    alive;
+    std::vector<double>      costs;
+    std::vector<std::thread> workers;
+    std::atomic<uint32_t>    next(0);
+    std::streambuf*          output;
+
+    for(i = 0; i < candidates.size(); ++i)
+    {
+        if(candidates[i].alive)
+        {
+            alive.push_back(i);
+        }
+    }
+    costs = std::vector<double>(alive.size());
+
+    jobs = (coreCount < alive.size()) ? coreCount : alive.size();
+    if(jobs == 0)
+    {
+        return;
+    }
+    workerCount = coreCount / jobs;
+
+    /* Silence the solvers progress while the trials run */
+    output = std::cout.rdbuf(nullptr);
+    for(i = 0; i < jobs; ++i)
+    {
+        workers.push_back(std::thread(trialThread, &candidates, &alive,
+                                      &costs, &next, queensCount,
+                                      iterCount, workerCount));
+    }
+    for(i = 0; i < workers.size(); ++i)
+    {
+        workers[i].join();
+    }
+    std::cout.rdbuf(output);
+
+    for(i = 0; i < alive.size(); ++i)
+    {
+        candidates[alive[i]].costs.push_back(costs[i]);
+    }
+}
+
+static double getMeanCost(const Candidate& candidate)
+{
+    uint32_t i;
+    double   sum;
+
+    sum = 0;
+    for(i = 0; i < candidate.costs.size(); ++i)
+    {
+        sum += candidate.costs[i];
+    }
+
+    return sum / candidate.costs.size();
+}
+
+/* Races the candidates on one board size and returns the winner */
+static uint32_t race(std::vector<Candidate>& candidates,
+                     const uint32_t          queensCount,
+                     const uint32_t          iterCount,
+                     const uint32_t          rounds,
+                     const uint32_t          coreCount)
+{
+    uint32_t i;
+    uint32_t round;
+    uint32_t best;
+    uint32_t aliveCount;
+
+    for(i = 0; i < candidates.size(); ++i)
+    {
+        candidates[i].costs.clear();
+        candidates[i].alive = true;
+    }
+
+    best       = 0;
+    aliveCount = candidates.size();
+    for(round = 0; round < rounds && aliveCount > 1; ++round)
+    {
+        runRound(candidates, queensCount, iterCount, coreCount);
+
+        /* Find the best mean cost and eliminate the clearly slower
+         * candidates once they ran enough trials */
+        best = UINT32_MAX;
+        for(i = 0; i < candidates.size(); ++i)
+        {
+            if(candidates[i].alive &&
+               (best == UINT32_MAX ||
+                getMeanCost(candidates[i]) < getMeanCost(candidates[best])))
+            {
+                best = i;
+            }
+        }
+        if(round + 1 >= AUTOTUNE_MIN_ROUNDS)
+        {
+            for(i = 0; i < candidates.size(); ++i)
+            {
+                if(candidates[i].alive && getMeanCost(candidates[i]) >
+                   getMeanCost(candidates[best]) * AUTOTUNE_ELIMINATION)
+                {
+                    candidates[i].alive = false;
+                    --aliveCount;
+                }
+            }
+        }
+
+        std::cout << "N = " << queensCount
+                  << " | Round " << round
+                  << " | Alive: " << aliveCount
+                  << " | Best: " << getMeanCost(candidates[best]) << "s ("
+                  << candidates[best].parameters.toString() << ")"
+                  << std::endl;
+    }
+
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    int      i;
+    uint32_t best;
+    uint32_t candidateCount;
+    uint32_t rounds;
+    uint32_t iterCount;
+    uint32_t coreCount;
+
+    std::string           tablePath;
+    std::vector<uint32_t> sizes;
+    std::ofstream         table;
+
+    std::random_device rd;
+    std::mt19937       generator(rd());
+
+    /* Arguments: [TABLE] [CANDIDATES] [ROUNDS] [ITERCOUNT] [N...] */
+    tablePath      = GEN_TABLE_FILE;
+    candidateCount = AUTOTUNE_CANDIDATES;
+    rounds         = AUTOTUNE_ROUNDS;
+    iterCount      = AUTOTUNE_ITERCOUNT;
+    if(argc > 1)
+    {
+        tablePath = argv[1];
+    }
+    if(argc > 2)
+    {
+        candidateCount = std::stoul(argv[2]);
+    }
+    if(argc > 3)
+    {
+        rounds = std::stoul(argv[3]);
+    }
+    if(argc > 4)
+    {
+        iterCount = std::stoul(argv[4]);
+    }
+    for(i = 5; i < argc; ++i)
+    {
+        sizes.push_back(std::stoul(argv[i]));
+    }
+    if(sizes.empty())
+    {
+        sizes = {32, 64, 128};
+    }
+    if(candidateCount == 0)
+    {
+        candidateCount = 1;
+    }
+
+    coreCount = std::thread::hardware_concurrency();
+    if(coreCount == 0)
+    {
+        coreCount = 1;
+    }
+
+    std::vector<Candidate> candidates = drawCandidates(candidateCount,
+                                                       generator);
+
+    table.open(tablePath);
+    if(!table.is_open())
+    {
+        std::cout << "Cannot write the parameter table " << tablePath
+                  << std::endl;
+        return -1;
+    }
+    table << "# Genetic parameters tuned by autotune, one entry per board size"
+          << std::endl;
+
+    for(i = 0; i < (int)sizes.size(); ++i)
+    {
+        best = race(candidates, sizes[i], iterCount, rounds, coreCount);
+        table << "N=" << sizes[i] << " "
+              << candidates[best].parameters.toString() << std::endl;
+
+        std::cout << "N = " << sizes[i] << " | Winner: "
+                  << candidates[best].parameters.toString();
+
+        /* Without a round, e.g. a single candidate, nothing was timed */
+        if(!candidates[0].costs.empty())
+        {
+            std::cout << " | Default: " << getMeanCost(candidates[0]) << "s";
+        }
+        std::cout << std::endl;
+    }
+
+    std::cout << "Parameter table written to " << tablePath << std::endl;
+
+    return 0;
+}
@@ -1,6 +1,18 @@
 #! /bin/bash
 make clean
 
+################### Shared sources
+
+echo "Test huge page allocator copies"
+for file in include/solver/HugePageAllocator.h \
+            src/solver/HugePageAllocator.cpp; do
+    diff -I "@brief .* problem solvers\." $file ../TSP/$file
+    if [[ $? != 0 ]]; then
+        echo "FAIL: Test huge page allocator copies"
+        exit -1
+    fi
+done
+
 ################### Greedy
 
 echo "Test greedy algorithm attack counter"
@@ -70,6 +82,20 @@ if [[ $? != 0 ]]; then
     exit -1
 fi
 
+echo "Test genetic algorithm PMX crossover operator"
+make test=true testPMXCrossoverOperator
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test genetic algorithm PMX crossover operator"
+    exit -1
+fi
+
+echo "Test genetic algorithm cycle crossover operator"
+make test=true testCycleCrossoverOperator
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test genetic algorithm cycle crossover operator"
+    exit -1
+fi
+
 echo "Test genetic algorithm swap mutation operator"
 make test=true testSwapMutationOperator
 if [[ $? != 0 ]]; then
@@ -91,9 +117,135 @@ if [[ $? != 0 ]]; then
     exit -1
 fi
 
+echo "Test genetic algorithm injection"
+make test=true testGeneticInjection
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test genetic algorithm injection"
+    exit -1
+fi
+
+echo "Test genetic algorithm diversity"
+make test=true testGeneticDiversity
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test genetic algorithm diversity"
+    exit -1
+fi
+
+echo "Test genetic algorithm fitness heap"
+make test=true testFitnessHeap
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test genetic algorithm fitness heap"
+    exit -1
+fi
+
+echo "Test genetic algorithm steady-state solve"
+make test=true testSteadyStateSolve
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test genetic algorithm steady-state solve"
+    exit -1
+fi
+
+echo "Test genetic algorithm fitness cache"
+make test=true testFitnessCache
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test genetic algorithm fitness cache"
+    exit -1
+fi
+
+echo "Test genetic algorithm hashes"
+make test=true testGeneticHashes
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test genetic algorithm hashes"
+    exit -1
+fi
+
+echo "Test genetic algorithm split fitness"
+make test=true testGeneticSplitFitness
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test genetic algorithm split fitness"
+    exit -1
+fi
+
+echo "Test genetic algorithm adaptive rates"
+make test=true testGeneticAdaptiveRates
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test genetic algorithm adaptive rates"
+    exit -1
+fi
+
+echo "Test genetic algorithm parameters"
+make test=true testGeneticParameters
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test genetic algorithm parameters"
+    exit -1
+fi
+
+echo "Test genetic algorithm migrant exchange"
+make test=true testMigrantExchange
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test genetic algorithm migrant exchange"
+    exit -1
+fi
+
+echo "Test genetic algorithm thread affinity"
+make test=true testThreadAffinity
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test genetic algorithm thread affinity"
+    exit -1
+fi
+
+echo "Test genetic algorithm huge page allocator"
+make test=true testHugePageAllocator
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test genetic algorithm huge page allocator"
+    exit -1
+fi
+
 echo "Test genetic algorithm solve"
 make test=true testGeneticSolve
 if [[ $? != 0 ]]; then
     echo "FAIL: Test genetic algorithm solve"
     exit -1
-fi
\ No newline at end of file
+fi
+################### Constructive
+
+echo "Test constructive algorithm solver"
+make test=true testConstructiveSolve
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test constructive algorithm solver"
+    exit -1
+fi
+
+################### Min-conflicts
+
+echo "Test min-conflicts algorithm solver"
+make test=true testMinConflictsSolve
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test min-conflicts algorithm solver"
+    exit -1
+fi
+
+################### Portfolio
+
+echo "Test portfolio solver"
+make test=true testPortfolioSolve
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test portfolio solver"
+    exit -1
+fi
+
+################### Memetic
+
+echo "Test swap local search operator"
+make test=true testSwapLocalSearchOperator
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test swap local search operator"
+    exit -1
+fi
+
+echo "Test memetic algorithm solve"
+make test=true testMemeticSolve
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test memetic algorithm solve"
+    exit -1
+fi
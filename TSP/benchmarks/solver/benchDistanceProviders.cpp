@@ -0,0 +1,146 @@
+#include <iostream>  /* std::cout, std::endl, std::ostream */
+#include <chrono>    /* std::chrono */
+#include <string>    /* std::stoul, std::string */
+#include <vector>    /* std::vector */
+#include <random>    /* std::mt19937, std::uniform_real_distribution */
+
+#include "solver/Solver.h"
+#include "solver/GreedySolver.h"
+#include "solver/DistanceProvider.h"
+
+using namespace nsSolver;
+
+#define DEFAULT_RUNS   3U
+#define DEFAULT_BUDGET (1ULL << 30)
+#define BENCH_MAP_SIZE 10000.0
+
+/* Builds the backend and runs the solver RUNS times, returns the mean build
+ * and solve times */
+static void runSolver(const std::vector<city_t>& cities,
+                      const uint32_t             runs,
+                      const std::string&         backend,
+                      double*                    buildTime,
+                      double*                    solveTime,
+                      double*                    distance,
+                      size_t*                    footprint)
+{
+    uint32_t i;
+
+    std::vector<uint32_t> solution;
+    std::chrono::high_resolution_clock::time_point start;
+    std::streambuf* output;
+
+    *buildTime = 0;
+    *solveTime = 0;
+    for(i = 0; i < runs; ++i)
+    {
+        /* Silence the solver progress */
+        output = std::cout.rdbuf(nullptr);
+        start  = std::chrono::high_resolution_clock::now();
+        DistanceProvider* distances =
+            DistanceProvider::create(backend, cities, HUGE_PAGES_OFF, "");
+        *buildTime += std::chrono::duration<double>(
+                    std::chrono::high_resolution_clock::now() - start).count();
+
+        GreedySolver solver(cities, distances);
+        start = std::chrono::high_resolution_clock::now();
+        solver.solve(solution, *distance);
+        *solveTime += std::chrono::duration<double>(
+                    std::chrono::high_resolution_clock::now() - start).count();
+        std::cout.rdbuf(output);
+
+        *footprint = distances->getMemoryFootprint();
+        delete distances;
+    }
+
+    *buildTime /= runs;
+    *solveTime /= runs;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+    uint32_t runs;
+    uint64_t budget;
+    double   buildTime;
+    double   solveTime;
+    double   distance;
+    size_t   footprint;
+    city_t   city;
+
+    std::vector<city_t>   cities;
+    std::vector<uint32_t> sizes;
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> coordinate(0, BENCH_MAP_SIZE);
+
+    const char* backends[] = {"matrix", "triangular", "neighbours", "oracle"};
+
+    /* Arguments: [RUNS] [BUDGET] [CITIES...] */
+    runs   = DEFAULT_RUNS;
+    budget = DEFAULT_BUDGET;
+    if(argc > 1)
+    {
+        runs = std::stoul(argv[1]);
+    }
+    if(argc > 2 && !DistanceProvider::parseSize(argv[2], budget))
+    {
+        std::cout << "Wrong budget: " << argv[2] << std::endl;
+        return -1;
+    }
+    for(i = 3; i < (uint32_t)argc; ++i)
+    {
+        sizes.push_back(std::stoul(argv[i]));
+    }
+    if(sizes.empty())
+    {
+        sizes = {500, 2000, 5000, 10000, 20000};
+    }
+    if(runs == 0)
+    {
+        runs = 1;
+    }
+
+    std::cout << "Budget: " << budget << " bytes | Runs: " << runs
+              << std::endl;
+    for(i = 0; i < sizes.size(); ++i)
+    {
+        cities.clear();
+        for(j = 0; j < sizes[i]; ++j)
+        {
+            city.id = j;
+            city.x  = coordinate(generator);
+            city.y  = coordinate(generator);
+            cities.push_back(city);
+        }
+
+        DistanceProvider* selected = DistanceProvider::select(cities, budget,
+                                                              HUGE_PAGES_OFF,
+                                                              "");
+        std::cout << "Cities: " << sizes[i] << " | Selected: "
+                  << selected->getName() << std::endl;
+        delete selected;
+
+        /* Only run the backends that fit in the budget */
+        for(k = 0; k < sizeof(backends) / sizeof(backends[0]); ++k)
+        {
+            if(DistanceProvider::getRequiredMemory(backends[k], sizes[i]) >
+               budget)
+            {
+                std::cout << "\t" << backends[k] << ": over budget"
+                          << std::endl;
+                continue;
+            }
+            runSolver(cities, runs, backends[k], &buildTime, &solveTime,
+                      &distance, &footprint);
+            std::cout << "\t" << backends[k] << ": build " << buildTime
+                      << "s | greedy " << solveTime << "s | "
+                      << footprint / 1024 << " kB | tour " << distance
+                      << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include <iostream>  /* std::cout, std::endl, std::ostream */
+#include <chrono>    /* std::chrono */
+#include <string>    /* std::stoul, std::string */
+#include <vector>    /* std::vector */
+#include <random>    /* std::mt19937, std::uniform_real_distribution */
+
+#include "solver/Solver.h"
+#include "solver/GreedySolver.h"
+#include "solver/FullMatrixDistanceProvider.h"
+#include "solver/HugePageAllocator.h"
+
+using namespace nsSolver;
+
+#define DEFAULT_CITYCOUNT 5000U
+#define DEFAULT_RUNS      3U
+#define BENCH_MAP_SIZE    10000.0
+
+/* Builds the distance matrix and runs the solver RUNS times, returns the mean
+ * time */
+static double runSolver(const std::vector<city_t>& cities,
+                        const uint32_t             runs,
+                        const HugePageMode         mode,
+                        HugePageMode*              backing,
+                        size_t*                    hugeBytes)
+{
+    uint32_t i;
+    double   elapsed;
+    double   distance;
+
+    std::vector<uint32_t> solution;
+    std::chrono::high_resolution_clock::time_point start;
+    std::streambuf* output;
+
+    elapsed = 0;
+    for(i = 0; i < runs; ++i)
+    {
+        /* Silence the solver progress */
+        output = std::cout.rdbuf(nullptr);
+        start  = std::chrono::high_resolution_clock::now();
+        FullMatrixDistanceProvider distances(cities, mode);
+        GreedySolver solver(cities, &distances);
+        solver.solve(solution, distance);
+        elapsed += std::chrono::duration<double>(
+                    std::chrono::high_resolution_clock::now() - start).count();
+        std::cout.rdbuf(output);
+
+        *backing   = distances.getHugePageBacking();
+        *hugeBytes = HugePageAllocator::getTransparentHugeBytes();
+    }
+
+    return elapsed / runs;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t     i;
+    uint32_t     cityCount;
+    uint32_t     runs;
+    double       elapsed;
+    double       reference;
+    size_t       hugeBytes;
+    HugePageMode backing;
+    city_t       city;
+
+    std::vector<city_t> cities;
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> coordinate(0, BENCH_MAP_SIZE);
+
+    const HugePageMode modes[] = {
+        HUGE_PAGES_OFF, HUGE_PAGES_TRANSPARENT, HUGE_PAGES_EXPLICIT
+    };
+
+    /* Arguments: [CITIES] [RUNS] */
+    cityCount = DEFAULT_CITYCOUNT;
+    runs      = DEFAULT_RUNS;
+    if(argc > 1)
+    {
+        cityCount = std::stoul(argv[1]);
+    }
+    if(argc > 2)
+    {
+        runs = std::stoul(argv[2]);
+    }
+    if(runs == 0)
+    {
+        runs = 1;
+    }
+
+    for(i = 0; i < cityCount; ++i)
+    {
+        city.id = i;
+        city.x  = coordinate(generator);
+        city.y  = coordinate(generator);
+        cities.push_back(city);
+    }
+
+    std::cout << "Cities: " << cityCount << " | Matrix: "
+              << (double)cityCount * cityCount * sizeof(double) / (1 << 20)
+              << " MB | Runs: " << runs << std::endl;
+    reference = 0;
+    for(i = 0; i < sizeof(modes) / sizeof(modes[0]); ++i)
+    {
+        elapsed = runSolver(cities, runs, modes[i], &backing, &hugeBytes);
+        if(i == 0)
+        {
+            reference = elapsed;
+        }
+        std::cout << "Greedy " << HugePageAllocator::getModeName(modes[i])
+                  << " (backing " << HugePageAllocator::getModeName(backing)
+                  << ", " << hugeBytes / 1024 << " kB transparent huge): "
+                  << elapsed << "s | Speedup: " << reference / elapsed
+                  << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+#include <iostream>  /* std::cout, std::endl */
+#include <chrono>    /* std::chrono */
+#include <string>    /* std::stoul */
+#include <vector>    /* std::vector */
+#include <random>    /* std::mt19937, std::uniform_real_distribution */
+#include <algorithm> /* std::reverse */
+
+#include "solver/Solver.h"
+#include "solver/GreedySolver.h"
+#include "solver/LocalSearchSolver.h"
+#include "solver/LinKernighanSolver.h"
+#include "solver/DistanceOracle.h"
+
+using namespace nsSolver;
+
+#define BENCH_MAP_SIZE   10000.0
+#define BENCH_NAIVE_SIZE 5000U
+
+/* Returns the elapsed time since start in seconds */
+static double getElapsed(
+                const std::chrono::high_resolution_clock::time_point& start)
+{
+    return std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - start).count();
+}
+
+/* Improves a tour with passes over every pair of edges until a pass applies
+ * no move, returns the number of passes */
+static uint32_t improveNaive(const DistanceOracle&  oracle,
+                             std::vector<uint32_t>& tour)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t size;
+    uint32_t passes;
+    bool     improved;
+    double   delta;
+
+    size   = tour.size();
+    passes = 0;
+    do
+    {
+        improved = false;
+        ++passes;
+        for(i = 0; i + 2 < size; ++i)
+        {
+            for(j = i + 2; j < size && !(i == 0 && j == size - 1); ++j)
+            {
+                delta = oracle.getDistance(tour[i], tour[j]) +
+                        oracle.getDistance(tour[i + 1],
+                                           tour[(j + 1) % size]) -
+                        oracle.getDistance(tour[i], tour[i + 1]) -
+                        oracle.getDistance(tour[j], tour[(j + 1) % size]);
+                if(delta < -LOCAL_SEARCH_EPSILON)
+                {
+                    std::reverse(tour.begin() + i + 1, tour.begin() + j + 1);
+                    improved = true;
+                }
+            }
+        }
+    } while(improved);
+
+    return passes;
+}
+
+/* Runs the local search with some move types, the Lin-Kernighan solver when
+ * its moves are enabled, prints its time, tour, gain per second and the
+ * acceptance of each move type */
+static void runSearch(const std::vector<city_t>& cities,
+                      const DistanceOracle&      oracle,
+                      const uint32_t             mask,
+                      const double               greedyDistance)
+{
+    uint32_t           type;
+    uint64_t           evaluated;
+    double             searchTime;
+    double             distance;
+    std::streambuf*    output;
+    LocalSearchSolver* solver;
+
+    std::vector<uint32_t> solution;
+    std::chrono::high_resolution_clock::time_point start;
+
+    /* The lists build and the greedy tour are timed */
+    output = std::cout.rdbuf(nullptr);
+    start  = std::chrono::high_resolution_clock::now();
+    if(((mask >> MOVE_LIN_KERNIGHAN) & 1) != 0)
+    {
+        solver = new LinKernighanSolver(cities, &oracle, UINT32_MAX, "");
+    }
+    else
+    {
+        solver = new LocalSearchSolver(cities, &oracle, UINT32_MAX, "");
+    }
+    for(type = 0; type < MOVE_TYPE_COUNT; ++type)
+    {
+        solver->setMoveEnabled((MoveType)type, (mask >> type) & 1);
+    }
+    solver->solve(solution, distance);
+    searchTime = getElapsed(start);
+    std::cout.rdbuf(output);
+
+    evaluated = 0;
+    std::cout << "    ";
+    for(type = 0; type < MOVE_TYPE_COUNT; ++type)
+    {
+        if(((mask >> type) & 1) != 0)
+        {
+            std::cout << LocalSearchSolver::getMoveName((MoveType)type)
+                      << " " << solver->getStats((MoveType)type).applied
+                      << "/" << solver->getStats((MoveType)type).evaluated
+                      << " ";
+        }
+        evaluated += solver->getStats((MoveType)type).evaluated;
+    }
+    std::cout << "| " << searchTime << "s | "
+              << evaluated / searchTime << " evaluations/s | tour "
+              << distance << " (-"
+              << 100 * (1 - distance / greedyDistance) << "%, "
+              << (greedyDistance - distance) / searchTime << " gain/s)"
+              << std::endl;
+
+    delete solver;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t passes;
+    double   naiveTime;
+    double   greedyDistance;
+    city_t   city;
+
+    std::vector<city_t>   cities;
+    std::vector<uint32_t> sizes;
+    std::vector<uint32_t> solution;
+    std::chrono::high_resolution_clock::time_point start;
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> coordinate(0, BENCH_MAP_SIZE);
+
+    /* Arguments: [CITIES...] */
+    for(i = 1; i < (uint32_t)argc; ++i)
+    {
+        sizes.push_back(std::stoul(argv[i]));
+    }
+    if(sizes.empty())
+    {
+        sizes = {1000, 5000, 20000, 100000};
+    }
+
+    for(i = 0; i < sizes.size(); ++i)
+    {
+        cities.clear();
+        for(j = 0; j < sizes[i]; ++j)
+        {
+            city.id = j;
+            city.x  = coordinate(generator);
+            city.y  = coordinate(generator);
+            cities.push_back(city);
+        }
+        DistanceOracle oracle(cities);
+
+        GreedySolver greedy(cities, &oracle);
+        greedy.solve(solution, greedyDistance);
+        std::cout << "Cities: " << sizes[i] << " | greedy tour "
+                  << greedyDistance << std::endl;
+
+        /* 2-opt, 2-opt and Or-opt, all the moves, Lin-Kernighan */
+        runSearch(cities, oracle, 1, greedyDistance);
+        runSearch(cities, oracle, 3, greedyDistance);
+        runSearch(cities, oracle, 7, greedyDistance);
+        runSearch(cities, oracle, 8, greedyDistance);
+
+        /* The naive search is quadratic per pass, only run it on the small
+         * problems */
+        if(sizes[i] <= BENCH_NAIVE_SIZE)
+        {
+            start     = std::chrono::high_resolution_clock::now();
+            passes    = improveNaive(oracle, solution);
+            naiveTime = getElapsed(start);
+            std::cout << "    naive 2-opt " << passes << " passes | "
+                      << naiveTime << "s | tour "
+                      << oracle.getTourLength(solution) << std::endl;
+        }
+    }
+
+    return 0;
+}
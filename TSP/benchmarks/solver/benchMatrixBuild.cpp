@@ -0,0 +1,145 @@
+#include <iostream>  /* std::cout, std::endl */
+#include <chrono>    /* std::chrono */
+#include <string>    /* std::stoul */
+#include <vector>    /* std::vector */
+#include <random>    /* std::mt19937, std::uniform_real_distribution */
+#include <cmath>     /* std::sqrt */
+
+#include "solver/Solver.h"
+#include "solver/ThreadPool.h"
+#include "solver/FullMatrixDistanceProvider.h"
+#include "solver/TriangularDistanceProvider.h"
+
+using namespace nsSolver;
+
+#define DEFAULT_RUNS   3U
+#define BENCH_MAP_SIZE 10000.0
+
+/* Returns the elapsed time since start in seconds */
+static double getElapsed(
+                const std::chrono::high_resolution_clock::time_point& start)
+{
+    return std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - start).count();
+}
+
+/* Builds the full matrix row by row, every entry computed from the array of
+ * cities */
+static double buildNaive(const std::vector<city_t>& cities)
+{
+    uint32_t i;
+    uint32_t j;
+    double   checksum;
+    double   x;
+    double   y;
+
+    std::vector<double> matrix(cities.size() * cities.size());
+
+    for(i = 0; i < cities.size(); ++i)
+    {
+        for(j = 0; j < cities.size(); ++j)
+        {
+            x = cities[i].x - cities[j].x;
+            y = cities[i].y - cities[j].y;
+            matrix[i * cities.size() + j] = std::sqrt(x * x + y * y);
+        }
+    }
+
+    /* Keeps the build from being optimized away */
+    checksum = 0;
+    for(i = 0; i < cities.size(); ++i)
+    {
+        checksum += matrix[i * cities.size() + cities.size() - 1 - i];
+    }
+    return checksum;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+    uint32_t runs;
+    double   naiveTime;
+    double   matrixTime;
+    double   triangleTime;
+    double   rebuildTime;
+    double   checksum;
+    city_t   city;
+
+    std::vector<city_t>   cities;
+    std::vector<uint32_t> sizes;
+    std::chrono::high_resolution_clock::time_point start;
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> coordinate(0, BENCH_MAP_SIZE);
+
+    /* Arguments: [RUNS] [CITIES...] */
+    runs = DEFAULT_RUNS;
+    if(argc > 1)
+    {
+        runs = std::stoul(argv[1]);
+    }
+    for(i = 2; i < (uint32_t)argc; ++i)
+    {
+        sizes.push_back(std::stoul(argv[i]));
+    }
+    if(sizes.empty())
+    {
+        sizes = {1000, 2000, 5000, 10000};
+    }
+    if(runs == 0)
+    {
+        runs = 1;
+    }
+
+    std::cout << "Threads: " << ThreadPool().getThreadCount()
+              << " | Runs: " << runs << std::endl;
+    checksum = 0;
+    for(i = 0; i < sizes.size(); ++i)
+    {
+        cities.clear();
+        for(j = 0; j < sizes[i]; ++j)
+        {
+            city.id = j;
+            city.x  = coordinate(generator);
+            city.y  = coordinate(generator);
+            cities.push_back(city);
+        }
+
+        naiveTime    = 0;
+        matrixTime   = 0;
+        triangleTime = 0;
+        rebuildTime  = 0;
+        for(k = 0; k < runs; ++k)
+        {
+            start      = std::chrono::high_resolution_clock::now();
+            checksum  += buildNaive(cities);
+            naiveTime += getElapsed(start);
+
+            start = std::chrono::high_resolution_clock::now();
+            FullMatrixDistanceProvider matrix(cities, HUGE_PAGES_OFF);
+            matrixTime += getElapsed(start);
+
+            start = std::chrono::high_resolution_clock::now();
+            TriangularDistanceProvider triangle(cities, HUGE_PAGES_OFF);
+            triangleTime += getElapsed(start);
+
+            /* Same cities, nothing to rebuild */
+            start = std::chrono::high_resolution_clock::now();
+            matrix.rebuild(cities);
+            rebuildTime += getElapsed(start);
+
+            checksum += matrix.getDistance(0, sizes[i] - 1);
+        }
+
+        std::cout << "Cities: " << sizes[i] << " | naive "
+                  << naiveTime / runs << "s | tiled matrix "
+                  << matrixTime / runs << "s | tiled triangular "
+                  << triangleTime / runs << "s | unchanged rebuild "
+                  << rebuildTime / runs << "s" << std::endl;
+    }
+    std::cout << "Checksum: " << checksum << std::endl;
+
+    return 0;
+}
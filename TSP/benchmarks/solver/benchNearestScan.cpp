@@ -0,0 +1,154 @@
+#include <iostream>  /* std::cout, std::endl */
+#include <chrono>    /* std::chrono */
+#include <string>    /* std::stoul */
+#include <vector>    /* std::vector */
+#include <random>    /* std::mt19937, std::uniform_real_distribution */
+
+#include "solver/Solver.h"
+#include "solver/DistanceOracle.h"
+#include "solver/SpatialGrid.h"
+
+using namespace nsSolver;
+
+#define DEFAULT_RUNS   3U
+#define BENCH_MAP_SIZE 10000.0
+
+/* Returns the elapsed time since start in seconds */
+static double getElapsed(
+                const std::chrono::high_resolution_clock::time_point& start)
+{
+    return std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - start).count();
+}
+
+/* Builds a nearest neighbour tour with the scan of the oracle, returns the
+ * last city */
+static uint32_t scanTour(const DistanceOracle& oracle)
+{
+    uint32_t i;
+    uint32_t current;
+
+    std::vector<uint8_t> visited(oracle.getCityCount(), false);
+
+    current    = 0;
+    visited[0] = true;
+    for(i = 1; i < oracle.getCityCount(); ++i)
+    {
+        current          = oracle.getNearest(current, visited);
+        visited[current] = true;
+    }
+
+    return current;
+}
+
+/* Builds a nearest neighbour tour with a spatial grid, returns the last
+ * city */
+static uint32_t gridTour(const std::vector<city_t>& cities)
+{
+    uint32_t i;
+    uint32_t current;
+
+    SpatialGrid grid(cities);
+
+    current = 0;
+    grid.remove(0);
+    for(i = 1; i < cities.size(); ++i)
+    {
+        current = grid.getNearest(cities[current].x, cities[current].y);
+        grid.remove(current);
+    }
+
+    return current;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+    uint32_t runs;
+    uint32_t checksum;
+    double   times[3];
+    city_t   city;
+
+    std::vector<city_t>   cities;
+    std::vector<uint32_t> sizes;
+    std::chrono::high_resolution_clock::time_point start;
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> coordinate(0, BENCH_MAP_SIZE);
+
+    /* Arguments: [RUNS] [CITIES...] */
+    runs = DEFAULT_RUNS;
+    if(argc > 1)
+    {
+        runs = std::stoul(argv[1]);
+    }
+    for(i = 2; i < (uint32_t)argc; ++i)
+    {
+        sizes.push_back(std::stoul(argv[i]));
+    }
+    if(sizes.empty())
+    {
+        sizes = {250, 500, 1000, 2000, 4000, 8000};
+    }
+    if(runs == 0)
+    {
+        runs = 1;
+    }
+
+    std::cout << "Best kernel: "
+              << DistanceOracle::getScanKernelName(
+                    DistanceOracle::getBestScanKernel())
+              << " | Runs: " << runs << std::endl;
+    checksum = 0;
+    for(i = 0; i < sizes.size(); ++i)
+    {
+        cities.clear();
+        for(j = 0; j < sizes[i]; ++j)
+        {
+            city.id = j;
+            city.x  = coordinate(generator);
+            city.y  = coordinate(generator);
+            cities.push_back(city);
+        }
+
+        DistanceOracle oracle(cities);
+        times[0] = 0;
+        times[1] = 0;
+        times[2] = 0;
+        for(k = 0; k < runs; ++k)
+        {
+            oracle.setScanKernel(SCAN_KERNEL_SCALAR);
+            start     = std::chrono::high_resolution_clock::now();
+            checksum += scanTour(oracle);
+            times[0] += getElapsed(start);
+
+            if(oracle.setScanKernel(SCAN_KERNEL_AVX2))
+            {
+                start     = std::chrono::high_resolution_clock::now();
+                checksum += scanTour(oracle);
+                times[1] += getElapsed(start);
+            }
+
+            start     = std::chrono::high_resolution_clock::now();
+            checksum += gridTour(cities);
+            times[2] += getElapsed(start);
+        }
+
+        std::cout << "Cities: " << sizes[i] << " | scalar scan "
+                  << times[0] / runs << "s | avx2 scan ";
+        if(oracle.getScanKernel() == SCAN_KERNEL_AVX2)
+        {
+            std::cout << times[1] / runs << "s";
+        }
+        else
+        {
+            std::cout << "unsupported";
+        }
+        std::cout << " | grid " << times[2] / runs << "s" << std::endl;
+    }
+    std::cout << "Checksum: " << checksum << std::endl;
+
+    return 0;
+}
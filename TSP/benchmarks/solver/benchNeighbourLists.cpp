@@ -0,0 +1,93 @@
+#include <iostream>  /* std::cout, std::endl */
+#include <chrono>    /* std::chrono */
+#include <string>    /* std::stoul */
+#include <vector>    /* std::vector */
+#include <random>    /* std::mt19937, std::uniform_real_distribution */
+#include <cstdio>    /* std::remove */
+
+#include "solver/Solver.h"
+#include "solver/NeighbourLists.h"
+
+using namespace nsSolver;
+
+#define BENCH_MAP_SIZE 10000.0
+
+/* Returns the elapsed time since start in seconds */
+static double getElapsed(
+                const std::chrono::high_resolution_clock::time_point& start)
+{
+    return std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - start).count();
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t q;
+    double   buildTime;
+    double   loadTime;
+    city_t   city;
+
+    std::string           directory;
+    std::vector<city_t>   cities;
+    std::vector<uint32_t> sizes;
+    std::chrono::high_resolution_clock::time_point start;
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> coordinate(0, BENCH_MAP_SIZE);
+
+    /* Arguments: DIRECTORY [CITIES...] */
+    if(argc < 2)
+    {
+        std::cout << "Usage: benchNeighbourLists DIRECTORY [CITIES...]"
+                  << std::endl;
+        return -1;
+    }
+    directory = argv[1];
+    for(i = 2; i < (uint32_t)argc; ++i)
+    {
+        sizes.push_back(std::stoul(argv[i]));
+    }
+    if(sizes.empty())
+    {
+        sizes = {10000, 100000, 1000000};
+    }
+
+    for(i = 0; i < sizes.size(); ++i)
+    {
+        cities.clear();
+        for(j = 0; j < sizes[i]; ++j)
+        {
+            city.id = j;
+            city.x  = coordinate(generator);
+            city.y  = coordinate(generator);
+            cities.push_back(city);
+        }
+
+        /* Nearest only, then nearest and quadrant neighbours */
+        for(q = 0; q <= 2; q += 2)
+        {
+            start = std::chrono::high_resolution_clock::now();
+            NeighbourLists built(cities, 10, q, directory);
+            buildTime = getElapsed(start);
+
+            start = std::chrono::high_resolution_clock::now();
+            NeighbourLists loaded(cities, 10, q, directory);
+            loadTime = getElapsed(start);
+
+            std::cout << "Cities: " << sizes[i] << " | nearest 10 | quadrant "
+                      << q << " | build " << buildTime << "s | cached load "
+                      << loadTime << "s (" << (loaded.isCached() ? "hit" :
+                                                                   "miss")
+                      << ") | memory " << built.getMemoryFootprint()
+                      << " bytes" << std::endl;
+
+            std::remove(NeighbourLists::getCacheFile(
+                            directory, NeighbourLists::getHash(cities),
+                            10, q).c_str());
+        }
+    }
+
+    return 0;
+}
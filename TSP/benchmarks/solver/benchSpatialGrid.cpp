@@ -0,0 +1,133 @@
+#include <iostream>  /* std::cout, std::endl */
+#include <chrono>    /* std::chrono */
+#include <string>    /* std::stoul */
+#include <vector>    /* std::vector */
+#include <random>    /* std::mt19937, std::uniform_real_distribution */
+
+#include "solver/Solver.h"
+#include "solver/GreedySolver.h"
+#include "solver/DistanceOracle.h"
+#include "solver/SpatialGrid.h"
+
+using namespace nsSolver;
+
+#define BENCH_MAP_SIZE  10000.0
+#define BENCH_SCAN_SIZE 50000U
+
+/* Returns the elapsed time since start in seconds */
+static double getElapsed(
+                const std::chrono::high_resolution_clock::time_point& start)
+{
+    return std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - start).count();
+}
+
+/* Builds the nearest neighbour tour by scanning every city at each step,
+ * returns the tour length */
+static double getScanTour(const std::vector<city_t>& cities)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t current;
+    uint32_t best;
+    double   bestDistance;
+    double   candidate;
+    double   length;
+
+    std::vector<uint8_t> visited(cities.size(), false);
+
+    DistanceOracle oracle(cities);
+
+    current    = 0;
+    length     = 0;
+    visited[0] = true;
+    for(i = 1; i < cities.size(); ++i)
+    {
+        best         = 0;
+        bestDistance = -1;
+        for(j = 0; j < cities.size(); ++j)
+        {
+            if(visited[j])
+            {
+                continue;
+            }
+            candidate = oracle.getDistance(current, j);
+            if(bestDistance == -1 || candidate < bestDistance)
+            {
+                best         = j;
+                bestDistance = candidate;
+            }
+        }
+        visited[best] = true;
+        length       += bestDistance;
+        current       = best;
+    }
+
+    return length + oracle.getDistance(current, 0);
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t i;
+    uint32_t j;
+    double   gridTime;
+    double   scanTime;
+    double   distance;
+    double   scanDistance;
+    city_t   city;
+
+    std::vector<city_t>   cities;
+    std::vector<uint32_t> sizes;
+    std::vector<uint32_t> solution;
+    std::chrono::high_resolution_clock::time_point start;
+    std::streambuf* output;
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> coordinate(0, BENCH_MAP_SIZE);
+
+    /* Arguments: [CITIES...] */
+    for(i = 1; i < (uint32_t)argc; ++i)
+    {
+        sizes.push_back(std::stoul(argv[i]));
+    }
+    if(sizes.empty())
+    {
+        sizes = {10000, 50000, 200000, 1000000};
+    }
+
+    for(i = 0; i < sizes.size(); ++i)
+    {
+        cities.clear();
+        for(j = 0; j < sizes[i]; ++j)
+        {
+            city.id = j;
+            city.x  = coordinate(generator);
+            city.y  = coordinate(generator);
+            cities.push_back(city);
+        }
+
+        /* Silence the solver progress */
+        output = std::cout.rdbuf(nullptr);
+        start  = std::chrono::high_resolution_clock::now();
+        GreedySolver solver(cities);
+        solver.solve(solution, distance);
+        gridTime = getElapsed(start);
+        std::cout.rdbuf(output);
+
+        std::cout << "Cities: " << sizes[i] << " | grid " << gridTime
+                  << "s | tour " << distance;
+
+        /* The scan is quadratic, only run it on the small problems */
+        if(sizes[i] <= BENCH_SCAN_SIZE)
+        {
+            start        = std::chrono::high_resolution_clock::now();
+            scanDistance = getScanTour(cities);
+            scanTime     = getElapsed(start);
+            std::cout << " | scan " << scanTime << "s | tour "
+                      << scanDistance;
+        }
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include <iostream>  /* std::cout, std::endl */
+#include <chrono>    /* std::chrono */
+#include <string>    /* std::stoul, std::string */
+#include <vector>    /* std::vector */
+#include <random>    /* std::mt19937 */
+#include <algorithm> /* std::shuffle, std::max */
+
+#include "solver/Tour.h"
+#include "solver/ArrayTour.h"
+#include "solver/TwoLevelListTour.h"
+
+using namespace nsSolver;
+
+#define BENCH_QUERY_COUNT   1000000U
+#define BENCH_SHORT_LENGTH  50U
+#define BENCH_REVERSE_WORK  200000000ULL
+#define BENCH_REVERSE_COUNT 100U
+
+/* Returns the elapsed time since start in seconds */
+static double getElapsed(
+                const std::chrono::high_resolution_clock::time_point& start)
+{
+    return std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - start).count();
+}
+
+/* Times the queries and the reversals of a tour, prints the time of each
+ * operation in nanoseconds */
+static void runTour(Tour&              tour,
+                    const std::string& name,
+                    const uint32_t     reverseCount)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t size;
+    uint32_t city;
+    uint32_t to;
+    uint64_t checksum;
+    double   nextTime;
+    double   betweenTime;
+    double   shortTime;
+    double   longTime;
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    std::mt19937 generator(0);
+
+    size     = tour.getCityCount();
+    checksum = 0;
+
+    /* Walk the tour two steps forward and one backward */
+    city  = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for(i = 0; i < BENCH_QUERY_COUNT; ++i)
+    {
+        city = tour.getNext(tour.getNext(city));
+        city = tour.getPrev(city);
+    }
+    nextTime  = getElapsed(start) / (3 * BENCH_QUERY_COUNT);
+    checksum += city;
+
+    start = std::chrono::high_resolution_clock::now();
+    for(i = 0; i < BENCH_QUERY_COUNT; ++i)
+    {
+        checksum += tour.isBetween(generator() % size, generator() % size,
+                                   generator() % size);
+    }
+    betweenTime = getElapsed(start) / BENCH_QUERY_COUNT;
+
+    /* The paths of the local search moves are short */
+    start = std::chrono::high_resolution_clock::now();
+    for(i = 0; i < BENCH_QUERY_COUNT; ++i)
+    {
+        city = generator() % size;
+        to   = city;
+        for(j = generator() % BENCH_SHORT_LENGTH; j > 0; --j)
+        {
+            to = tour.getNext(to);
+        }
+        tour.reverse(city, to);
+    }
+    shortTime = getElapsed(start) / BENCH_QUERY_COUNT;
+
+    /* Random paths, half of the tour on average */
+    start = std::chrono::high_resolution_clock::now();
+    for(i = 0; i < reverseCount; ++i)
+    {
+        tour.reverse(generator() % size, generator() % size);
+    }
+    longTime = getElapsed(start) / reverseCount;
+
+    std::cout << "    " << name << " | next/prev " << nextTime * 1e9
+              << "ns | between " << betweenTime * 1e9
+              << "ns | short reverse " << shortTime * 1e9
+              << "ns | random reverse " << longTime * 1e9
+              << "ns | checksum " << checksum << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t reverseCount;
+
+    std::vector<uint32_t> sizes;
+    std::vector<uint32_t> order;
+
+    std::mt19937 generator(0);
+
+    /* Arguments: [CITIES...] */
+    for(i = 1; i < (uint32_t)argc; ++i)
+    {
+        sizes.push_back(std::stoul(argv[i]));
+    }
+    if(sizes.empty())
+    {
+        sizes = {1000, 10000, 100000, 1000000};
+    }
+
+    for(i = 0; i < sizes.size(); ++i)
+    {
+        order.resize(sizes[i]);
+        for(j = 0; j < sizes[i]; ++j)
+        {
+            order[j] = j;
+        }
+        std::shuffle(order.begin(), order.end(), generator);
+
+        /* An array reversal moves a quarter of the tour on average */
+        reverseCount = std::max<uint64_t>(BENCH_REVERSE_COUNT,
+                                          BENCH_REVERSE_WORK / sizes[i]);
+
+        std::cout << "Cities: " << sizes[i] << " | " << reverseCount
+                  << " random reversals" << std::endl;
+
+        ArrayTour arrayTour(order);
+        runTour(arrayTour, "array", reverseCount);
+
+        TwoLevelListTour listTour(order);
+        runTour(listTour, "two-level list", reverseCount);
+        std::cout << "        " << listTour.getSegmentCount()
+                  << " segments, " << listTour.getRebuildCount()
+                  << " rebuilds" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * File: AlignedAllocator.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Standard allocator returning memory aligned on a given boundary. Used by
+ * the coordinate arrays so vector loads never cross a cache line.
+ ******************************************************************************/
+
+#ifndef __SOLVER_ALIGNED_ALLOCATOR_H_
+#define __SOLVER_ALIGNED_ALLOCATOR_H_
+
+#include <cstddef> /* size_t */
+#include <cstdlib> /* posix_memalign, free */
+#include <new>     /* std::bad_alloc */
+#include <vector>  /* std::vector */
+
+/** @brief Alignment of the coordinate arrays, one cache line. */
+#define CITY_ARRAY_ALIGNMENT 64
+
+/**
+ * @brief TSP problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Aligned allocator, allocates the memory with posix_memalign.
+     *
+     * @tparam T The allocated type.
+     * @tparam ALIGNMENT The alignment in bytes, a power of two multiple of
+     * the pointer size.
+     */
+    template<typename T, size_t ALIGNMENT = CITY_ARRAY_ALIGNMENT>
+    class AlignedAllocator
+    {
+        public:
+            typedef T value_type;
+
+            /**
+             * @brief Rebinds the allocator to another type.
+             *
+             */
+            template<typename U>
+            struct rebind
+            {
+                typedef AlignedAllocator<U, ALIGNMENT> other;
+            };
+
+            /**
+             * @brief Construct a new Aligned Allocator object.
+             *
+             */
+            AlignedAllocator(void) noexcept
+            {
+            }
+
+            /**
+             * @brief Construct a new Aligned Allocator object from an
+             * allocator of another type.
+             *
+             */
+            template<typename U>
+            AlignedAllocator(const AlignedAllocator<U, ALIGNMENT>&) noexcept
+            {
+            }
+
+            /**
+             * @brief Allocates an aligned array.
+             *
+             * @param[in] count The number of elements.
+             *
+             * @return T* The array.
+             */
+            T* allocate(const size_t count)
+            {
+                void* memory;
+
+                if(posix_memalign(&memory, ALIGNMENT, count * sizeof(T)) != 0)
+                {
+                    throw std::bad_alloc();
+                }
+
+                return static_cast<T*>(memory);
+            }
+
+            /**
+             * @brief Releases an array.
+             *
+             * @param[in] memory The array.
+             */
+            void deallocate(T* memory, const size_t)
+            {
+                free(memory);
+            }
+    };
+
+    template<typename T, typename U, size_t ALIGNMENT>
+    bool operator==(const AlignedAllocator<T, ALIGNMENT>&,
+                    const AlignedAllocator<U, ALIGNMENT>&)
+    {
+        return true;
+    }
+
+    template<typename T, typename U, size_t ALIGNMENT>
+    bool operator!=(const AlignedAllocator<T, ALIGNMENT>&,
+                    const AlignedAllocator<U, ALIGNMENT>&)
+    {
+        return false;
+    }
+
+    /**
+     * @brief Coordinates array, aligned on a cache line.
+     *
+     */
+    typedef std::vector<double, AlignedAllocator<double>> coordinates_t;
+}
+
+#endif /* #ifndef __SOLVER_ALIGNED_ALLOCATOR_H_ */
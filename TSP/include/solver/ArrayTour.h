@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * File: ArrayTour.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Array tour, implements the Tour interface with the order of visit and the
+ * position of each city in it.
+ ******************************************************************************/
+
+#ifndef __SOLVER_ARRAY_TOUR_H_
+#define __SOLVER_ARRAY_TOUR_H_
+
+#include <cstdint> /* Generic int types */
+#include <vector>  /* std::vector */
+
+#include <solver/Tour.h> /* nsSolver::Tour */
+
+/**
+ * @brief TSP problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Array tour. next, prev and between are O(1), a reversal swaps
+     * the cities of the shorter of the path and the rest of the tour, so it
+     * costs at most N / 2 swaps.
+     *
+     */
+    class ArrayTour: public Tour
+    {
+        private:
+            /**
+             * @brief The cities in their order of visit.
+             *
+             */
+            std::vector<uint32_t> order;
+
+            /**
+             * @brief The position of each city in order.
+             *
+             */
+            std::vector<uint32_t> position;
+
+        public:
+            /**
+             * @brief Default contructor, unused.
+             *
+             */
+            ArrayTour(void) = delete;
+
+            /**
+             * @brief Construct a new Array Tour object.
+             *
+             * @param[in] order The cities in their order of visit, a
+             * permutation of the cities.
+             */
+            ArrayTour(const std::vector<uint32_t>& order);
+
+            /**
+             * @brief Destroy the Array Tour object.
+             *
+             */
+            virtual ~ArrayTour(void);
+
+            /**
+             * @brief Returns the city visited after a city.
+             *
+             * @param[in] city The city.
+             *
+             * @return uint32_t The next city.
+             */
+            virtual uint32_t getNext(const uint32_t city) const;
+
+            /**
+             * @brief Returns the city visited before a city.
+             *
+             * @param[in] city The city.
+             *
+             * @return uint32_t The previous city.
+             */
+            virtual uint32_t getPrev(const uint32_t city) const;
+
+            /**
+             * @brief Tells if a city is on the path going forward from a
+             * city to another, both ends included.
+             *
+             * @param[in] from The first city of the path.
+             * @param[in] city The tested city.
+             * @param[in] to The last city of the path.
+             *
+             * @return True if the city is on the path, false otherwise.
+             */
+            virtual bool isBetween(const uint32_t from,
+                                   const uint32_t city,
+                                   const uint32_t to) const;
+
+            /**
+             * @brief Reverses the path going forward from a city to another,
+             * or the rest of the tour when it is shorter.
+             *
+             * @param[in] from The first city of the path.
+             * @param[in] to The last city of the path.
+             */
+            virtual void reverse(const uint32_t from, const uint32_t to);
+
+            /**
+             * @brief Returns the number of cities.
+             *
+             * @return uint32_t The number of cities.
+             */
+            virtual uint32_t getCityCount(void) const;
+    };
+}
+
+#endif /* #ifndef __SOLVER_ARRAY_TOUR_H_ */
@@ -0,0 +1,219 @@
+/*******************************************************************************
+ * File: DistanceOracle.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * DistanceOracle implements the DistanceProvider class. The oracle computes
+ * the Euclidean distance between two cities on demand from their
+ * coordinates. The oracle memory is linear in the number of cities, where a
+ * distance matrix is quadratic.
+ ******************************************************************************/
+
+#ifndef __SOLVER_DISTANCE_ORACLE_H_
+#define __SOLVER_DISTANCE_ORACLE_H_
+
+#include <cstdint> /* Generic int types */
+#include <cstddef> /* size_t */
+#include <vector>  /* std::vector */
+#include <cmath>   /* std::sqrt */
+
+#include <solver/Solver.h>           /* city_t */
+#include <solver/DistanceProvider.h> /* nsSolver::DistanceProvider */
+#include <solver/AlignedAllocator.h> /* coordinates_t */
+
+/** @brief Returned by the nearest city scan when every city is visited. */
+#define DISTANCE_ORACLE_NONE UINT32_MAX
+
+/**
+ * @brief TSP problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Kernels of the nearest unvisited city scan.
+     *
+     */
+    enum ScanKernel
+    {
+        SCAN_KERNEL_SCALAR,
+        SCAN_KERNEL_AVX2
+    };
+
+    /**
+     * @brief Distance oracle, computes the distances between the cities on
+     * demand.
+     *
+     * The coordinates are copied in two separate arrays so a run of distances
+     * from one city reads contiguous memory. A distance costs two
+     * subtractions, two multiplications and a square root, which is cheaper
+     * than the cache miss of a matrix read once the matrix exceeds the last
+     * level cache. Runs of distances are computed two at a time with SSE2
+     * when the target supports it.
+     *
+     * The oracle also scans all the cities for the nearest one not visited
+     * yet. The scan kernel is selected when the oracle is created: the AVX2
+     * kernel compares four cities at a time when the processor supports it,
+     * the scalar kernel is used otherwise.
+     *
+     */
+    class DistanceOracle: public DistanceProvider
+    {
+        private:
+            /**
+             * @brief The abscissa of each city.
+             *
+             */
+            coordinates_t x;
+
+            /**
+             * @brief The ordinate of each city.
+             *
+             */
+            coordinates_t y;
+
+            /**
+             * @brief The nearest unvisited city scan kernel.
+             *
+             */
+            ScanKernel kernel;
+
+        public:
+            /**
+             * @brief Default contructor, unused.
+             *
+             */
+            DistanceOracle(void) = delete;
+
+            /**
+             * @brief Construct a new Distance Oracle object.
+             *
+             * @param[in] cities The cities, the index of a city in the array
+             * is its index in the oracle.
+             */
+            DistanceOracle(const std::vector<city_t>& cities);
+
+            /**
+             * @brief Destroy the Distance Oracle object.
+             *
+             */
+            virtual ~DistanceOracle(void);
+
+            /**
+             * @brief Returns the number of cities.
+             *
+             * @return uint32_t The number of cities.
+             */
+            virtual uint32_t getCityCount(void) const;
+
+            /**
+             * @brief Returns the memory used by the oracle.
+             *
+             * @return size_t The number of bytes.
+             */
+            virtual size_t getMemoryFootprint(void) const;
+
+            /**
+             * @brief Returns the backend name.
+             *
+             * @return const char* The backend name.
+             */
+            virtual const char* getName(void) const;
+
+            /**
+             * @brief Computes the distances from a city to a range of
+             * cities.
+             *
+             * @param[in] from The index of the city.
+             * @param[in] start The first city of the range.
+             * @param[in] end The city after the last city of the range.
+             * @param[out] distances The distances, end - start entries.
+             */
+            void getDistances(const uint32_t from,
+                              const uint32_t start,
+                              const uint32_t end,
+                              double*        distances) const;
+
+            /**
+             * @brief Tells if the oracle was built from the given cities.
+             *
+             * @param[in] cities The cities.
+             *
+             * @return True if the cities have the same coordinates in the same
+             * order, false otherwise.
+             */
+            bool hasCities(const std::vector<city_t>& cities) const;
+
+            /**
+             * @brief Returns the nearest city not visited yet. Equally
+             * distant cities are ordered by index.
+             *
+             * @param[in] from The index of the city.
+             * @param[in] visited The visited flag of each city, non zero
+             * when visited.
+             *
+             * @return uint32_t The nearest unvisited city,
+             * DISTANCE_ORACLE_NONE when every city is visited.
+             */
+            uint32_t getNearest(const uint32_t              from,
+                                const std::vector<uint8_t>& visited) const;
+
+            /**
+             * @brief Selects the nearest city scan kernel.
+             *
+             * @param[in] kernel The kernel.
+             *
+             * @return True if the processor supports the kernel, false
+             * otherwise and the kernel is unchanged.
+             */
+            bool setScanKernel(const ScanKernel kernel);
+
+            /**
+             * @brief Returns the nearest city scan kernel.
+             *
+             * @return ScanKernel The kernel.
+             */
+            ScanKernel getScanKernel(void) const;
+
+            /**
+             * @brief Returns the fastest kernel supported by the processor.
+             *
+             * @return ScanKernel The kernel.
+             */
+            static ScanKernel getBestScanKernel(void);
+
+            /**
+             * @brief Returns the name of a kernel.
+             *
+             * @param[in] kernel The kernel.
+             *
+             * @return const char* The kernel name.
+             */
+            static const char* getScanKernelName(const ScanKernel kernel);
+
+            /**
+             * @brief Returns the Euclidean distance between two cities.
+             *
+             * @param[in] from The index of the first city.
+             * @param[in] to The index of the second city.
+             *
+             * @return double The distance between the cities.
+             */
+            virtual double getDistance(const uint32_t from,
+                                       const uint32_t to) const
+            {
+                double dX;
+                double dY;
+
+                dX = this->x[from] - this->x[to];
+                dY = this->y[from] - this->y[to];
+                return std::sqrt(dX * dX + dY * dY);
+            }
+    };
+}
+
+#endif /* #ifndef __SOLVER_DISTANCE_ORACLE_H_ */
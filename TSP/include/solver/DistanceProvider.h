@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * File: DistanceProvider.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Distance provider interface. This class defines the API used by the TSP
+ * solvers to get the distance between two cities, whatever the distances are
+ * stored or computed.
+ ******************************************************************************/
+
+#ifndef __SOLVER_DISTANCE_PROVIDER_H_
+#define __SOLVER_DISTANCE_PROVIDER_H_
+
+#include <cstdint> /* Generic int types */
+#include <cstddef> /* size_t */
+#include <vector>  /* std::vector */
+#include <string>  /* std::string */
+
+#include <solver/Solver.h>            /* city_t */
+#include <solver/HugePageAllocator.h> /* nsSolver::HugePageMode */
+
+#define DISTANCE_TILE_SIZE 128
+
+/**
+ * @brief TSP problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief DistanceProvider interface. Defines what a distance backend
+     * should implement.
+     *
+     * The backends, from the fastest lookup to the smallest footprint:
+     * matrix (8 * N * N bytes), triangular (2 * N * N bytes), neighbours
+     * (16 nearest neighbours per city, 84 bytes per city) and oracle (16
+     * bytes per city). select keeps the fastest backend that fits in a memory
+     * budget.
+     *
+     */
+    class DistanceProvider
+    {
+        public:
+            /**
+             * @brief Destroy the Distance Provider object.
+             *
+             */
+            virtual ~DistanceProvider(void) {}
+
+            /**
+             * @brief Returns the distance between two cities.
+             *
+             * @param[in] from The index of the first city.
+             * @param[in] to The index of the second city.
+             *
+             * @return double The distance between the cities.
+             */
+            virtual double getDistance(const uint32_t from,
+                                       const uint32_t to) const = 0;
+
+            /**
+             * @brief Returns the number of cities.
+             *
+             * @return uint32_t The number of cities.
+             */
+            virtual uint32_t getCityCount(void) const = 0;
+
+            /**
+             * @brief Returns the memory used by the backend.
+             *
+             * @return size_t The number of bytes.
+             */
+            virtual size_t getMemoryFootprint(void) const = 0;
+
+            /**
+             * @brief Returns the backend name, as read by create.
+             *
+             * @return const char* The backend name.
+             */
+            virtual const char* getName(void) const = 0;
+
+            /**
+             * @brief Returns the nearest neighbours of a city when the
+             * backend stores them.
+             *
+             * @param[in] city The city.
+             * @param[out] neighbours The neighbours, sorted by increasing
+             * distance.
+             *
+             * @return uint32_t The number of neighbours, 0 when the backend
+             * does not store them.
+             */
+            virtual uint32_t getNeighbours(const uint32_t   city,
+                                           const uint32_t** neighbours) const;
+
+            /**
+             * @brief Returns the length of a closed tour.
+             *
+             * @param[in] tour The cities in their order of visit.
+             *
+             * @return double The tour length, including the return to the
+             * first city.
+             */
+            double getTourLength(const std::vector<uint32_t>& tour) const;
+
+            /**
+             * @brief Creates a backend from its name: matrix, triangular,
+             * neighbours or oracle.
+             *
+             * @param[in] name The backend name.
+             * @param[in] cities The cities.
+             * @param[in] hugePages The huge page mode of the matrices.
+             * @param[in] cacheDirectory The directory of the neighbour lists
+             * cache files, empty to disable the cache.
+             *
+             * @return DistanceProvider* The backend, owned by the caller,
+             * nullptr if the name is unknown.
+             */
+            static DistanceProvider* create(const std::string&         name,
+                                            const std::vector<city_t>& cities,
+                                            const HugePageMode hugePages,
+                                            const std::string& cacheDirectory);
+
+            /**
+             * @brief Creates the backend with the fastest lookups that fits
+             * in a memory budget. The oracle is used when nothing else fits.
+             *
+             * @param[in] cities The cities.
+             * @param[in] budget The memory budget in bytes.
+             * @param[in] hugePages The huge page mode of the matrices.
+             * @param[in] cacheDirectory The directory of the neighbour lists
+             * cache files, empty to disable the cache.
+             *
+             * @return DistanceProvider* The backend, owned by the caller.
+             */
+            static DistanceProvider* select(const std::vector<city_t>& cities,
+                                            const uint64_t             budget,
+                                            const HugePageMode hugePages,
+                                            const std::string& cacheDirectory);
+
+            /**
+             * @brief Returns the memory a backend needs for a number of
+             * cities.
+             *
+             * @param[in] name The backend name.
+             * @param[in] cityCount The number of cities.
+             *
+             * @return uint64_t The number of bytes, UINT64_MAX if the name
+             * is unknown.
+             */
+            static uint64_t getRequiredMemory(const std::string& name,
+                                              const uint32_t     cityCount);
+
+            /**
+             * @brief Parses a memory size: a number of bytes with an optional
+             * K, M or G suffix (powers of 1024).
+             *
+             * @param[in] text The size.
+             * @param[out] bytes The number of bytes.
+             *
+             * @return True if the size is valid, false otherwise.
+             */
+            static bool parseSize(const std::string& text, uint64_t& bytes);
+    };
+}
+
+#endif /* #ifndef __SOLVER_DISTANCE_PROVIDER_H_ */
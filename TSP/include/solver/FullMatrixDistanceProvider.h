@@ -0,0 +1,167 @@
+/*******************************************************************************
+ * File: FullMatrixDistanceProvider.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * FullMatrixDistanceProvider implements the DistanceProvider class. The
+ * distances between every pair of cities are stored in a contiguous N x N
+ * double precision matrix.
+ ******************************************************************************/
+
+#ifndef __SOLVER_FULL_MATRIX_DISTANCE_PROVIDER_H_
+#define __SOLVER_FULL_MATRIX_DISTANCE_PROVIDER_H_
+
+#include <cstdint> /* Generic int types */
+#include <cstddef> /* size_t */
+#include <vector>  /* std::vector */
+
+#include <solver/Solver.h>            /* city_t */
+#include <solver/DistanceProvider.h>  /* nsSolver::DistanceProvider */
+#include <solver/HugePageAllocator.h> /* nsSolver::HugePageAllocator */
+#include <solver/DistanceOracle.h>    /* nsSolver::DistanceOracle */
+#include <solver/ThreadPool.h>        /* nsSolver::ThreadPool */
+
+/**
+ * @brief TSP problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Full matrix distance provider, a lookup is a single read. The
+     * matrix costs 8 * N * N bytes and may be backed by huge pages.
+     *
+     */
+    class FullMatrixDistanceProvider: public DistanceProvider
+    {
+        private:
+            /**
+             * @brief The number of cities.
+             *
+             */
+            uint32_t cityCount;
+
+            /**
+             * @brief The coordinates of the cities, computes the matrix
+             * entries.
+             *
+             */
+            DistanceOracle oracle;
+
+            /**
+             * @brief Runs the matrix build.
+             *
+             */
+            ThreadPool pool;
+
+            /**
+             * @brief Allocator of the matrix.
+             *
+             */
+            HugePageAllocator* allocator = nullptr;
+
+            /**
+             * @brief The distances, row by row.
+             *
+             */
+            double* distances = nullptr;
+
+            /**
+             * @brief Computes the matrix. The matrix is cut in square tiles
+             * of DISTANCE_TILE_SIZE cities, each tile on or above the
+             * diagonal is a task of the thread pool: the entries above the
+             * diagonal are computed and mirrored below it, so each distance
+             * is only computed once and the mirrored writes stay in the
+             * tile.
+             *
+             */
+            void build(void);
+
+            /**
+             * @brief Computes a tile of the matrix.
+             *
+             * @param[in] rowTile The tile row.
+             * @param[in] columnTile The tile column, not less than rowTile.
+             */
+            void buildTile(const uint32_t rowTile, const uint32_t columnTile);
+
+        public:
+            /**
+             * @brief Default contructor, unused.
+             *
+             */
+            FullMatrixDistanceProvider(void) = delete;
+
+            /**
+             * @brief Construct a new Full Matrix Distance Provider object
+             * and computes the matrix.
+             *
+             * @param[in] cities The cities.
+             * @param[in] hugePages The huge page mode of the matrix.
+             */
+            FullMatrixDistanceProvider(const std::vector<city_t>& cities,
+                                       const HugePageMode         hugePages);
+
+            /**
+             * @brief Destroy the Full Matrix Distance Provider object.
+             *
+             */
+            virtual ~FullMatrixDistanceProvider(void);
+
+            /**
+             * @brief Returns the distance between two cities.
+             *
+             * @param[in] from The index of the first city.
+             * @param[in] to The index of the second city.
+             *
+             * @return double The distance between the cities.
+             */
+            virtual double getDistance(const uint32_t from,
+                                       const uint32_t to) const;
+
+            /**
+             * @brief Returns the number of cities.
+             *
+             * @return uint32_t The number of cities.
+             */
+            virtual uint32_t getCityCount(void) const;
+
+            /**
+             * @brief Returns the memory used by the matrix.
+             *
+             * @return size_t The number of bytes.
+             */
+            virtual size_t getMemoryFootprint(void) const;
+
+            /**
+             * @brief Returns the backend name.
+             *
+             * @return const char* The backend name.
+             */
+            virtual const char* getName(void) const;
+
+            /**
+             * @brief Rebuilds the matrix for a new set of cities. Nothing is
+             * computed when the cities did not change.
+             *
+             * @param[in] cities The cities.
+             *
+             * @return True if the matrix was rebuilt, false otherwise.
+             */
+            bool rebuild(const std::vector<city_t>& cities);
+
+            /**
+             * @brief Returns the backing obtained for the matrix, which may
+             * be less than the requested huge page mode.
+             *
+             * @return HugePageMode The matrix backing.
+             */
+            HugePageMode getHugePageBacking(void) const;
+    };
+}
+
+#endif /* #ifndef __SOLVER_FULL_MATRIX_DISTANCE_PROVIDER_H_ */
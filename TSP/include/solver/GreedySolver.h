@@ -21,6 +21,14 @@
                       std::uniform_int_distribution */
 
 #include <solver/Solver.h> /* nsSolver::Sovler, city_t */
+/* nsSolver::DistanceProvider */
+#include <solver/DistanceProvider.h>
+#include <solver/SpatialGrid.h> /* nsSolver::SpatialGrid */
+#include <solver/DistanceOracle.h> /* nsSolver::DistanceOracle */
+
+/** @brief Number of cities from which the greedy solver builds a spatial
+ * grid instead of scanning all the cities. */
+#define GREEDY_GRID_MIN_SIZE 200
 
 /**
  * @brief TSP problem solvers.
@@ -31,6 +39,14 @@ namespace nsSolver
     /**
      * @brief Greedy Solver, implements the greedy version of the TSP solver.
      *
+     * The tour starts from the first city and always goes to the nearest
+     * city not visited yet. When the distance provider stores neighbour
+     * lists, the first unvisited city of the current city list is the
+     * nearest one. Otherwise, the nearest city is searched in a spatial grid
+     * from which the visited cities are removed. Small problems do not pay
+     * for the grid: the solver scans all the cities with the vectorized
+     * kernel of the oracle.
+     *
      */
     class GreedySolver: public Solver
     {
@@ -42,10 +58,16 @@ namespace nsSolver
             std::vector<city_t> cities;
 
             /**
-             * @brief Stores the distance between each city.
+             * @brief The cities coordinates, scanned for the nearest city.
+             *
+             */
+            DistanceOracle coordinates;
+
+            /**
+             * @brief Gives the distances between the cities.
              *
              */
-            double** distanceMatrix = nullptr;
+            const DistanceProvider* distances = nullptr;
 
             /**
              * @brief Random engine, must be seeded at object initialization.
@@ -59,6 +81,22 @@ namespace nsSolver
              */
             std::uniform_int_distribution<uint32_t> randDist;
 
+            /**
+             * @brief Searches the nearest city not visited yet.
+             *
+             * @param[in] current The current city.
+             * @param[in] visited The visited flag of each city.
+             * @param[in] grid The cities not visited yet, nullptr to scan all
+             * the cities.
+             * @param[out] bestDistance The distance to the nearest city.
+             *
+             * @return uint32_t The nearest city.
+             */
+            uint32_t getNearest(const uint32_t              current,
+                                const std::vector<uint8_t>& visited,
+                                const SpatialGrid*          grid,
+                                double& bestDistance) const;
+
         public:
             /**
              * @brief Destroy the GreedySolver object.
@@ -73,12 +111,23 @@ namespace nsSolver
             GreedySolver(void) = delete;
 
             /**
-             * @brief Construct a new Greedy Solver object
+             * @brief Construct a new Greedy Solver object, the distances are
+             * computed on demand.
              *
              * @param[in] cities he cities array the problem has to solve.
              */
             GreedySolver(const std::vector<city_t>& cities);
 
+            /**
+             * @brief Construct a new Greedy Solver object
+             *
+             * @param[in] cities he cities array the problem has to solve.
+             * @param[in] distances The distances between the cities, not
+             * owned by the solver.
+             */
+            GreedySolver(const std::vector<city_t>& cities,
+                         const DistanceProvider*    distances);
+
             /**
              * @brief Solves the TSP and store the solution in the vector given
              * as parameter.
@@ -90,7 +139,15 @@ namespace nsSolver
              */
             virtual void solve(std::vector<uint32_t>& solution,
                                double &distance);
+
+#ifdef _TESTMODE
+            /**
+             * @brief Tests the solve method.
+             *
+             */
+            void testSolve(void);
+#endif
     };
 }
 
-#endif /* #ifndef __SOLVER_GREEDY_SOLVER_H */
\ No newline at end of file
+#endif /* #ifndef __SOLVER_GREEDY_SOLVER_H */
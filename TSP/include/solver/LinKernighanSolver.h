@@ -0,0 +1,232 @@
+/*******************************************************************************
+ * File: LinKernighanSolver.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * LinKernighanSolver implements the Solver class. Any class implementing the
+ * Solver interface is assumed to solve the TSP.
+ * The algorithm improves the greedy tour with Lin-Kernighan variable depth
+ * moves until no move improves it.
+ ******************************************************************************/
+
+#ifndef __SOLVER_LIN_KERNIGHAN_SOLVER_H_
+#define __SOLVER_LIN_KERNIGHAN_SOLVER_H_
+
+#include <cstdint> /* Generic int types */
+#include <vector>  /* std::vector */
+#include <string>  /* std::string */
+
+#include <solver/Solver.h>            /* city_t */
+#include <solver/DistanceProvider.h>  /* nsSolver::DistanceProvider */
+#include <solver/LocalSearchSolver.h> /* nsSolver::LocalSearchSolver */
+#include <solver/Tour.h>              /* nsSolver::Tour */
+#include <solver/SpatialGrid.h>       /* SPATIAL_GRID_QUADRANTS */
+
+/** @brief Maximal number of candidates of a city, the size of its neighbour
+ * list. */
+#define LIN_KERNIGHAN_CANDIDATES \
+    (LOCAL_SEARCH_NEAREST_COUNT + SPATIAL_GRID_QUADRANTS * LOCAL_SEARCH_QUADRANT_COUNT)
+
+/** @brief Maximal number of exchanges in a move. */
+#define LIN_KERNIGHAN_MAX_DEPTH 50
+
+/** @brief Number of alternatives tried at the first level of a move. */
+#define LIN_KERNIGHAN_BREADTH_1 5
+
+/** @brief Number of alternatives tried at the second level of a move, the
+ * deeper levels only try the best one. */
+#define LIN_KERNIGHAN_BREADTH_2 3
+
+/**
+ * @brief TSP problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Lin-Kernighan Solver, improves the greedy tour with variable
+     * depth moves.
+     *
+     * A move starts by removing an edge (t1, t2) of the tour and keeps t1
+     * fixed. At each level, the last city t2i gets a new edge to a candidate
+     * t2i+1 and the edge (t2i+1, t2i+2) that keeps a tour is removed: the
+     * exchange is applied at once, the tour is closed by the edge
+     * (t2i+2, t1). The candidates are tried by decreasing
+     * d(t2i+1, t2i+2) - d(t2i, t2i+1) while the gain of the move without
+     * its closing edge stays positive, an added edge is never removed. The
+     * move goes down to LIN_KERNIGHAN_MAX_DEPTH levels and keeps the
+     * exchanges up to the best closed tour.
+     *
+     * The first two levels backtrack over LIN_KERNIGHAN_BREADTH_1 and
+     * LIN_KERNIGHAN_BREADTH_2 alternatives. When they all fail, the
+     * alternate first step takes t4 on the other side of t3, which does not
+     * close a tour, and completes it with the segment insertion 3-opt move
+     * before going deeper.
+     *
+     * The moves are searched from the cities of the don't-look bits queue
+     * of the LocalSearchSolver and use its neighbour lists. Every exchange
+     * goes through the Tour interface.
+     *
+     */
+    class LinKernighanSolver: public LocalSearchSolver
+    {
+        private:
+            /**
+             * @brief The exchanges of the current move, four cities each as
+             * given to Tour::exchange.
+             *
+             */
+            std::vector<uint32_t> exchanges;
+
+            /**
+             * @brief The edges added by the current move, two cities each.
+             *
+             */
+            std::vector<uint32_t> added;
+
+            /**
+             * @brief The gain of the best closed tour of the current move.
+             *
+             */
+            double bestGain;
+
+            /**
+             * @brief The number of exchanges of the best closed tour.
+             *
+             */
+            uint32_t bestCount;
+
+            /**
+             * @brief Applies an exchange and records it.
+             *
+             * @param[in, out] tour The tour.
+             * @param[in] a The first city of the first edge.
+             * @param[in] b The second city of the first edge.
+             * @param[in] c The first city of the second edge.
+             * @param[in] d The second city of the second edge.
+             */
+            void exchange(Tour&          tour,
+                          const uint32_t a,
+                          const uint32_t b,
+                          const uint32_t c,
+                          const uint32_t d);
+
+            /**
+             * @brief Undoes the last exchanges.
+             *
+             * @param[in, out] tour The tour.
+             * @param[in] count The number of exchanges to keep.
+             */
+            void undo(Tour& tour, const uint32_t count);
+
+            /**
+             * @brief Tells if an edge was added by the current move.
+             *
+             * @param[in] a The first city of the edge.
+             * @param[in] b The second city of the edge.
+             *
+             * @return True if the edge was added, false otherwise.
+             */
+            bool isAdded(const uint32_t a, const uint32_t b) const;
+
+            /**
+             * @brief Records a closed tour of the current move.
+             *
+             * @param[in] gain The gain of the closed tour.
+             */
+            void close(const double gain);
+
+            /**
+             * @brief Extends the current move by one level and goes deeper.
+             *
+             * @param[in, out] tour The tour.
+             * @param[in] level The level.
+             * @param[in] t1 The first city of the move.
+             * @param[in] last The last city of the move, next to t1.
+             * @param[in] gain The gain of the move without its closing edge.
+             *
+             * @return True if the move found an improving closed tour,
+             * false otherwise. The exchanges of the level are undone when
+             * false is returned.
+             */
+            bool deepen(Tour&          tour,
+                        const uint32_t level,
+                        const uint32_t t1,
+                        const uint32_t last,
+                        const double   gain);
+
+            /**
+             * @brief Starts a move with a segment insertion 3-opt move and
+             * goes deeper.
+             *
+             * @param[in, out] tour The tour.
+             * @param[in] t1 The first city of the move.
+             * @param[in] t2 The city next to t1, the removed edge is
+             * (t1, t2).
+             *
+             * @return True if the move found an improving closed tour,
+             * false otherwise.
+             */
+            bool alternateFirstStep(Tour&          tour,
+                                    const uint32_t t1,
+                                    const uint32_t t2);
+
+            /**
+             * @brief Applies the first improving Lin-Kernighan move starting
+             * at a city.
+             *
+             * @param[in, out] tour The tour.
+             * @param[in] city The city.
+             *
+             * @return True if a move was applied, false otherwise.
+             */
+            bool improveLinKernighan(Tour& tour, const uint32_t city);
+
+        protected:
+            /**
+             * @brief Applies the first improving Lin-Kernighan move starting
+             * at a city, then the enabled moves of the LocalSearchSolver.
+             *
+             * @param[in, out] tour The tour.
+             * @param[in] city The city.
+             *
+             * @return True if a move was applied, false otherwise.
+             */
+            virtual bool improveCity(Tour& tour, const uint32_t city);
+
+        public:
+            /**
+             * @brief Destroy the LinKernighanSolver object.
+             *
+             */
+            virtual ~LinKernighanSolver(void);
+
+            /**
+             * @brief Default contructor, unused.
+             *
+             */
+            LinKernighanSolver(void) = delete;
+
+            /**
+             * @brief Construct a new Lin Kernighan Solver object and builds
+             * the neighbour lists. Only the Lin-Kernighan moves are enabled.
+             *
+             * @param[in] cities The cities array the problem has to solve.
+             * @param[in] distances The distances between the cities, not
+             * owned by the solver, nullptr to compute them on demand.
+             * @param[in] iterCount The maximal number of applied moves.
+             * @param[in] cacheDirectory The directory of the neighbour lists
+             * cache files, empty to disable the cache.
+             */
+            LinKernighanSolver(const std::vector<city_t>& cities,
+                               const DistanceProvider*    distances,
+                               const uint32_t             iterCount,
+                               const std::string&         cacheDirectory);
+    };
+}
+
+#endif /* #ifndef __SOLVER_LIN_KERNIGHAN_SOLVER_H_ */
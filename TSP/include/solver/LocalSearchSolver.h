@@ -0,0 +1,349 @@
+/*******************************************************************************
+ * File: LocalSearchSolver.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * LocalSearchSolver implements the Solver class. Any class implementing the
+ * Solver interface is assumed to solve the TSP.
+ * The algorithm improves the greedy tour with 2-opt, Or-opt and segment
+ * insertion moves until no move improves it.
+ ******************************************************************************/
+
+#ifndef __SOLVER_LOCAL_SEARCH_SOLVER_H_
+#define __SOLVER_LOCAL_SEARCH_SOLVER_H_
+
+#include <cstdint> /* Generic int types */
+#include <vector>  /* std::vector */
+#include <string>  /* std::string */
+
+#include <solver/Solver.h>           /* nsSolver::Solver, city_t */
+#include <solver/DistanceProvider.h> /* nsSolver::DistanceProvider */
+#include <solver/DistanceOracle.h>   /* nsSolver::DistanceOracle */
+#include <solver/NeighbourLists.h>   /* nsSolver::NeighbourLists */
+#include <solver/Tour.h>             /* nsSolver::Tour */
+
+/** @brief Number of nearest cities tried as the new neighbour of a city. */
+#define LOCAL_SEARCH_NEAREST_COUNT 8
+
+/** @brief Number of nearest cities per quadrant tried as the new neighbour
+ * of a city. */
+#define LOCAL_SEARCH_QUADRANT_COUNT 2
+
+/** @brief Smallest tour length decrease of an applied move, protects the
+ * search from cycling on rounding errors. */
+#define LOCAL_SEARCH_EPSILON 1e-9
+
+/** @brief Longest segment relocated by an Or-opt move. */
+#define LOCAL_SEARCH_OR_OPT_LENGTH 3
+
+/** @brief Number of cities from which the tour is a two-level list instead
+ * of an array. */
+#define LOCAL_SEARCH_LIST_TOUR_SIZE 20000
+
+/**
+ * @brief TSP problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief The moves of the local search.
+     *
+     */
+    enum MoveType
+    {
+        MOVE_TWO_OPT           = 0,
+        MOVE_OR_OPT            = 1,
+        MOVE_SEGMENT_INSERTION = 2,
+        /** @brief Searched by the LinKernighanSolver only. */
+        MOVE_LIN_KERNIGHAN     = 3,
+        MOVE_TYPE_COUNT        = 4
+    };
+
+    /**
+     * @brief Defines the statistics of a move type.
+     *
+     */
+    struct moveStats
+    {
+        /** @brief Number of candidate moves evaluated. */
+        uint64_t evaluated;
+        /** @brief Number of moves applied. */
+        uint64_t applied;
+        /** @brief Tour length removed by the applied moves. */
+        double gain;
+    };
+    typedef struct moveStats move_stats_t;
+
+    /**
+     * @brief Local Search Solver, improves the greedy tour with 2-opt, Or-opt
+     * and segment insertion moves.
+     *
+     * A 2-opt move replaces the edges (a, b) and (c, d) by (a, c) and
+     * (b, d), its gain is computed from the four edges only. The candidates
+     * for c are the neighbour lists of a, in increasing distance, and the
+     * scan of a list stops as soon as the new edge (a, c) is not shorter
+     * than the removed edge (a, b): no improving move can follow.
+     *
+     * An Or-opt move relocates a segment of 1 to LOCAL_SEARCH_OR_OPT_LENGTH
+     * cities between two neighbours, possibly reversed, next to a candidate
+     * of one of its ends. A segment insertion move is the 3-opt move that
+     * swaps two consecutive segments of any length without reversing them:
+     * (t1, t2), (t3, t4) and (t5, t6) are replaced by (t2, t3), (t4, t5)
+     * and (t6, t1), t3 is a candidate of t2 and t5 a candidate of t4. The
+     * scans of both moves stop when the gain of the edges chosen so far is
+     * no longer positive. Both moves are applied as a sequence of
+     * reversals, so they work on any Tour.
+     *
+     * Each city has a don't-look bit: the cities to look at wait in a FIFO
+     * queue, a city leaves the queue when no move improves the tour around
+     * it, and the ends of every applied move enter it again. When the
+     * queue is empty every city enters it again, the search stops after a
+     * round without any move: the tour is then a local optimum of the
+     * enabled moves for the neighbour lists.
+     *
+     * The tour is an ArrayTour below LOCAL_SEARCH_LIST_TOUR_SIZE cities and
+     * a TwoLevelListTour above, where the O(N) array reversals dominate.
+     *
+     */
+    class LocalSearchSolver: public Solver
+    {
+        private:
+            /**
+             * @brief The cities array the problem has to solve.
+             *
+             */
+            std::vector<city_t> cities;
+
+            /**
+             * @brief The distances computed on demand, used when no distance
+             * provider is given.
+             *
+             */
+            DistanceOracle coordinates;
+
+            /**
+             * @brief Gives the distances between the cities.
+             *
+             */
+            const DistanceProvider* distances = nullptr;
+
+            /**
+             * @brief The maximal number of applied moves.
+             *
+             */
+            uint32_t iterCount;
+
+            /**
+             * @brief The number of moves applied by the last search.
+             *
+             */
+            uint64_t moveCount;
+
+            /**
+             * @brief Circular FIFO of the cities to look at.
+             *
+             */
+            std::vector<uint32_t> queue;
+
+            /**
+             * @brief First city of the queue and number of queued cities.
+             *
+             */
+            uint32_t queueHead;
+            uint32_t queueSize;
+
+            /**
+             * @brief Set for the cities in the queue, the other cities have
+             * their don't-look bit set.
+             *
+             */
+            std::vector<uint8_t> queued;
+
+            /**
+             * @brief Adds a city to the queue if it is not in it.
+             *
+             * @param[in] city The city.
+             */
+            void push(const uint32_t city);
+
+            /**
+             * @brief Applies the first improving 2-opt move removing an edge
+             * of a city.
+             *
+             * @param[in, out] tour The tour.
+             * @param[in] city The city.
+             *
+             * @return True if a move was applied, false otherwise.
+             */
+            bool improveTwoOpt(Tour& tour, const uint32_t city);
+
+            /**
+             * @brief Applies the first improving Or-opt move relocating a
+             * segment starting at a city.
+             *
+             * @param[in, out] tour The tour.
+             * @param[in] city The city.
+             *
+             * @return True if a move was applied, false otherwise.
+             */
+            bool improveOrOpt(Tour& tour, const uint32_t city);
+
+            /**
+             * @brief Applies the first improving segment insertion move
+             * removing an edge of a city.
+             *
+             * @param[in, out] tour The tour.
+             * @param[in] city The city.
+             *
+             * @return True if a move was applied, false otherwise.
+             */
+            bool improveSegmentInsertion(Tour& tour, const uint32_t city);
+
+        protected:
+            /**
+             * @brief The candidate neighbours of each city.
+             *
+             */
+            NeighbourLists lists;
+
+            /**
+             * @brief Tells which move types are searched.
+             *
+             */
+            bool moveEnabled[MOVE_TYPE_COUNT];
+
+            /**
+             * @brief The statistics of each move type for the last search.
+             *
+             */
+            move_stats_t stats[MOVE_TYPE_COUNT];
+
+            /**
+             * @brief Returns the distance between two cities.
+             *
+             * @param[in] from The first city.
+             * @param[in] to The second city.
+             *
+             * @return double The distance between the cities.
+             */
+            double getDistance(const uint32_t from, const uint32_t to) const
+            {
+                return this->distances->getDistance(from, to);
+            }
+
+            /**
+             * @brief Records an applied move and queues its ends.
+             *
+             * @param[in] type The move type.
+             * @param[in] gain The tour length removed by the move.
+             * @param[in] ends The cities whose edges changed.
+             * @param[in] endCount The number of cities in ends.
+             */
+            void applied(const MoveType  type,
+                         const double    gain,
+                         const uint32_t* ends,
+                         const uint32_t  endCount);
+
+            /**
+             * @brief Applies the first improving move removing an edge of a
+             * city, the move types are tried in the order of MoveType.
+             *
+             * @param[in, out] tour The tour.
+             * @param[in] city The city.
+             *
+             * @return True if a move was applied, false otherwise.
+             */
+            virtual bool improveCity(Tour& tour, const uint32_t city);
+
+        public:
+            /**
+             * @brief Destroy the LocalSearchSolver object.
+             *
+             */
+            virtual ~LocalSearchSolver(void);
+
+            /**
+             * @brief Default contructor, unused.
+             *
+             */
+            LocalSearchSolver(void) = delete;
+
+            /**
+             * @brief Construct a new Local Search Solver object and builds
+             * the neighbour lists.
+             *
+             * @param[in] cities The cities array the problem has to solve.
+             * @param[in] distances The distances between the cities, not
+             * owned by the solver, nullptr to compute them on demand.
+             * @param[in] iterCount The maximal number of applied moves.
+             * @param[in] cacheDirectory The directory of the neighbour lists
+             * cache files, empty to disable the cache.
+             */
+            LocalSearchSolver(const std::vector<city_t>& cities,
+                              const DistanceProvider*    distances,
+                              const uint32_t             iterCount,
+                              const std::string&         cacheDirectory);
+
+            /**
+             * @brief Improves a tour until no enabled move improves it or
+             * the maximal number of moves is reached.
+             *
+             * @param[in, out] tour The tour to improve.
+             */
+            void improve(Tour& tour);
+
+            /**
+             * @brief Returns the number of moves applied by the last search.
+             *
+             * @return uint64_t The number of moves.
+             */
+            uint64_t getMoveCount(void) const;
+
+            /**
+             * @brief Enables or disables a move type, all the move types but
+             * MOVE_LIN_KERNIGHAN are enabled by default.
+             *
+             * @param[in] type The move type.
+             * @param[in] enabled True to search the moves of the type.
+             */
+            void setMoveEnabled(const MoveType type, const bool enabled);
+
+            /**
+             * @brief Returns the statistics of a move type for the last
+             * search.
+             *
+             * @param[in] type The move type.
+             *
+             * @return const move_stats_t& The statistics.
+             */
+            const move_stats_t& getStats(const MoveType type) const;
+
+            /**
+             * @brief Returns the name of a move type.
+             *
+             * @param[in] type The move type.
+             *
+             * @return const char* The move type name.
+             */
+            static const char* getMoveName(const MoveType type);
+
+            /**
+             * @brief Solves the TSP and store the solution in the vector given
+             * as parameter.
+             *
+             * @param[out] solution The vector receiving the solution for the
+             * problem. The vector's index represents the cities order of visit.
+             *
+             * @param[out] distance The distance of the solution.
+             */
+            virtual void solve(std::vector<uint32_t>& solution,
+                               double &distance);
+    };
+}
+
+#endif /* #ifndef __SOLVER_LOCAL_SEARCH_SOLVER_H_ */
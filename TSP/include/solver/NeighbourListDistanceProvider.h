@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * File: NeighbourListDistanceProvider.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * NeighbourListDistanceProvider implements the DistanceProvider class. The
+ * provider stores the nearest neighbours of each city and computes the
+ * distances on demand.
+ ******************************************************************************/
+
+#ifndef __SOLVER_NEIGHBOUR_LIST_DISTANCE_PROVIDER_H_
+#define __SOLVER_NEIGHBOUR_LIST_DISTANCE_PROVIDER_H_
+
+#include <cstdint> /* Generic int types */
+#include <cstddef> /* size_t */
+#include <vector>  /* std::vector */
+#include <string>  /* std::string */
+
+#include <solver/Solver.h>           /* city_t */
+#include <solver/DistanceProvider.h> /* nsSolver::DistanceProvider */
+#include <solver/DistanceOracle.h>   /* nsSolver::DistanceOracle */
+#include <solver/NeighbourLists.h>   /* nsSolver::NeighbourLists */
+
+#define NEIGHBOUR_LIST_SIZE 16
+
+/**
+ * @brief TSP problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Neighbour list distance provider. The distances are computed by
+     * a distance oracle, the provider adds the NEIGHBOUR_LIST_SIZE nearest
+     * neighbours of each city, sorted by increasing distance. Good tours
+     * almost only use edges to near neighbours, the solvers use the lists as
+     * candidates before scanning all the cities.
+     *
+     * The lists are NeighbourLists without quadrant neighbours, so the first
+     * unvisited city of a list is the nearest unvisited city.
+     *
+     */
+    class NeighbourListDistanceProvider: public DistanceProvider
+    {
+        private:
+            /**
+             * @brief Computes the distances.
+             *
+             */
+            DistanceOracle oracle;
+
+            /**
+             * @brief The nearest neighbours of each city.
+             *
+             */
+            NeighbourLists lists;
+
+        public:
+            /**
+             * @brief Default contructor, unused.
+             *
+             */
+            NeighbourListDistanceProvider(void) = delete;
+
+            /**
+             * @brief Construct a new Neighbour List Distance Provider object
+             * and builds the neighbour lists.
+             *
+             * @param[in] cities The cities.
+             * @param[in] cacheDirectory The directory of the neighbour lists
+             * cache files, empty to disable the cache.
+             */
+            NeighbourListDistanceProvider(const std::vector<city_t>& cities,
+                                          const std::string& cacheDirectory);
+
+            /**
+             * @brief Destroy the Neighbour List Distance Provider object.
+             *
+             */
+            virtual ~NeighbourListDistanceProvider(void);
+
+            /**
+             * @brief Returns the distance between two cities.
+             *
+             * @param[in] from The index of the first city.
+             * @param[in] to The index of the second city.
+             *
+             * @return double The distance between the cities.
+             */
+            virtual double getDistance(const uint32_t from,
+                                       const uint32_t to) const;
+
+            /**
+             * @brief Returns the number of cities.
+             *
+             * @return uint32_t The number of cities.
+             */
+            virtual uint32_t getCityCount(void) const;
+
+            /**
+             * @brief Returns the memory used by the coordinates and the
+             * lists.
+             *
+             * @return size_t The number of bytes.
+             */
+            virtual size_t getMemoryFootprint(void) const;
+
+            /**
+             * @brief Returns the backend name.
+             *
+             * @return const char* The backend name.
+             */
+            virtual const char* getName(void) const;
+
+            /**
+             * @brief Returns the nearest neighbours of a city.
+             *
+             * @param[in] city The city.
+             * @param[out] neighbours The neighbours, sorted by increasing
+             * distance.
+             *
+             * @return uint32_t The number of neighbours.
+             */
+            virtual uint32_t getNeighbours(const uint32_t   city,
+                                           const uint32_t** neighbours) const;
+
+            /**
+             * @brief Tells if the lists were read from the cache.
+             *
+             * @return True if the lists were read from a cache file, false
+             * if they were built.
+             */
+            bool isCached(void) const;
+    };
+}
+
+#endif /* #ifndef __SOLVER_NEIGHBOUR_LIST_DISTANCE_PROVIDER_H_ */
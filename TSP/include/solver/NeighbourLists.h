@@ -0,0 +1,234 @@
+/*******************************************************************************
+ * File: NeighbourLists.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Candidate neighbour lists of the cities. The lists hold the nearest cities
+ * and optionally the nearest cities in each quadrant around a city. They are
+ * built in parallel and can be cached on disk.
+ ******************************************************************************/
+
+#ifndef __SOLVER_NEIGHBOUR_LISTS_H_
+#define __SOLVER_NEIGHBOUR_LISTS_H_
+
+#include <cstdint> /* Generic int types */
+#include <cstddef> /* size_t */
+#include <vector>  /* std::vector */
+#include <string>  /* std::string */
+
+#include <solver/Solver.h> /* city_t */
+
+/** @brief Number of cities in a build task. */
+#define NEIGHBOUR_LISTS_TASK_SIZE 1024
+
+/** @brief Magic number at the start of a cache file, "TSPNBRS1" read as a
+ * little endian integer. */
+#define NEIGHBOUR_LISTS_MAGIC 0x315352424E505354ULL
+
+/**
+ * @brief TSP problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Neighbour lists, the candidates of the tour construction and
+     * improvement heuristics.
+     *
+     * The list of a city is the union of its nearestCount nearest cities and
+     * of its quadrantCount nearest cities in each quadrant, sorted by
+     * increasing distance. Quadrant neighbours keep candidates in every
+     * direction on clustered instances, where the nearest cities all lie in
+     * the same cluster. The lists of all the cities are stored in one flat
+     * array, the list of a city starts at its offset.
+     *
+     * The lists are searched in a spatial grid, the cities are split in
+     * tasks run by a thread pool. The cache file of an instance is named
+     * after a hash of the coordinates and the list sizes, so the lists of a
+     * city file are only built once.
+     *
+     */
+    class NeighbourLists
+    {
+        private:
+            /**
+             * @brief The number of nearest cities in each list.
+             *
+             */
+            uint32_t nearestCount;
+
+            /**
+             * @brief The number of nearest cities per quadrant in each list.
+             *
+             */
+            uint32_t quadrantCount;
+
+            /**
+             * @brief The hash of the cities coordinates.
+             *
+             */
+            uint64_t hash;
+
+            /**
+             * @brief Set to true when the lists were read from a cache file.
+             *
+             */
+            bool cached;
+
+            /**
+             * @brief The first entry of each list, the last entry is the
+             * size of the lists array.
+             *
+             */
+            std::vector<uint32_t> offsets;
+
+            /**
+             * @brief The lists of all the cities.
+             *
+             */
+            std::vector<uint32_t> neighbours;
+
+            /**
+             * @brief Builds the lists.
+             *
+             * @param[in] cities The cities.
+             */
+            void build(const std::vector<city_t>& cities);
+
+            /**
+             * @brief Reads the lists from a cache file.
+             *
+             * @param[in] fileName The cache file.
+             * @param[in] cityCount The number of cities.
+             *
+             * @return True if the file holds valid lists for the cities,
+             * false otherwise.
+             */
+            bool load(const std::string& fileName, const uint32_t cityCount);
+
+            /**
+             * @brief Writes the lists to a cache file. The file is written
+             * under a temporary name then renamed, a reader never sees a
+             * partial file.
+             *
+             * @param[in] fileName The cache file.
+             *
+             * @return True if the file was written, false otherwise.
+             */
+            bool save(const std::string& fileName) const;
+
+        public:
+            /**
+             * @brief Default contructor, unused.
+             *
+             */
+            NeighbourLists(void) = delete;
+
+            /**
+             * @brief Construct a new Neighbour Lists object and builds the
+             * lists.
+             *
+             * @param[in] cities The cities.
+             * @param[in] nearestCount The number of nearest cities in each
+             * list.
+             * @param[in] quadrantCount The number of nearest cities per
+             * quadrant in each list, 0 for none.
+             * @param[in] cacheDirectory The directory of the cache files,
+             * empty to disable the cache.
+             */
+            NeighbourLists(const std::vector<city_t>& cities,
+                           const uint32_t             nearestCount,
+                           const uint32_t             quadrantCount,
+                           const std::string&         cacheDirectory);
+
+            /**
+             * @brief Destroy the Neighbour Lists object.
+             *
+             */
+            ~NeighbourLists(void);
+
+            /**
+             * @brief Returns the list of a city.
+             *
+             * @param[in] city The city.
+             * @param[out] neighbours The neighbours, sorted by increasing
+             * distance.
+             *
+             * @return uint32_t The number of neighbours.
+             */
+            uint32_t getNeighbours(const uint32_t   city,
+                                   const uint32_t** neighbours) const
+            {
+                *neighbours = this->neighbours.data() + this->offsets[city];
+                return this->offsets[city + 1] - this->offsets[city];
+            }
+
+            /**
+             * @brief Returns the number of cities.
+             *
+             * @return uint32_t The number of cities.
+             */
+            uint32_t getCityCount(void) const;
+
+            /**
+             * @brief Returns the number of nearest cities in each list.
+             *
+             * @return uint32_t The number of nearest cities.
+             */
+            uint32_t getNearestCount(void) const;
+
+            /**
+             * @brief Returns the number of nearest cities per quadrant in
+             * each list.
+             *
+             * @return uint32_t The number of nearest cities per quadrant.
+             */
+            uint32_t getQuadrantCount(void) const;
+
+            /**
+             * @brief Returns the memory used by the lists.
+             *
+             * @return size_t The number of bytes.
+             */
+            size_t getMemoryFootprint(void) const;
+
+            /**
+             * @brief Tells if the lists were read from the cache.
+             *
+             * @return True if the lists were read from a cache file, false
+             * if they were built.
+             */
+            bool isCached(void) const;
+
+            /**
+             * @brief Returns the cache file of an instance.
+             *
+             * @param[in] cacheDirectory The directory of the cache files.
+             * @param[in] hash The hash of the cities.
+             * @param[in] nearestCount The number of nearest cities.
+             * @param[in] quadrantCount The number of nearest cities per
+             * quadrant.
+             *
+             * @return std::string The cache file name.
+             */
+            static std::string getCacheFile(const std::string& cacheDirectory,
+                                            const uint64_t     hash,
+                                            const uint32_t     nearestCount,
+                                            const uint32_t     quadrantCount);
+
+            /**
+             * @brief Hashes the coordinates of the cities (64 bits FNV-1a).
+             *
+             * @param[in] cities The cities.
+             *
+             * @return uint64_t The hash.
+             */
+            static uint64_t getHash(const std::vector<city_t>& cities);
+    };
+}
+
+#endif /* #ifndef __SOLVER_NEIGHBOUR_LISTS_H_ */
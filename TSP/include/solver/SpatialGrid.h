@@ -0,0 +1,291 @@
+/*******************************************************************************
+ * File: SpatialGrid.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Uniform grid over the cities coordinates. The grid answers nearest city
+ * queries among the cities not removed yet, which lets the greedy solver
+ * build a nearest neighbour tour without scanning every city at each step.
+ ******************************************************************************/
+
+#ifndef __SOLVER_SPATIAL_GRID_H_
+#define __SOLVER_SPATIAL_GRID_H_
+
+#include <cstdint> /* Generic int types */
+#include <cstddef> /* size_t */
+#include <vector>  /* std::vector */
+#include <utility> /* std::pair */
+
+#include <solver/Solver.h>           /* city_t */
+#include <solver/AlignedAllocator.h> /* coordinates_t */
+
+/** @brief Mean number of cities in a cell of the grid. */
+#define SPATIAL_GRID_CITIES_PER_CELL 2
+
+/** @brief Returned by the queries when no city is left in the grid. */
+#define SPATIAL_GRID_NONE UINT32_MAX
+
+/** @brief Number of quadrants around a city. */
+#define SPATIAL_GRID_QUADRANTS 4
+
+/**
+ * @brief TSP problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Spatial grid, indexes the cities by the square cell containing
+     * them.
+     *
+     * The cities of a cell are contiguous: removing a city swaps it with the
+     * last remaining city of its cell. A nearest city query scans the rings
+     * of cells around the query point and stops when the next ring cannot
+     * hold a closer city. When the remaining cities are sparse, the scan
+     * falls back to the list of remaining cities once it has visited more
+     * cells than there are cities left, which bounds the end of a greedy
+     * tour construction.
+     *
+     * The grid also gives the neighbours of a city: its nearest cities and
+     * the nearest cities in each quadrant around it. The neighbour search
+     * only scans the parts of the rings that may still improve a list, so
+     * a city on the border of the map does not scan the whole grid for its
+     * empty quadrants. The search does not modify the grid and can run from
+     * several threads.
+     *
+     */
+    class SpatialGrid
+    {
+        private:
+            /**
+             * @brief The abscissa of each city.
+             *
+             */
+            coordinates_t x;
+
+            /**
+             * @brief The ordinate of each city.
+             *
+             */
+            coordinates_t y;
+
+            /**
+             * @brief Lower left corner of the grid.
+             *
+             */
+            double minX;
+            double minY;
+
+            /**
+             * @brief Side of a cell.
+             *
+             */
+            double cellSize;
+
+            /**
+             * @brief Grid dimensions in cells.
+             *
+             */
+            uint32_t columns;
+            uint32_t rows;
+
+            /**
+             * @brief First entry of each cell in cellCities, the last entry
+             * is the city count.
+             *
+             */
+            std::vector<uint32_t> cellStart;
+
+            /**
+             * @brief Number of remaining cities in each cell.
+             *
+             */
+            std::vector<uint32_t> cellCount;
+
+            /**
+             * @brief Number of remaining cities in each row of cells.
+             *
+             */
+            std::vector<uint32_t> rowCount;
+
+            /**
+             * @brief The cities sorted by cell, the remaining cities of a
+             * cell come first.
+             *
+             */
+            std::vector<uint32_t> cellCities;
+
+            /**
+             * @brief The cell of each city.
+             *
+             */
+            std::vector<uint32_t> cityCell;
+
+            /**
+             * @brief The entry of each city in cellCities.
+             *
+             */
+            std::vector<uint32_t> cityEntry;
+
+            /**
+             * @brief The remaining cities, in no particular order.
+             *
+             */
+            std::vector<uint32_t> remaining;
+
+            /**
+             * @brief The entry of each city in remaining.
+             *
+             */
+            std::vector<uint32_t> remainingEntry;
+
+            /**
+             * @brief Returns the column of an abscissa, clamped to the grid.
+             *
+             * @param[in] position The abscissa.
+             *
+             * @return uint32_t The column.
+             */
+            uint32_t getColumn(const double position) const;
+
+            /**
+             * @brief Returns the row of an ordinate, clamped to the grid.
+             *
+             * @param[in] position The ordinate.
+             *
+             * @return uint32_t The row.
+             */
+            uint32_t getRow(const double position) const;
+
+            /**
+             * @brief Updates the best candidate with the remaining cities of
+             * a cell.
+             *
+             * @param[in] cell The cell.
+             * @param[in] px The query abscissa.
+             * @param[in] py The query ordinate.
+             * @param[in, out] best The best city.
+             * @param[in, out] bestDistance The squared distance to the best
+             * city.
+             */
+            void scanCell(const uint32_t cell,
+                          const double   px,
+                          const double   py,
+                          uint32_t&      best,
+                          double&        bestDistance) const;
+
+            /**
+             * @brief Updates the best candidate with a city.
+             *
+             * @param[in] city The city.
+             * @param[in] px The query abscissa.
+             * @param[in] py The query ordinate.
+             * @param[in, out] best The best city.
+             * @param[in, out] bestDistance The squared distance to the best
+             * city.
+             */
+            void scanCity(const uint32_t city,
+                          const double   px,
+                          const double   py,
+                          uint32_t&      best,
+                          double&        bestDistance) const;
+
+            /**
+             * @brief Inserts a city in a list of candidates sorted by
+             * distance then index, the list keeps at most capacity entries.
+             *
+             * @param[in, out] list The candidates.
+             * @param[in] capacity The maximal size of the list.
+             * @param[in] distance The squared distance to the city.
+             * @param[in] city The city.
+             */
+            static void insertCandidate(
+                            std::vector<std::pair<double, uint32_t>>& list,
+                            const uint32_t                            capacity,
+                            const double                              distance,
+                            const uint32_t                            city);
+
+        public:
+            /**
+             * @brief Default contructor, unused.
+             *
+             */
+            SpatialGrid(void) = delete;
+
+            /**
+             * @brief Construct a new Spatial Grid object, every city is in
+             * the grid.
+             *
+             * @param[in] cities The cities to index.
+             */
+            SpatialGrid(const std::vector<city_t>& cities);
+
+            /**
+             * @brief Destroy the Spatial Grid object.
+             *
+             */
+            ~SpatialGrid(void);
+
+            /**
+             * @brief Removes a city from the grid. The city must be in the
+             * grid.
+             *
+             * @param[in] city The city to remove.
+             */
+            void remove(const uint32_t city);
+
+            /**
+             * @brief Returns the nearest city to a point among the remaining
+             * cities. Equally distant cities are ordered by index.
+             *
+             * @param[in] px The query abscissa.
+             * @param[in] py The query ordinate.
+             *
+             * @return uint32_t The nearest city, SPATIAL_GRID_NONE when the
+             * grid is empty.
+             */
+            uint32_t getNearest(const double px, const double py) const;
+
+            /**
+             * @brief Returns the neighbours of a city among the remaining
+             * cities: the union of its nearestCount nearest cities and of
+             * its quadrantCount nearest cities in each quadrant. A quadrant
+             * is the set of cities on one side of the city on each axis,
+             * the cities on an axis are east or north.
+             *
+             * @param[in] city The city, the city itself is never returned.
+             * @param[in] nearestCount The number of nearest cities.
+             * @param[in] quadrantCount The number of nearest cities per
+             * quadrant.
+             * @param[out] neighbours The neighbours, sorted by increasing
+             * distance then index. Must hold nearestCount +
+             * SPATIAL_GRID_QUADRANTS * quadrantCount entries.
+             *
+             * @return uint32_t The number of neighbours.
+             */
+            uint32_t getNeighbours(const uint32_t city,
+                                   const uint32_t nearestCount,
+                                   const uint32_t quadrantCount,
+                                   uint32_t*      neighbours) const;
+
+            /**
+             * @brief Returns the number of cities remaining in the grid.
+             *
+             * @return uint32_t The number of remaining cities.
+             */
+            uint32_t getCount(void) const;
+
+            /**
+             * @brief Returns the number of bytes used by the grid.
+             *
+             * @return size_t The number of bytes.
+             */
+            size_t getMemoryFootprint(void) const;
+    };
+}
+
+#endif /* #ifndef __SOLVER_SPATIAL_GRID_H_ */
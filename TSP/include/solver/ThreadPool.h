@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * File: ThreadPool.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Pool of worker threads running batches of independent tasks. The workers
+ * are created once and wait for the next batch, instead of being created for
+ * each parallel section.
+ ******************************************************************************/
+
+#ifndef __SOLVER_THREAD_POOL_H_
+#define __SOLVER_THREAD_POOL_H_
+
+#include <cstdint>            /* Generic int types */
+#include <vector>             /* std::vector */
+#include <thread>             /* std::thread */
+#include <mutex>              /* std::mutex */
+#include <condition_variable> /* std::condition_variable */
+#include <atomic>             /* std::atomic */
+#include <functional>         /* std::function */
+
+/**
+ * @brief TSP problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Thread pool. A batch is a number of tasks identified by their
+     * index, the workers and the calling thread take the next task index
+     * until the batch is done, so uneven tasks balance themselves. Batches
+     * are run one at a time.
+     *
+     */
+    class ThreadPool
+    {
+        private:
+            /**
+             * @brief The worker threads.
+             *
+             */
+            std::vector<std::thread> workers;
+
+            /**
+             * @brief Protects the batch state below.
+             *
+             */
+            std::mutex lock;
+
+            /**
+             * @brief Signaled when a batch starts or the pool stops.
+             *
+             */
+            std::condition_variable startSignal;
+
+            /**
+             * @brief Signaled when the last worker leaves a batch.
+             *
+             */
+            std::condition_variable doneSignal;
+
+            /**
+             * @brief Incremented at each batch.
+             *
+             */
+            uint64_t batch;
+
+            /**
+             * @brief Number of workers still running the current batch.
+             *
+             */
+            uint32_t activeCount;
+
+            /**
+             * @brief Set to true to stop the workers.
+             *
+             */
+            bool stopping;
+
+            /**
+             * @brief The current batch routine.
+             *
+             */
+            const std::function<void(const uint32_t)>* task;
+
+            /**
+             * @brief The number of tasks in the current batch.
+             *
+             */
+            uint32_t taskCount;
+
+            /**
+             * @brief The next task to run.
+             *
+             */
+            std::atomic<uint32_t> nextTask;
+
+            /**
+             * @brief Runs the tasks of the current batch until none is left.
+             *
+             */
+            void runTasks(void);
+
+            /**
+             * @brief Waits for the batches and runs their tasks. This
+             * function is used as a thread routine.
+             *
+             */
+            void workerThread(void);
+
+        public:
+            /**
+             * @brief Default contructor, uses every core of the machine.
+             *
+             */
+            ThreadPool(void);
+
+            /**
+             * @brief Construct a new Thread Pool object.
+             *
+             * @param[in] threadCount The number of threads running the tasks,
+             * including the calling thread. 0 uses every core of the machine.
+             */
+            ThreadPool(const uint32_t threadCount);
+
+            /**
+             * @brief Destroy the Thread Pool object, the workers are joined.
+             *
+             */
+            ~ThreadPool(void);
+
+            /**
+             * @brief Returns the number of threads running the tasks,
+             * including the calling thread.
+             *
+             * @return uint32_t The number of threads.
+             */
+            uint32_t getThreadCount(void) const;
+
+            /**
+             * @brief Runs a batch of tasks and waits for its completion.
+             *
+             * @param[in] count The number of tasks.
+             * @param[in] routine The task routine, called once with each task
+             * index from 0 to count - 1.
+             */
+            void run(const uint32_t                             count,
+                     const std::function<void(const uint32_t)>& routine);
+    };
+}
+
+#endif /* #ifndef __SOLVER_THREAD_POOL_H_ */
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * File: Tour.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Tour interface. This class defines the API used by the local search moves
+ * to walk and modify a tour, whatever the tour representation is.
+ ******************************************************************************/
+
+#ifndef __SOLVER_TOUR_H_
+#define __SOLVER_TOUR_H_
+
+#include <cstdint> /* Generic int types */
+#include <vector>  /* std::vector */
+
+/**
+ * @brief TSP problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Tour interface. A tour is a cycle over the cities with an
+     * orientation: every move is expressed with next, prev, between and the
+     * reversal of a path.
+     *
+     */
+    class Tour
+    {
+        public:
+            /**
+             * @brief Destroy the Tour object.
+             *
+             */
+            virtual ~Tour(void) {}
+
+            /**
+             * @brief Returns the city visited after a city.
+             *
+             * @param[in] city The city.
+             *
+             * @return uint32_t The next city.
+             */
+            virtual uint32_t getNext(const uint32_t city) const = 0;
+
+            /**
+             * @brief Returns the city visited before a city.
+             *
+             * @param[in] city The city.
+             *
+             * @return uint32_t The previous city.
+             */
+            virtual uint32_t getPrev(const uint32_t city) const = 0;
+
+            /**
+             * @brief Tells if a city is on the path going forward from a
+             * city to another, both ends included.
+             *
+             * @param[in] from The first city of the path.
+             * @param[in] city The tested city.
+             * @param[in] to The last city of the path.
+             *
+             * @return True if the city is on the path, false otherwise.
+             */
+            virtual bool isBetween(const uint32_t from,
+                                   const uint32_t city,
+                                   const uint32_t to) const = 0;
+
+            /**
+             * @brief Reverses the path going forward from a city to another.
+             * The implementation may reverse the rest of the tour instead,
+             * which gives the same cycle with the opposite orientation.
+             *
+             * @param[in] from The first city of the path.
+             * @param[in] to The last city of the path.
+             */
+            virtual void reverse(const uint32_t from, const uint32_t to) = 0;
+
+            /**
+             * @brief Returns the number of cities.
+             *
+             * @return uint32_t The number of cities.
+             */
+            virtual uint32_t getCityCount(void) const = 0;
+
+            /**
+             * @brief Returns the next city in a direction.
+             *
+             * @param[in] city The city.
+             * @param[in] direction 0 for the next city, 1 for the previous
+             * city.
+             *
+             * @return uint32_t The next city in the direction.
+             */
+            uint32_t getStep(const uint32_t city,
+                             const uint32_t direction) const
+            {
+                return direction == 0 ? getNext(city) : getPrev(city);
+            }
+
+            /**
+             * @brief Tells if a city is on the path going in a direction
+             * from a city to another, both ends included.
+             *
+             * @param[in] from The first city of the path.
+             * @param[in] city The tested city.
+             * @param[in] to The last city of the path.
+             * @param[in] direction 0 to go forward, 1 to go backward.
+             *
+             * @return True if the city is on the path, false otherwise.
+             */
+            bool isOnPath(const uint32_t from,
+                          const uint32_t city,
+                          const uint32_t to,
+                          const uint32_t direction) const
+            {
+                return direction == 0 ? isBetween(from, city, to) :
+                                        isBetween(to, city, from);
+            }
+
+            /**
+             * @brief Replaces the edges (a, b) and (c, d) by (a, c) and
+             * (b, d). b follows a and d follows c in the same direction,
+             * whatever the orientation of the tour is: a sequence of
+             * exchanges stays valid when a reversal flips the tour.
+             *
+             * @param[in] a The first city of the first edge.
+             * @param[in] b The second city of the first edge.
+             * @param[in] c The first city of the second edge.
+             * @param[in] d The second city of the second edge.
+             */
+            void exchange(const uint32_t a,
+                          const uint32_t b,
+                          const uint32_t c,
+                          const uint32_t d);
+
+            /**
+             * @brief Returns the cities in their order of visit, starting
+             * from the city 0.
+             *
+             * @param[out] order The cities in their order of visit.
+             */
+            void getOrder(std::vector<uint32_t>& order) const;
+    };
+}
+
+#endif /* #ifndef __SOLVER_TOUR_H_ */
@@ -0,0 +1,167 @@
+/*******************************************************************************
+ * File: TriangularDistanceProvider.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * TriangularDistanceProvider implements the DistanceProvider class. The
+ * distances are stored once per pair of cities in single precision, in the
+ * lower triangle of the distance matrix.
+ ******************************************************************************/
+
+#ifndef __SOLVER_TRIANGULAR_DISTANCE_PROVIDER_H_
+#define __SOLVER_TRIANGULAR_DISTANCE_PROVIDER_H_
+
+#include <cstdint> /* Generic int types */
+#include <cstddef> /* size_t */
+#include <vector>  /* std::vector */
+
+#include <solver/Solver.h>            /* city_t */
+#include <solver/DistanceProvider.h>  /* nsSolver::DistanceProvider */
+#include <solver/HugePageAllocator.h> /* nsSolver::HugePageAllocator */
+#include <solver/DistanceOracle.h>    /* nsSolver::DistanceOracle */
+#include <solver/ThreadPool.h>        /* nsSolver::ThreadPool */
+
+/**
+ * @brief TSP problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Triangular distance provider. The distance matrix is symmetric
+     * with a null diagonal, only the N * (N - 1) / 2 entries below the
+     * diagonal are stored, as floats. The footprint is a quarter of the full
+     * matrix, for a relative error under 1e-7 per distance.
+     *
+     */
+    class TriangularDistanceProvider: public DistanceProvider
+    {
+        private:
+            /**
+             * @brief The number of cities.
+             *
+             */
+            uint32_t cityCount;
+
+            /**
+             * @brief The coordinates of the cities, computes the matrix
+             * entries.
+             *
+             */
+            DistanceOracle oracle;
+
+            /**
+             * @brief Runs the matrix build.
+             *
+             */
+            ThreadPool pool;
+
+            /**
+             * @brief Allocator of the matrix.
+             *
+             */
+            HugePageAllocator* allocator = nullptr;
+
+            /**
+             * @brief The distances: row i holds the distances to the cities
+             * 0 to i - 1 and starts at entry i * (i - 1) / 2.
+             *
+             */
+            float* distances = nullptr;
+
+            /**
+             * @brief Computes the matrix. The lower triangle is cut in square
+             * tiles of DISTANCE_TILE_SIZE cities, each tile is a task of the
+             * thread pool.
+             *
+             */
+            void build(void);
+
+            /**
+             * @brief Returns the size of the matrix.
+             *
+             * @return size_t The number of bytes.
+             */
+            size_t getMatrixSize(void) const;
+
+            /**
+             * @brief Computes a tile of the matrix.
+             *
+             * @param[in] rowTile The tile row.
+             * @param[in] columnTile The tile column, not greater than
+             * rowTile.
+             */
+            void buildTile(const uint32_t rowTile, const uint32_t columnTile);
+
+        public:
+            /**
+             * @brief Default contructor, unused.
+             *
+             */
+            TriangularDistanceProvider(void) = delete;
+
+            /**
+             * @brief Construct a new Triangular Distance Provider object
+             * and computes the matrix.
+             *
+             * @param[in] cities The cities.
+             * @param[in] hugePages The huge page mode of the matrix.
+             */
+            TriangularDistanceProvider(const std::vector<city_t>& cities,
+                                       const HugePageMode         hugePages);
+
+            /**
+             * @brief Destroy the Triangular Distance Provider object.
+             *
+             */
+            virtual ~TriangularDistanceProvider(void);
+
+            /**
+             * @brief Returns the distance between two cities.
+             *
+             * @param[in] from The index of the first city.
+             * @param[in] to The index of the second city.
+             *
+             * @return double The distance between the cities.
+             */
+            virtual double getDistance(const uint32_t from,
+                                       const uint32_t to) const;
+
+            /**
+             * @brief Returns the number of cities.
+             *
+             * @return uint32_t The number of cities.
+             */
+            virtual uint32_t getCityCount(void) const;
+
+            /**
+             * @brief Returns the memory used by the matrix.
+             *
+             * @return size_t The number of bytes.
+             */
+            virtual size_t getMemoryFootprint(void) const;
+
+            /**
+             * @brief Returns the backend name.
+             *
+             * @return const char* The backend name.
+             */
+            virtual const char* getName(void) const;
+
+            /**
+             * @brief Rebuilds the matrix for a new set of cities. Nothing is
+             * computed when the cities did not change.
+             *
+             * @param[in] cities The cities.
+             *
+             * @return True if the matrix was rebuilt, false otherwise.
+             */
+            bool rebuild(const std::vector<city_t>& cities);
+    };
+}
+
+#endif /* #ifndef __SOLVER_TRIANGULAR_DISTANCE_PROVIDER_H_ */
@@ -0,0 +1,312 @@
+/*******************************************************************************
+ * File: TwoLevelListTour.h
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Two-level list tour, implements the Tour interface with segments of about
+ * sqrt(N) cities that can be reversed as a whole. A reversal costs O(sqrt(N))
+ * instead of O(N) for the array tour.
+ ******************************************************************************/
+
+#ifndef __SOLVER_TWO_LEVEL_LIST_TOUR_H_
+#define __SOLVER_TWO_LEVEL_LIST_TOUR_H_
+
+#include <cstdint> /* Generic int types */
+#include <vector>  /* std::vector */
+
+#include <solver/Tour.h> /* nsSolver::Tour */
+
+/** @brief Maximal number of segments, relative to the number of segments of
+ * a balanced tour. The tour is balanced again when a reversal could exceed
+ * it. */
+#define TWO_LEVEL_LIST_SEGMENT_FACTOR 3
+
+/**
+ * @brief TSP problem solvers.
+ *
+ */
+namespace nsSolver
+{
+    /**
+     * @brief Segment of a two-level list tour, a path of the tour stored in
+     * consecutive slots.
+     *
+     */
+    struct tourSegment
+    {
+        /** @brief The first slot of the segment. */
+        uint32_t start;
+
+        /** @brief The number of cities in the segment. */
+        uint32_t size;
+
+        /** @brief The next segment in the tour. */
+        uint32_t next;
+
+        /** @brief The previous segment in the tour. */
+        uint32_t prev;
+
+        /** @brief The order of the segment in the tour, from 0 to the number
+         * of segments. */
+        uint32_t rank;
+
+        /** @brief Set to true when the tour visits the slots backward. */
+        bool reversed;
+    };
+
+    /**
+     * @brief Defines the tour_segment_t type.
+     *
+     */
+    typedef struct tourSegment tour_segment_t;
+
+    /**
+     * @brief Position of a city in a two-level list tour.
+     *
+     */
+    struct tourPosition
+    {
+        /** @brief The segment of the city. */
+        uint32_t segment;
+
+        /** @brief The slot of the city in the segment. */
+        uint32_t index;
+    };
+
+    /**
+     * @brief Defines the tour_position_t type.
+     *
+     */
+    typedef struct tourPosition tour_position_t;
+
+    /**
+     * @brief Two-level list tour. The tour is a doubly linked list of
+     * segments, each segment holds about sqrt(N) cities and a reversal bit.
+     * next, prev and between are O(1): they read the position of the city
+     * and the orientation of its segment.
+     *
+     * A path of at most sqrt(N) cities is reversed by swapping its cities.
+     * A longer path is first cut at its ends, which splits at most two
+     * segments, then the order of its segments is reversed and their bits
+     * are flipped; the rest of the tour is reversed instead when it holds
+     * fewer segments. Splitting never moves more than a segment, so a
+     * reversal costs O(sqrt(N)). The splits add segments: the tour is
+     * balanced again in O(N) once the number of segments grows
+     * TWO_LEVEL_LIST_SEGMENT_FACTOR times larger, which keeps the amortized
+     * cost of a reversal in O(sqrt(N)).
+     *
+     * Each segment owns sqrt(N) slots of a flat array, a segment never
+     * grows so the cities stay in place until the tour is balanced again.
+     *
+     */
+    class TwoLevelListTour: public Tour
+    {
+        private:
+            /**
+             * @brief The segments, only the first segmentCount are used.
+             *
+             */
+            std::vector<tour_segment_t> segments;
+
+            /**
+             * @brief The cities of the segments, the segment i owns the
+             * slots from i * groupSize.
+             *
+             */
+            std::vector<uint32_t> slots;
+
+            /**
+             * @brief The position of each city.
+             *
+             */
+            std::vector<tour_position_t> positions;
+
+            /**
+             * @brief The order of visit, used when the tour is balanced
+             * again.
+             *
+             */
+            std::vector<uint32_t> order;
+
+            /**
+             * @brief The reversed segments, used by the reversals.
+             *
+             */
+            std::vector<uint32_t> path;
+
+            /**
+             * @brief The number of cities of a segment of a balanced tour.
+             *
+             */
+            uint32_t groupSize;
+
+            /**
+             * @brief The number of segments in use.
+             *
+             */
+            uint32_t segmentCount;
+
+            /**
+             * @brief The number of times the tour was balanced.
+             *
+             */
+            uint64_t rebuildCount;
+
+            /**
+             * @brief Fills balanced segments with the cities.
+             *
+             * @param[in] order The cities in their order of visit.
+             */
+            void build(const std::vector<uint32_t>& order);
+
+            /**
+             * @brief Balances the segments again.
+             *
+             */
+            void rebuild(void);
+
+            /**
+             * @brief Returns the index of a city in its segment, following
+             * the tour.
+             *
+             * @param[in] city The city.
+             *
+             * @return uint32_t The index of the city.
+             */
+            uint32_t getIndex(const uint32_t city) const;
+
+            /**
+             * @brief Moves a position to the next city of the tour.
+             *
+             * @param[in, out] position The position.
+             */
+            void stepForward(tour_position_t& position) const;
+
+            /**
+             * @brief Moves a position to the previous city of the tour.
+             *
+             * @param[in, out] position The position.
+             */
+            void stepBackward(tour_position_t& position) const;
+
+            /**
+             * @brief Splits the segment of a city so the city is the first
+             * one of its segment. The cities after the split that are
+             * stored last in the slots move to a new segment.
+             *
+             * @param[in] city The city.
+             */
+            void splitBefore(const uint32_t city);
+
+            /**
+             * @brief Reverses a path by swapping its cities.
+             *
+             * @param[in] from The first city of the path.
+             * @param[in] to The last city of the path.
+             * @param[in] length The number of cities of the path.
+             */
+            void reverseCities(const uint32_t from,
+                               const uint32_t to,
+                               const uint32_t length);
+
+            /**
+             * @brief Reverses the order and the orientation of a sequence
+             * of segments, or of the rest of the segments when they are
+             * fewer.
+             *
+             * @param[in] first The first segment.
+             * @param[in] last The last segment.
+             */
+            void reverseSegments(const uint32_t first, const uint32_t last);
+
+        public:
+            /**
+             * @brief Default contructor, unused.
+             *
+             */
+            TwoLevelListTour(void) = delete;
+
+            /**
+             * @brief Construct a new Two Level List Tour object.
+             *
+             * @param[in] order The cities in their order of visit, a
+             * permutation of the cities.
+             */
+            TwoLevelListTour(const std::vector<uint32_t>& order);
+
+            /**
+             * @brief Destroy the Two Level List Tour object.
+             *
+             */
+            virtual ~TwoLevelListTour(void);
+
+            /**
+             * @brief Returns the city visited after a city.
+             *
+             * @param[in] city The city.
+             *
+             * @return uint32_t The next city.
+             */
+            virtual uint32_t getNext(const uint32_t city) const;
+
+            /**
+             * @brief Returns the city visited before a city.
+             *
+             * @param[in] city The city.
+             *
+             * @return uint32_t The previous city.
+             */
+            virtual uint32_t getPrev(const uint32_t city) const;
+
+            /**
+             * @brief Tells if a city is on the path going forward from a
+             * city to another, both ends included.
+             *
+             * @param[in] from The first city of the path.
+             * @param[in] city The tested city.
+             * @param[in] to The last city of the path.
+             *
+             * @return True if the city is on the path, false otherwise.
+             */
+            virtual bool isBetween(const uint32_t from,
+                                   const uint32_t city,
+                                   const uint32_t to) const;
+
+            /**
+             * @brief Reverses the path going forward from a city to another,
+             * or the rest of the tour when it holds fewer segments.
+             *
+             * @param[in] from The first city of the path.
+             * @param[in] to The last city of the path.
+             */
+            virtual void reverse(const uint32_t from, const uint32_t to);
+
+            /**
+             * @brief Returns the number of cities.
+             *
+             * @return uint32_t The number of cities.
+             */
+            virtual uint32_t getCityCount(void) const;
+
+            /**
+             * @brief Returns the number of segments in use.
+             *
+             * @return uint32_t The number of segments.
+             */
+            uint32_t getSegmentCount(void) const;
+
+            /**
+             * @brief Returns the number of times the tour was balanced
+             * again since its creation.
+             *
+             * @return uint64_t The number of rebuilds.
+             */
+            uint64_t getRebuildCount(void) const;
+    };
+}
+
+#endif /* #ifndef __SOLVER_TWO_LEVEL_LIST_TOUR_H_ */
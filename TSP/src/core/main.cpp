@@ -17,8 +17,15 @@
 #include <string>   /* std::string */
 #include <fstream>  /* std::ifstrem */
 
-#include <solver/Solver.h>       /* city_t */
-#include <solver/GreedySolver.h> /* nsSolver::GreedySolver */
+#include <solver/Solver.h>              /* city_t */
+#include <solver/GreedySolver.h>        /* nsSolver::GreedySolver */
+#include <solver/LocalSearchSolver.h>   /* nsSolver::LocalSearchSolver */
+#include <solver/LinKernighanSolver.h>  /* nsSolver::LinKernighanSolver */
+#include <solver/HugePageAllocator.h>   /* nsSolver::HugePageMode */
+#include <solver/DistanceProvider.h>    /* nsSolver::DistanceProvider */
+#include <solver/DistanceOracle.h>      /* nsSolver::DistanceOracle */
+/* nsSolver::NeighbourListDistanceProvider */
+#include <solver/NeighbourListDistanceProvider.h>
 
 using namespace nsSolver; /* Solver's namespace */
 
@@ -26,16 +33,28 @@ using namespace nsSolver; /* Solver's namespace */
 
 static void displayUsage(char* exeName)
 {
-    std::cout << exeName << "[ALGOTYPE] [FILENAME] [ITERCOUNT]"
+    std::cout << exeName << "[ALGOTYPE] [FILENAME] [ITERCOUNT] [OPTIONS]"
               << std::endl << "\t"
               << "ALGOTYPE is the algorithm type used to solve the problem can "
-              << "be GREEDY, HILL or GEN."
+              << "be GREEDY, HILL, LK or GEN."
               << std::endl << "\t"
               << "FILENAME The file containing the cities location."
               << std::endl << "\t"
               << "ITERCOUNT is the maximal number of iteration to reach before"
               << " stopping the algorithm (this is not taken into account for "
-              << "the greedy algorithm)." << std::endl;
+              << "the greedy algorithm)." << std::endl << "\t"
+              << "OPTIONS:" << std::endl << "\t\t"
+              << "--distance=NAME selects the distance backend: matrix, "
+              << "triangular, neighbours or oracle (default)."
+              << std::endl << "\t\t"
+              << "--mem-budget=SIZE selects the fastest distance backend "
+              << "fitting in SIZE bytes (K, M and G suffixes are accepted)."
+              << std::endl << "\t\t"
+              << "--huge-pages=MODE backs the distance matrices with huge "
+              << "pages, MODE is off, transparent or explicit."
+              << std::endl << "\t\t"
+              << "--neighbour-cache=DIR reads and writes the neighbour lists "
+              << "of the instance in DIR." << std::endl;
 }
 
 static void parseFile(const std::string& fileName,
@@ -77,11 +96,17 @@ int main(int argc, char** argv)
     std::vector<city_t>   cities;
     std::vector<uint32_t> solution;
 
-    std::string fileName;
+    uint64_t     budget;
+    std::string  fileName;
+    std::string  option;
+    std::string  backend;
+    std::string  cacheDirectory;
+    HugePageMode hugePages;
 
-    Solver* solver = nullptr;
+    Solver*           solver    = nullptr;
+    DistanceProvider* distances = nullptr;
 
-    if(argc != 4)
+    if(argc < 4)
     {
         std::cout << "Wrong argument count" << std::endl;
         displayUsage(argv[0]);
@@ -90,21 +115,91 @@ int main(int argc, char** argv)
     fileName  = argv[2];
     iterCount = std::stoi(argv[3]);
 
+    budget    = UINT64_MAX;
+    backend   = "oracle";
+    hugePages = HUGE_PAGES_OFF;
+    for(i = 4; i < (uint32_t)argc; ++i)
+    {
+        option = argv[i];
+        if(option.compare(0, 11, "--distance=") == 0 &&
+           DistanceProvider::getRequiredMemory(option.substr(11), 0) !=
+           UINT64_MAX)
+        {
+            backend = option.substr(11);
+        }
+        else if(option.compare(0, 13, "--mem-budget=") == 0 &&
+                DistanceProvider::parseSize(option.substr(13), budget))
+        {
+            backend.clear();
+        }
+        else if(option.compare(0, 18, "--neighbour-cache=") == 0 &&
+                option.size() > 18)
+        {
+            cacheDirectory = option.substr(18);
+        }
+        else if(option.compare(0, 13, "--huge-pages=") != 0 ||
+                !HugePageAllocator::parseMode(option.substr(13), hugePages))
+        {
+            std::cout << "Wrong option: " << option << std::endl;
+            displayUsage(argv[0]);
+            return -1;
+        }
+    }
+
     parseFile(fileName, cityCount, cities);
 
+    /* Create the distance backend, the last of --distance and --mem-budget
+     * wins */
+    if(backend.empty())
+    {
+        distances = DistanceProvider::select(cities, budget, hugePages,
+                                             cacheDirectory);
+        std::cout << "Distance backend: " << distances->getName()
+                  << " | Memory: " << distances->getMemoryFootprint()
+                  << " bytes | Budget: " << budget << " bytes" << std::endl;
+    }
+    else
+    {
+        distances = DistanceProvider::create(backend, cities, hugePages,
+                                             cacheDirectory);
+        std::cout << "Distance backend: " << distances->getName()
+                  << " | Memory: " << distances->getMemoryFootprint()
+                  << " bytes" << std::endl;
+    }
+
+    if(!cacheDirectory.empty() &&
+       std::string(distances->getName()) == "neighbours")
+    {
+        std::cout << "Neighbour lists: "
+                  << (static_cast<NeighbourListDistanceProvider*>(distances)->
+                      isCached() ? "read from " : "written to ")
+                  << cacheDirectory << std::endl;
+    }
+
+    std::cout << "Scan kernel: "
+              << DistanceOracle::getScanKernelName(
+                    DistanceOracle::getBestScanKernel()) << std::endl;
 
     if(strncmp(argv[1], "GREEDY", 5) == 0)
     {
-        solver = new GreedySolver(cities);
+        solver = new GreedySolver(cities, distances);
     }
     else if(strncmp(argv[1], "HILL", 4) == 0)
     {
-        (void) iterCount;
-        //solver = new HillClimbingSolver(queens, iterCount);
+        solver = new LocalSearchSolver(cities, distances, iterCount,
+                                       cacheDirectory);
+    }
+    else if(strncmp(argv[1], "LK", 2) == 0)
+    {
+        solver = new LinKernighanSolver(cities, distances, iterCount,
+                                        cacheDirectory);
     }
     else if(strncmp(argv[1], "GEN", 3) == 0)
     {
-        //solver = new GeneticSolver(queens, iterCount);
+        std::cout << "The genetic algorithm is not available for the TSP."
+                  << std::endl;
+        delete distances;
+        return -1;
     }
     else
     {
@@ -112,6 +207,7 @@ int main(int argc, char** argv)
               << " problem."
               << std::endl;
         displayUsage(argv[0]);
+        delete distances;
         return -1;
     }
 
@@ -129,6 +225,7 @@ int main(int argc, char** argv)
     std::cout << std::endl;
 
     delete solver;
+    delete distances;
     return 0;
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * File: ArrayTour.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Array tour, implements the Tour interface with the order of visit and the
+ * position of each city in it.
+ ******************************************************************************/
+
+#include <cstdint> /* Generic int types */
+#include <vector>  /* std::vector */
+
+#include <solver/Tour.h> /* nsSolver::Tour */
+
+/* Header file */
+#include <solver/ArrayTour.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+ArrayTour::ArrayTour(const std::vector<uint32_t>& order)
+{
+    uint32_t i;
+
+    this->order = order;
+    this->position.resize(order.size());
+    for(i = 0; i < order.size(); ++i)
+    {
+        this->position[order[i]] = i;
+    }
+}
+
+ArrayTour::~ArrayTour(void)
+{
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+uint32_t ArrayTour::getNext(const uint32_t city) const
+{
+    uint32_t next;
+
+    next = this->position[city] + 1;
+
+    return this->order[next == this->order.size() ? 0 : next];
+}
+
+uint32_t ArrayTour::getPrev(const uint32_t city) const
+{
+    uint32_t prev;
+
+    prev = this->position[city];
+
+    return this->order[prev == 0 ? this->order.size() - 1 : prev - 1];
+}
+
+bool ArrayTour::isBetween(const uint32_t from,
+                          const uint32_t city,
+                          const uint32_t to) const
+{
+    uint32_t first;
+    uint32_t middle;
+    uint32_t last;
+
+    first  = this->position[from];
+    middle = this->position[city];
+    last   = this->position[to];
+
+    if(first <= last)
+    {
+        return first <= middle && middle <= last;
+    }
+
+    return middle >= first || middle <= last;
+}
+
+void ArrayTour::reverse(const uint32_t from, const uint32_t to)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t size;
+    uint32_t length;
+    uint32_t swap;
+    uint32_t count;
+
+    size   = this->order.size();
+    i      = this->position[from];
+    j      = this->position[to];
+    length = (j + size - i) % size + 1;
+
+    /* Reversing the rest of the tour gives the same cycle */
+    if(2 * length > size)
+    {
+        i      = j + 1 == size ? 0 : j + 1;
+        j      = this->position[from] == 0 ? size - 1 :
+                                             this->position[from] - 1;
+        length = size - length;
+    }
+
+    for(count = length / 2; count > 0; --count)
+    {
+        swap            = this->order[i];
+        this->order[i]  = this->order[j];
+        this->order[j]  = swap;
+
+        this->position[this->order[i]] = i;
+        this->position[this->order[j]] = j;
+
+        i = i + 1 == size ? 0 : i + 1;
+        j = j == 0 ? size - 1 : j - 1;
+    }
+}
+
+uint32_t ArrayTour::getCityCount(void) const
+{
+    return this->order.size();
+}
@@ -0,0 +1,339 @@
+/*******************************************************************************
+ * File: DistanceOracle.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * DistanceOracle implements the DistanceProvider class. The oracle computes
+ * the Euclidean distance between two cities on demand from their
+ * coordinates. The oracle memory is linear in the number of cities, where a
+ * distance matrix is quadratic.
+ ******************************************************************************/
+
+#include <cstdint> /* Generic int types */
+#include <cstddef> /* size_t */
+#include <vector>  /* std::vector */
+#include <cmath>   /* std::sqrt */
+#include <cstring> /* memcpy */
+#include <limits>  /* std::numeric_limits */
+#ifdef __SSE2__
+#include <emmintrin.h> /* _mm_*_pd */
+#endif
+
+/* The AVX2 kernel is compiled for its own target and selected at runtime */
+#if defined(__GNUC__) && defined(__x86_64__)
+#define DISTANCE_ORACLE_AVX2
+#include <immintrin.h> /* _mm256_* */
+#endif
+
+#include <solver/Solver.h>           /* city_t */
+#include <solver/AlignedAllocator.h> /* coordinates_t */
+
+/* Header file */
+#include <solver/DistanceOracle.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Static functions
+ ******************************************************************************/
+/* Scans the cities from start to count, updates the nearest unvisited city */
+static void scanScalar(const double*  x,
+                       const double*  y,
+                       const uint8_t* visited,
+                       const uint32_t start,
+                       const uint32_t count,
+                       const double   px,
+                       const double   py,
+                       uint32_t&      best,
+                       double&        bestDistance)
+{
+    uint32_t j;
+    double   dX;
+    double   dY;
+    double   distance;
+
+    for(j = start; j < count; ++j)
+    {
+        dX       = x[j] - px;
+        dY       = y[j] - py;
+        distance = dX * dX + dY * dY;
+        if(visited[j] == 0 && distance < bestDistance)
+        {
+            bestDistance = distance;
+            best         = j;
+        }
+    }
+}
+
+#ifdef DISTANCE_ORACLE_AVX2
+/* Returns the squared distances of four cities, visited cities are pushed to
+ * infinity. The arrays must be aligned on 32 bytes. */
+__attribute__((target("avx2")))
+static inline __m256d getDistancesAvx2(const double*  x,
+                                       const double*  y,
+                                       const uint8_t* visited,
+                                       const __m256d  vPx,
+                                       const __m256d  vPy,
+                                       const __m256d  vInfinity)
+{
+    int32_t flags;
+    __m256d vDx;
+    __m256d vDy;
+    __m256i vVisited;
+
+    vDx = _mm256_sub_pd(_mm256_load_pd(x), vPx);
+    vDy = _mm256_sub_pd(_mm256_load_pd(y), vPy);
+
+    memcpy(&flags, visited, sizeof(flags));
+    vVisited = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(flags));
+    vVisited = _mm256_cmpgt_epi64(vVisited, _mm256_setzero_si256());
+
+    return _mm256_blendv_pd(_mm256_add_pd(_mm256_mul_pd(vDx, vDx),
+                                          _mm256_mul_pd(vDy, vDy)),
+                            vInfinity, _mm256_castsi256_pd(vVisited));
+}
+
+/* Scans eight cities at a time in two independent chains of four lanes,
+ * each lane keeps its own nearest city. The arrays must be aligned on 32
+ * bytes. */
+__attribute__((target("avx2")))
+static void scanAvx2(const double*  x,
+                     const double*  y,
+                     const uint8_t* visited,
+                     const uint32_t count,
+                     const double   px,
+                     const double   py,
+                     uint32_t&      best,
+                     double&        bestDistance)
+{
+    uint32_t j;
+    uint32_t lane;
+    double   laneDistances[8];
+    int64_t  laneIndexes[8];
+
+    __m256d vPx;
+    __m256d vPy;
+    __m256d vInfinity;
+    __m256d vDistance[2];
+    __m256d vBest[2];
+    __m256d vLess[2];
+    __m256i vIndex[2];
+    __m256i vBestIndex[2];
+    __m256i vStep;
+
+    vPx           = _mm256_set1_pd(px);
+    vPy           = _mm256_set1_pd(py);
+    vInfinity     = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+    vBest[0]      = vInfinity;
+    vBest[1]      = vInfinity;
+    vIndex[0]     = _mm256_set_epi64x(3, 2, 1, 0);
+    vIndex[1]     = _mm256_set_epi64x(7, 6, 5, 4);
+    vBestIndex[0] = _mm256_set1_epi64x(-1);
+    vBestIndex[1] = _mm256_set1_epi64x(-1);
+    vStep         = _mm256_set1_epi64x(8);
+    for(j = 0; j + 8 <= count; j += 8)
+    {
+        vDistance[0] = getDistancesAvx2(x + j, y + j, visited + j,
+                                        vPx, vPy, vInfinity);
+        vDistance[1] = getDistancesAvx2(x + j + 4, y + j + 4, visited + j + 4,
+                                        vPx, vPy, vInfinity);
+
+        vLess[0]      = _mm256_cmp_pd(vDistance[0], vBest[0], _CMP_LT_OQ);
+        vLess[1]      = _mm256_cmp_pd(vDistance[1], vBest[1], _CMP_LT_OQ);
+        vBest[0]      = _mm256_blendv_pd(vBest[0], vDistance[0], vLess[0]);
+        vBest[1]      = _mm256_blendv_pd(vBest[1], vDistance[1], vLess[1]);
+        vBestIndex[0] = _mm256_blendv_epi8(vBestIndex[0], vIndex[0],
+                                           _mm256_castpd_si256(vLess[0]));
+        vBestIndex[1] = _mm256_blendv_epi8(vBestIndex[1], vIndex[1],
+                                           _mm256_castpd_si256(vLess[1]));
+        vIndex[0]     = _mm256_add_epi64(vIndex[0], vStep);
+        vIndex[1]     = _mm256_add_epi64(vIndex[1], vStep);
+    }
+
+    /* Reduce the lanes, the lowest index wins the ties */
+    _mm256_storeu_pd(laneDistances, vBest[0]);
+    _mm256_storeu_pd(laneDistances + 4, vBest[1]);
+    _mm256_storeu_si256((__m256i*)laneIndexes, vBestIndex[0]);
+    _mm256_storeu_si256((__m256i*)(laneIndexes + 4), vBestIndex[1]);
+    for(lane = 0; lane < 8; ++lane)
+    {
+        if(laneIndexes[lane] >= 0 &&
+           (laneDistances[lane] < bestDistance ||
+            (laneDistances[lane] == bestDistance &&
+             (uint32_t)laneIndexes[lane] < best)))
+        {
+            bestDistance = laneDistances[lane];
+            best         = laneIndexes[lane];
+        }
+    }
+
+    /* The tail cities have greater indexes than the lanes */
+    scanScalar(x, y, visited, j, count, px, py, best, bestDistance);
+}
+#endif
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+DistanceOracle::DistanceOracle(const std::vector<city_t>& cities)
+{
+    uint32_t i;
+
+    this->kernel = getBestScanKernel();
+
+    this->x.resize(cities.size());
+    this->y.resize(cities.size());
+    for(i = 0; i < cities.size(); ++i)
+    {
+        this->x[i] = cities[i].x;
+        this->y[i] = cities[i].y;
+    }
+}
+
+DistanceOracle::~DistanceOracle(void)
+{
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+uint32_t DistanceOracle::getCityCount(void) const
+{
+    return this->x.size();
+}
+
+size_t DistanceOracle::getMemoryFootprint(void) const
+{
+    return (this->x.capacity() + this->y.capacity()) * sizeof(double);
+}
+
+const char* DistanceOracle::getName(void) const
+{
+    return "oracle";
+}
+
+void DistanceOracle::getDistances(const uint32_t from,
+                                  const uint32_t start,
+                                  const uint32_t end,
+                                  double*        distances) const
+{
+    uint32_t      j;
+    double        dX;
+    double        dY;
+    const double* x;
+    const double* y;
+
+    x = this->x.data();
+    y = this->y.data();
+    j = start;
+
+#ifdef __SSE2__
+    __m128d fromX;
+    __m128d fromY;
+    __m128d vX;
+    __m128d vY;
+
+    fromX = _mm_set1_pd(x[from]);
+    fromY = _mm_set1_pd(y[from]);
+    for(; j + 2 <= end; j += 2)
+    {
+        vX = _mm_sub_pd(fromX, _mm_loadu_pd(x + j));
+        vY = _mm_sub_pd(fromY, _mm_loadu_pd(y + j));
+        vX = _mm_add_pd(_mm_mul_pd(vX, vX), _mm_mul_pd(vY, vY));
+        _mm_storeu_pd(distances + j - start, _mm_sqrt_pd(vX));
+    }
+#endif
+
+    /* Scalar tail, or whole range without SSE2 */
+    for(; j < end; ++j)
+    {
+        dX = x[from] - x[j];
+        dY = y[from] - y[j];
+        distances[j - start] = std::sqrt(dX * dX + dY * dY);
+    }
+}
+
+bool DistanceOracle::hasCities(const std::vector<city_t>& cities) const
+{
+    uint32_t i;
+
+    if(cities.size() != this->x.size())
+    {
+        return false;
+    }
+    for(i = 0; i < cities.size(); ++i)
+    {
+        if(cities[i].x != this->x[i] || cities[i].y != this->y[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+uint32_t DistanceOracle::getNearest(const uint32_t              from,
+                                    const std::vector<uint8_t>& visited) const
+{
+    uint32_t best;
+    double   bestDistance;
+
+    best         = DISTANCE_ORACLE_NONE;
+    bestDistance = std::numeric_limits<double>::infinity();
+
+#ifdef DISTANCE_ORACLE_AVX2
+    if(this->kernel == SCAN_KERNEL_AVX2)
+    {
+        scanAvx2(this->x.data(), this->y.data(), visited.data(),
+                 this->x.size(), this->x[from], this->y[from],
+                 best, bestDistance);
+        return best;
+    }
+#endif
+
+    scanScalar(this->x.data(), this->y.data(), visited.data(), 0,
+               this->x.size(), this->x[from], this->y[from],
+               best, bestDistance);
+    return best;
+}
+
+bool DistanceOracle::setScanKernel(const ScanKernel kernel)
+{
+    if(kernel == SCAN_KERNEL_AVX2 && getBestScanKernel() != SCAN_KERNEL_AVX2)
+    {
+        return false;
+    }
+
+    this->kernel = kernel;
+    return true;
+}
+
+ScanKernel DistanceOracle::getScanKernel(void) const
+{
+    return this->kernel;
+}
+
+ScanKernel DistanceOracle::getBestScanKernel(void)
+{
+#ifdef DISTANCE_ORACLE_AVX2
+    if(__builtin_cpu_supports("avx2"))
+    {
+        return SCAN_KERNEL_AVX2;
+    }
+#endif
+
+    return SCAN_KERNEL_SCALAR;
+}
+
+const char* DistanceOracle::getScanKernelName(const ScanKernel kernel)
+{
+    if(kernel == SCAN_KERNEL_AVX2)
+    {
+        return "avx2";
+    }
+    return "scalar";
+}
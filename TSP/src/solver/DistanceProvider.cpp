@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * File: DistanceProvider.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Distance provider interface. This class defines the API used by the TSP
+ * solvers to get the distance between two cities, whatever the distances are
+ * stored or computed.
+ ******************************************************************************/
+
+#include <cstdint>   /* Generic int types */
+#include <cstddef>   /* size_t */
+#include <vector>    /* std::vector */
+#include <string>    /* std::string, std::stoull */
+#include <stdexcept> /* std::exception */
+
+#include <solver/Solver.h>            /* city_t */
+#include <solver/HugePageAllocator.h> /* nsSolver::HugePageMode */
+/* nsSolver::FullMatrixDistanceProvider */
+#include <solver/FullMatrixDistanceProvider.h>
+/* nsSolver::TriangularDistanceProvider */
+#include <solver/TriangularDistanceProvider.h>
+/* nsSolver::NeighbourListDistanceProvider */
+#include <solver/NeighbourListDistanceProvider.h>
+/* nsSolver::DistanceOracle */
+#include <solver/DistanceOracle.h>
+
+/* Header file */
+#include <solver/DistanceProvider.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/* The backends from the fastest lookup to the smallest footprint */
+static const char* BACKENDS[] = {
+    "matrix", "triangular", "neighbours", "oracle"
+};
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+uint32_t DistanceProvider::getNeighbours(const uint32_t   city,
+                                         const uint32_t** neighbours) const
+{
+    (void)city;
+
+    *neighbours = nullptr;
+    return 0;
+}
+
+double DistanceProvider::getTourLength(const std::vector<uint32_t>& tour) const
+{
+    uint32_t i;
+    double   length;
+
+    if(tour.size() < 2)
+    {
+        return 0;
+    }
+
+    length = getDistance(tour.back(), tour.front());
+    for(i = 1; i < tour.size(); ++i)
+    {
+        length += getDistance(tour[i - 1], tour[i]);
+    }
+
+    return length;
+}
+
+DistanceProvider* DistanceProvider::create(const std::string&         name,
+                                           const std::vector<city_t>& cities,
+                                           const HugePageMode hugePages,
+                                           const std::string& cacheDirectory)
+{
+    if(name == "matrix")
+    {
+        return new FullMatrixDistanceProvider(cities, hugePages);
+    }
+    else if(name == "triangular")
+    {
+        return new TriangularDistanceProvider(cities, hugePages);
+    }
+    else if(name == "neighbours")
+    {
+        return new NeighbourListDistanceProvider(cities, cacheDirectory);
+    }
+    else if(name == "oracle")
+    {
+        return new DistanceOracle(cities);
+    }
+
+    return nullptr;
+}
+
+DistanceProvider* DistanceProvider::select(const std::vector<city_t>& cities,
+                                           const uint64_t             budget,
+                                           const HugePageMode hugePages,
+                                           const std::string& cacheDirectory)
+{
+    uint32_t i;
+
+    for(i = 0; i < sizeof(BACKENDS) / sizeof(BACKENDS[0]) - 1; ++i)
+    {
+        if(getRequiredMemory(BACKENDS[i], cities.size()) <= budget)
+        {
+            return create(BACKENDS[i], cities, hugePages, cacheDirectory);
+        }
+    }
+
+    return new DistanceOracle(cities);
+}
+
+uint64_t DistanceProvider::getRequiredMemory(const std::string& name,
+                                             const uint32_t     cityCount)
+{
+    uint64_t coordinates;
+
+    coordinates = (uint64_t)cityCount * 2 * sizeof(double);
+
+    if(name == "matrix")
+    {
+        return coordinates + (uint64_t)cityCount * cityCount * sizeof(double);
+    }
+    else if(name == "triangular")
+    {
+        return coordinates +
+               (uint64_t)cityCount * (cityCount == 0 ? 0 : cityCount - 1) /
+               2 * sizeof(float);
+    }
+    else if(name == "neighbours")
+    {
+        return coordinates +
+               ((uint64_t)cityCount * (NEIGHBOUR_LIST_SIZE + 1) + 1) *
+               sizeof(uint32_t);
+    }
+    else if(name == "oracle")
+    {
+        return coordinates;
+    }
+
+    return UINT64_MAX;
+}
+
+bool DistanceProvider::parseSize(const std::string& text, uint64_t& bytes)
+{
+    size_t   parsed;
+    uint64_t unit;
+
+    try
+    {
+        bytes = std::stoull(text, &parsed);
+    }
+    catch(const std::exception&)
+    {
+        return false;
+    }
+    if(text[0] == '-')
+    {
+        return false;
+    }
+
+    unit = 1;
+    if(parsed + 1 == text.size())
+    {
+        switch(text[parsed])
+        {
+            case 'K':
+            case 'k':
+                unit = 1ULL << 10;
+                break;
+            case 'M':
+            case 'm':
+                unit = 1ULL << 20;
+                break;
+            case 'G':
+            case 'g':
+                unit = 1ULL << 30;
+                break;
+            default:
+                return false;
+        }
+    }
+    else if(parsed != text.size())
+    {
+        return false;
+    }
+
+    if(bytes > UINT64_MAX / unit)
+    {
+        return false;
+    }
+    bytes *= unit;
+
+    return true;
+}
@@ -0,0 +1,167 @@
+/*******************************************************************************
+ * File: FullMatrixDistanceProvider.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * FullMatrixDistanceProvider implements the DistanceProvider class. The
+ * distances between every pair of cities are stored in a contiguous N x N
+ * double precision matrix.
+ ******************************************************************************/
+
+#include <cstdint>   /* Generic int types */
+#include <cstddef>   /* size_t */
+#include <vector>    /* std::vector */
+#include <utility>   /* std::pair */
+#include <algorithm> /* std::min, std::max */
+
+#include <solver/Solver.h>            /* city_t */
+#include <solver/HugePageAllocator.h> /* nsSolver::HugePageAllocator */
+#include <solver/DistanceOracle.h>    /* nsSolver::DistanceOracle */
+#include <solver/ThreadPool.h>        /* nsSolver::ThreadPool */
+
+/* Header file */
+#include <solver/FullMatrixDistanceProvider.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+FullMatrixDistanceProvider::FullMatrixDistanceProvider(
+                                        const std::vector<city_t>& cities,
+                                        const HugePageMode         hugePages):
+    oracle(cities)
+{
+    this->cityCount = 0;
+    this->allocator = new HugePageAllocator(hugePages);
+    this->distances = nullptr;
+
+    build();
+}
+
+FullMatrixDistanceProvider::~FullMatrixDistanceProvider(void)
+{
+    /* The matrix is released with the allocator */
+    delete this->allocator;
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+double FullMatrixDistanceProvider::getDistance(const uint32_t from,
+                                               const uint32_t to) const
+{
+    return this->distances[(size_t)from * this->cityCount + to];
+}
+
+uint32_t FullMatrixDistanceProvider::getCityCount(void) const
+{
+    return this->cityCount;
+}
+
+size_t FullMatrixDistanceProvider::getMemoryFootprint(void) const
+{
+    return (size_t)this->cityCount * this->cityCount * sizeof(double) +
+           this->oracle.getMemoryFootprint();
+}
+
+const char* FullMatrixDistanceProvider::getName(void) const
+{
+    return "matrix";
+}
+
+HugePageMode FullMatrixDistanceProvider::getHugePageBacking(void) const
+{
+    return this->allocator->getBacking(this->distances);
+}
+
+bool FullMatrixDistanceProvider::rebuild(const std::vector<city_t>& cities)
+{
+    if(this->oracle.hasCities(cities))
+    {
+        return false;
+    }
+
+    this->oracle = DistanceOracle(cities);
+    build();
+
+    return true;
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+void FullMatrixDistanceProvider::build(void)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t tileCount;
+
+    std::vector<std::pair<uint32_t, uint32_t>> tiles;
+
+    /* Keep the buffer when the size did not change */
+    if(this->oracle.getCityCount() != this->cityCount)
+    {
+        this->allocator->release(this->distances);
+        this->cityCount = this->oracle.getCityCount();
+        this->distances = (double*)this->allocator->allocate(
+                                        (size_t)this->cityCount *
+                                        this->cityCount * sizeof(double));
+    }
+
+    tileCount = (this->cityCount + DISTANCE_TILE_SIZE - 1) /
+                DISTANCE_TILE_SIZE;
+    for(i = 0; i < tileCount; ++i)
+    {
+        for(j = i; j < tileCount; ++j)
+        {
+            tiles.push_back(std::make_pair(i, j));
+        }
+    }
+
+    this->pool.run(tiles.size(), [this, &tiles](const uint32_t index)
+    {
+        buildTile(tiles[index].first, tiles[index].second);
+    });
+}
+
+void FullMatrixDistanceProvider::buildTile(const uint32_t rowTile,
+                                           const uint32_t columnTile)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t rowEnd;
+    uint32_t columnStart;
+    uint32_t columnEnd;
+    uint32_t start;
+    double*  row;
+
+    rowEnd      = std::min((rowTile + 1) * DISTANCE_TILE_SIZE,
+                           this->cityCount);
+    columnStart = columnTile * DISTANCE_TILE_SIZE;
+    columnEnd   = std::min(columnStart + DISTANCE_TILE_SIZE, this->cityCount);
+
+    for(i = rowTile * DISTANCE_TILE_SIZE; i < rowEnd; ++i)
+    {
+        row = this->distances + (size_t)i * this->cityCount;
+
+        /* Above the diagonal, then mirrored below it */
+        start = std::max(columnStart, i + 1);
+        if(start < columnEnd)
+        {
+            this->oracle.getDistances(i, start, columnEnd, row + start);
+            for(j = start; j < columnEnd; ++j)
+            {
+                this->distances[(size_t)j * this->cityCount + i] = row[j];
+            }
+        }
+        if(rowTile == columnTile)
+        {
+            row[i] = 0;
+        }
+    }
+}
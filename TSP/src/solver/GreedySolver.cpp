@@ -14,11 +14,13 @@
 
 #include <cstdint>  /* uint32_t */
 #include <vector>   /* std::vector */
-#include <iostream> /* std::cout, std::endl */
 #include <random>   /* std::random_device, std::mt19937,
                        std::uniform_int_distribution */
 
-#include <solver/Solver.h> /* city_t */
+#include <solver/Solver.h>           /* city_t */
+#include <solver/DistanceProvider.h> /* nsSolver::DistanceProvider */
+#include <solver/DistanceOracle.h>   /* nsSolver::DistanceOracle */
+#include <solver/SpatialGrid.h>      /* nsSolver::SpatialGrid */
 
 /* Header file */
 #include <solver/GreedySolver.h>
@@ -28,11 +30,19 @@ using namespace nsSolver; /* Solver's namespace */
 /*******************************************************************************
  * Constructors / Destructors
  ******************************************************************************/
-GreedySolver::GreedySolver(const std::vector<city_t>& cities)
+GreedySolver::GreedySolver(const std::vector<city_t>& cities):
+    GreedySolver(cities, nullptr)
+{
+    this->distances = &this->coordinates;
+}
+
+GreedySolver::GreedySolver(const std::vector<city_t>& cities,
+                           const DistanceProvider*    distances):
+    coordinates(cities)
 {
     this->cities = cities;
 
-    this->distanceMatrix = nullptr;
+    this->distances = distances;
 
     /* Initialize the random generator */
     std::random_device rd;
@@ -44,7 +54,6 @@ GreedySolver::GreedySolver(const std::vector<city_t>& cities)
 
 GreedySolver::~GreedySolver(void)
 {
-
 }
 
 /*******************************************************************************
@@ -55,73 +64,95 @@ void GreedySolver::solve(std::vector<uint32_t>& solution,
 {
     uint32_t cityCount;
     uint32_t i;
-    uint32_t j;
+    uint32_t current;
     uint32_t bestIndex;
-    double   dX;
-    double   dY;
     double   bestDistance;
-    std::vector<uint32_t> visited(this->cities.size(), false);
+
+    std::vector<uint8_t> visited(this->cities.size(), false);
+    SpatialGrid*         grid;
+
     cityCount = this->cities.size();
 
-    /* Create the distances matrix */
-    if(this->distanceMatrix != nullptr)
-    {
-        for(i = 0; i < cityCount; ++i)
-        {
-            delete[] this->distanceMatrix[i];
-        }
-        delete[] this->distanceMatrix;
-    }
-    this->distanceMatrix = new double*[cityCount];
-    for(i = 0; i < cityCount; ++i)
-    {
-        this->distanceMatrix[i] = new double[cityCount];
-    }
+    /* Initializes the data */
+    solution.clear();
+    distance = 0;
 
-    /* Compute the distance matrix */
-    for(i = 0; i < cityCount; ++i)
+    if(cityCount == 0)
     {
-        for(j = 0; j < cityCount; ++j)
-        {
-            dX = this->cities[i].x - this->cities[j].x;
-            dY = this->cities[i].y - this->cities[j].y;
-            this->distanceMatrix[i][j] = sqrt(dX * dX + dY * dY);
-        }
+        return;
     }
-    std::cout << "Created distance matrix" << std::endl;
 
     /* Set starting city */
-    solution.clear();
+    grid = nullptr;
+    if(cityCount >= GREEDY_GRID_MIN_SIZE)
+    {
+        grid = new SpatialGrid(this->cities);
+        grid->remove(0);
+    }
     solution.push_back(0);
     visited[0] = true;
-    distance = 0;
+    current    = 0;
 
-    /* Fill the rest of the cities */
+    /* Always go to the nearest city not visited yet */
     for(i = 1; i < cityCount; ++i)
     {
-        bestDistance = -1;
-        /* Search for the best next distacne */
-        for(j = 0; j < cityCount; ++j)
+        bestIndex = getNearest(current, visited, grid, bestDistance);
+
+        visited[bestIndex] = true;
+        if(grid != nullptr)
         {
-            if(j == i) continue;
-            if(!visited[j] &&
-               (bestDistance > this->distanceMatrix[i][j] ||
-                bestDistance == -1))
-                {
-                    bestDistance = this->distanceMatrix[i][j];
-                    bestIndex = j;
-                }
+            grid->remove(bestIndex);
         }
-        visited[bestIndex] = true;
         distance += bestDistance;
         solution.push_back(bestIndex);
+        current = bestIndex;
     }
+
+    /* Close the tour */
+    distance += this->distances->getDistance(current, 0);
+
+    delete grid;
 }
 
 /*******************************************************************************
  * Private methods
  ******************************************************************************/
+uint32_t GreedySolver::getNearest(const uint32_t              current,
+                                  const std::vector<uint8_t>& visited,
+                                  const SpatialGrid*          grid,
+                                  double& bestDistance) const
+{
+    uint32_t        j;
+    uint32_t        bestIndex;
+    uint32_t        neighbourCount;
+    const uint32_t* neighbours;
+
+    /* The lists are sorted, the first unvisited neighbour is the nearest
+     * unvisited city */
+    neighbourCount = this->distances->getNeighbours(current, &neighbours);
+    for(j = 0; j < neighbourCount; ++j)
+    {
+        if(!visited[neighbours[j]])
+        {
+            bestDistance = this->distances->getDistance(current,
+                                                        neighbours[j]);
+            return neighbours[j];
+        }
+    }
+
+    if(grid != nullptr)
+    {
+        bestIndex = grid->getNearest(this->cities[current].x,
+                                     this->cities[current].y);
+    }
+    else
+    {
+        bestIndex = this->coordinates.getNearest(current, visited);
+    }
+    bestDistance = this->distances->getDistance(current, bestIndex);
 
+    return bestIndex;
+}
 
 #ifdef _TESTMODE
 /*******************************************************************************
@@ -129,6 +160,37 @@ void GreedySolver::solve(std::vector<uint32_t>& solution,
  ******************************************************************************/
 /* LCOV_EXCL_START */
 
+#include <stdexcept> /* std::runtime_error */
+#include <cmath>     /* std::fabs */
+void GreedySolver::testSolve(void)
+{
+    uint32_t i;
+    double   length;
+
+    std::vector<uint32_t> tour;
+    std::vector<uint8_t>  seen(this->cities.size(), false);
+
+    solve(tour, length);
+    if(tour.size() != this->cities.size())
+    {
+        throw std::runtime_error("Wrong solution size: " +
+                                 std::to_string(tour.size()));
+    }
+    for(i = 0; i < tour.size(); ++i)
+    {
+        if(tour[i] >= this->cities.size() || seen[tour[i]])
+        {
+            throw std::runtime_error("Solution is not a tour");
+        }
+        seen[tour[i]] = true;
+    }
+    if(std::fabs(this->distances->getTourLength(tour) - length) >
+       1e-6 * (1 + length))
+    {
+        throw std::runtime_error("Solution does not match its distance: " +
+                                 std::to_string(length));
+    }
+}
 
 /* LCOV_EXCL_STOP */
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,250 @@
+/*******************************************************************************
+ * File: HugePageAllocator.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Allocator backing large buffers with huge pages. Explicit huge pages are
+ * requested with MAP_HUGETLB, transparent huge pages with
+ * madvise(MADV_HUGEPAGE). The allocator falls back to the next mode when a
+ * mode is not available.
+ * The NQueensProblem and TSP projects build on their own, each one keeps a
+ * copy of the allocator. The unit_tests.sh scripts check that the copies
+ * stay identical.
+ ******************************************************************************/
+
+#include <cstdint>    /* Generic int types, uintptr_t */
+#include <cstddef>    /* size_t */
+#include <string>     /* std::string, std::stoull */
+#include <map>        /* std::map */
+#include <new>        /* operator new, operator delete */
+#include <fstream>    /* std::ifstream */
+#include <sys/mman.h> /* mmap, munmap, madvise, MAP_*, MADV_* */
+
+/* Header file */
+#include <solver/HugePageAllocator.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+HugePageAllocator::HugePageAllocator(const HugePageMode mode)
+{
+    this->mode = mode;
+
+    this->backedBytes[HUGE_PAGES_OFF]         = 0;
+    this->backedBytes[HUGE_PAGES_TRANSPARENT] = 0;
+    this->backedBytes[HUGE_PAGES_EXPLICIT]    = 0;
+}
+
+HugePageAllocator::~HugePageAllocator(void)
+{
+    while(!this->blocks.empty())
+    {
+        release(this->blocks.begin()->first);
+    }
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+void* HugePageAllocator::allocate(const size_t size)
+{
+    size_t mapSize;
+    void*  address;
+    Block  block;
+
+    if(size == 0)
+    {
+        return nullptr;
+    }
+
+    /* Try the modes from the requested one down to the heap */
+    address = nullptr;
+    block.size    = size;
+    block.mapSize = 0;
+    block.backing = HUGE_PAGES_OFF;
+    if(this->mode != HUGE_PAGES_OFF && size >= HUGE_PAGE_MIN_SIZE)
+    {
+        mapSize = (size + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+        if(this->mode == HUGE_PAGES_EXPLICIT)
+        {
+            address       = map(mapSize, HUGE_PAGES_EXPLICIT);
+            block.backing = HUGE_PAGES_EXPLICIT;
+        }
+        if(address == nullptr)
+        {
+            address       = map(mapSize, HUGE_PAGES_TRANSPARENT);
+            block.backing = HUGE_PAGES_TRANSPARENT;
+        }
+        if(address != nullptr)
+        {
+            block.mapSize = mapSize;
+        }
+    }
+    if(address == nullptr)
+    {
+        address       = ::operator new(size);
+        block.backing = HUGE_PAGES_OFF;
+    }
+
+    this->blocks[address] = block;
+    this->backedBytes[block.backing] += size;
+
+    return address;
+}
+
+void HugePageAllocator::release(void* address)
+{
+    std::map<void*, Block>::iterator it;
+
+    it = this->blocks.find(address);
+    if(it == this->blocks.end())
+    {
+        return;
+    }
+
+    if(it->second.mapSize != 0)
+    {
+        munmap(address, it->second.mapSize);
+    }
+    else
+    {
+        ::operator delete(address);
+    }
+    this->backedBytes[it->second.backing] -= it->second.size;
+    this->blocks.erase(it);
+}
+
+HugePageMode HugePageAllocator::getMode(void) const
+{
+    return this->mode;
+}
+
+HugePageMode HugePageAllocator::getBacking(const void* address) const
+{
+    std::map<void*, Block>::const_iterator it;
+
+    it = this->blocks.find(const_cast<void*>(address));
+    if(it == this->blocks.end())
+    {
+        return HUGE_PAGES_OFF;
+    }
+    return it->second.backing;
+}
+
+size_t HugePageAllocator::getBackedBytes(const HugePageMode backing) const
+{
+    return this->backedBytes[backing];
+}
+
+bool HugePageAllocator::parseMode(const std::string& name, HugePageMode& mode)
+{
+    if(name == "off")
+    {
+        mode = HUGE_PAGES_OFF;
+    }
+    else if(name == "transparent")
+    {
+        mode = HUGE_PAGES_TRANSPARENT;
+    }
+    else if(name == "explicit")
+    {
+        mode = HUGE_PAGES_EXPLICIT;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+const char* HugePageAllocator::getModeName(const HugePageMode mode)
+{
+    switch(mode)
+    {
+        case HUGE_PAGES_TRANSPARENT:
+            return "transparent";
+        case HUGE_PAGES_EXPLICIT:
+            return "explicit";
+        default:
+            return "off";
+    }
+}
+
+size_t HugePageAllocator::getTransparentHugeBytes(void)
+{
+    size_t      total;
+    std::string key;
+    std::string value;
+
+    std::ifstream file("/proc/self/smaps_rollup");
+
+    /* AnonHugePages:  2048 kB */
+    total = 0;
+    while(file >> key >> value)
+    {
+        if(key == "AnonHugePages:")
+        {
+            total = std::stoull(value) * 1024;
+            break;
+        }
+        std::getline(file, value);
+    }
+
+    return total;
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+void* HugePageAllocator::map(const size_t       size,
+                             const HugePageMode backing) const
+{
+    uint8_t*  address;
+    uintptr_t aligned;
+    size_t    head;
+
+    if(backing == HUGE_PAGES_EXPLICIT)
+    {
+#ifdef MAP_HUGETLB
+        address = (uint8_t*)mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                                 -1, 0);
+        return (address == MAP_FAILED) ? nullptr : address;
+#else
+        return nullptr;
+#endif
+    }
+
+    /* Map one more huge page and trim the mapping to an aligned buffer so
+     * the kernel can use huge pages from the first byte */
+    address = (uint8_t*)mmap(nullptr, size + HUGE_PAGE_SIZE,
+                             PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(address == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    aligned = ((uintptr_t)address + HUGE_PAGE_SIZE - 1) &
+              ~(uintptr_t)(HUGE_PAGE_SIZE - 1);
+    head    = aligned - (uintptr_t)address;
+    if(head != 0)
+    {
+        munmap(address, head);
+    }
+    munmap((uint8_t*)aligned + size, HUGE_PAGE_SIZE - head);
+
+#ifdef MADV_HUGEPAGE
+    /* The advice fails when transparent huge pages are not supported, the
+     * buffer still works with regular pages */
+    madvise((void*)aligned, size, MADV_HUGEPAGE);
+#endif
+
+    return (void*)aligned;
+}
@@ -0,0 +1,330 @@
+/*******************************************************************************
+ * File: LinKernighanSolver.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * LinKernighanSolver implements the Solver class. Any class implementing the
+ * Solver interface is assumed to solve the TSP.
+ * The algorithm improves the greedy tour with Lin-Kernighan variable depth
+ * moves until no move improves it.
+ ******************************************************************************/
+
+#include <cstdint> /* Generic int types */
+#include <vector>  /* std::vector */
+#include <string>  /* std::string */
+#include <utility> /* std::swap */
+
+#include <solver/Solver.h>            /* city_t */
+#include <solver/DistanceProvider.h>  /* nsSolver::DistanceProvider */
+#include <solver/LocalSearchSolver.h> /* nsSolver::LocalSearchSolver */
+#include <solver/Tour.h>              /* nsSolver::Tour */
+#include <solver/SpatialGrid.h>       /* SPATIAL_GRID_QUADRANTS */
+
+/* Header file */
+#include <solver/LinKernighanSolver.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+LinKernighanSolver::LinKernighanSolver(const std::vector<city_t>& cities,
+                                       const DistanceProvider*    distances,
+                                       const uint32_t             iterCount,
+                                       const std::string& cacheDirectory):
+    LocalSearchSolver(cities, distances, iterCount, cacheDirectory)
+{
+    uint32_t i;
+
+    for(i = 0; i < MOVE_TYPE_COUNT; ++i)
+    {
+        setMoveEnabled((MoveType)i, i == MOVE_LIN_KERNIGHAN);
+    }
+
+    this->bestGain  = 0;
+    this->bestCount = 0;
+}
+
+LinKernighanSolver::~LinKernighanSolver(void)
+{
+}
+
+/*******************************************************************************
+ * Protected methods
+ ******************************************************************************/
+bool LinKernighanSolver::improveCity(Tour& tour, const uint32_t city)
+{
+    if(this->moveEnabled[MOVE_LIN_KERNIGHAN] && tour.getCityCount() >= 8 &&
+       improveLinKernighan(tour, city))
+    {
+        return true;
+    }
+
+    return LocalSearchSolver::improveCity(tour, city);
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+void LinKernighanSolver::exchange(Tour&          tour,
+                                  const uint32_t a,
+                                  const uint32_t b,
+                                  const uint32_t c,
+                                  const uint32_t d)
+{
+    tour.exchange(a, b, c, d);
+
+    this->exchanges.push_back(a);
+    this->exchanges.push_back(b);
+    this->exchanges.push_back(c);
+    this->exchanges.push_back(d);
+}
+
+void LinKernighanSolver::undo(Tour& tour, const uint32_t count)
+{
+    uint32_t size;
+
+    /* The exchange (a, b, c, d) left a c ... b d */
+    while(this->exchanges.size() > count * 4)
+    {
+        size = this->exchanges.size();
+        tour.exchange(this->exchanges[size - 4], this->exchanges[size - 2],
+                      this->exchanges[size - 3], this->exchanges[size - 1]);
+        this->exchanges.resize(size - 4);
+    }
+}
+
+bool LinKernighanSolver::isAdded(const uint32_t a, const uint32_t b) const
+{
+    uint32_t i;
+
+    for(i = 0; i < this->added.size(); i += 2)
+    {
+        if((this->added[i] == a && this->added[i + 1] == b) ||
+           (this->added[i] == b && this->added[i + 1] == a))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void LinKernighanSolver::close(const double gain)
+{
+    if(gain > this->bestGain)
+    {
+        this->bestGain  = gain;
+        this->bestCount = this->exchanges.size() / 4;
+    }
+}
+
+bool LinKernighanSolver::deepen(Tour&          tour,
+                                const uint32_t level,
+                                const uint32_t t1,
+                                const uint32_t last,
+                                const double   gain)
+{
+    uint32_t        i;
+    uint32_t        j;
+    uint32_t        best;
+    uint32_t        count;
+    uint32_t        direction;
+    uint32_t        breadth;
+    uint32_t        candidateCount;
+    uint32_t        exchangeCount;
+    uint32_t        t3[LIN_KERNIGHAN_CANDIDATES];
+    uint32_t        t4[LIN_KERNIGHAN_CANDIDATES];
+    double          value[LIN_KERNIGHAN_CANDIDATES];
+    double          added;
+    const uint32_t* neighbours;
+
+    /* t4 is on the same side of t3 as t1 of last, the exchange closes the
+     * tour with (t4, t1) */
+    direction      = tour.getNext(last) == t1 ? 0 : 1;
+    count          = this->lists.getNeighbours(last, &neighbours);
+    candidateCount = 0;
+    for(i = 0; i < count && candidateCount < LIN_KERNIGHAN_CANDIDATES; ++i)
+    {
+        added = getDistance(last, neighbours[i]);
+        if(gain - added <= 0)
+        {
+            break;
+        }
+
+        t3[candidateCount] = neighbours[i];
+        t4[candidateCount] = tour.getStep(neighbours[i], direction);
+        if(t3[candidateCount] == t1 || t4[candidateCount] == t1 ||
+           t4[candidateCount] == last ||
+           isAdded(t3[candidateCount], t4[candidateCount]))
+        {
+            continue;
+        }
+        value[candidateCount] = getDistance(t3[candidateCount],
+                                            t4[candidateCount]) - added;
+        ++candidateCount;
+    }
+    this->stats[MOVE_LIN_KERNIGHAN].evaluated += candidateCount;
+
+    breadth = level == 1 ? LIN_KERNIGHAN_BREADTH_1 :
+              level == 2 ? LIN_KERNIGHAN_BREADTH_2 : 1;
+    exchangeCount = this->exchanges.size() / 4;
+    for(i = 0; i < breadth && i < candidateCount; ++i)
+    {
+        /* Selects the best remaining alternative */
+        best = i;
+        for(j = i + 1; j < candidateCount; ++j)
+        {
+            if(value[j] > value[best])
+            {
+                best = j;
+            }
+        }
+        std::swap(t3[i], t3[best]);
+        std::swap(t4[i], t4[best]);
+        std::swap(value[i], value[best]);
+
+        exchange(tour, last, t1, t3[i], t4[i]);
+        this->added.push_back(last);
+        this->added.push_back(t3[i]);
+        close(gain + value[i] - getDistance(t4[i], t1));
+
+        if(level < LIN_KERNIGHAN_MAX_DEPTH)
+        {
+            deepen(tour, level + 1, t1, t4[i], gain + value[i]);
+        }
+        if(this->bestGain > LOCAL_SEARCH_EPSILON)
+        {
+            return true;
+        }
+
+        undo(tour, exchangeCount);
+        this->added.resize(this->added.size() - 2);
+    }
+
+    return false;
+}
+
+bool LinKernighanSolver::alternateFirstStep(Tour&          tour,
+                                            const uint32_t t1,
+                                            const uint32_t t2)
+{
+    uint32_t        i;
+    uint32_t        j;
+    uint32_t        tried3;
+    uint32_t        tried5;
+    uint32_t        count2;
+    uint32_t        count4;
+    uint32_t        direction;
+    uint32_t        t3;
+    uint32_t        t4;
+    uint32_t        t5;
+    uint32_t        t6;
+    double          gain1;
+    double          gain2;
+    double          gain3;
+    const uint32_t* neighbours2;
+    const uint32_t* neighbours4;
+
+    count2 = this->lists.getNeighbours(t2, &neighbours2);
+    tried3 = 0;
+    for(i = 0; i < count2 && tried3 < LIN_KERNIGHAN_BREADTH_1; ++i)
+    {
+        t3    = neighbours2[i];
+        gain1 = getDistance(t1, t2) - getDistance(t2, t3);
+        if(gain1 <= 0)
+        {
+            break;
+        }
+
+        /* t4 is on the side of t3 that does not close a tour */
+        direction = tour.getNext(t1) == t2 ? 0 : 1;
+        t4        = tour.getStep(t3, direction);
+        if(t3 == t1 || t4 == t1)
+        {
+            continue;
+        }
+        ++tried3;
+
+        count4 = this->lists.getNeighbours(t4, &neighbours4);
+        tried5 = 0;
+        for(j = 0; j < count4 && tried5 < LIN_KERNIGHAN_BREADTH_2; ++j)
+        {
+            t5    = neighbours4[j];
+            gain2 = gain1 + getDistance(t3, t4) - getDistance(t4, t5);
+            if(gain2 <= 0)
+            {
+                break;
+            }
+
+            /* t5 and t6 are on the path from t2 to t3. Undoing the
+             * exchanges may have reversed the orientation of the tour */
+            direction = tour.getNext(t1) == t2 ? 0 : 1;
+            if(t5 == t3 || !tour.isOnPath(t2, t5, t3, direction))
+            {
+                continue;
+            }
+            t6 = tour.getStep(t5, direction);
+            ++tried5;
+            ++this->stats[MOVE_LIN_KERNIGHAN].evaluated;
+
+            /* t1 t2 ... t5 t6 ... t3 t4 becomes t1 t6 ... t3 t2 ... t5 t4 */
+            exchange(tour, t1, t2, t3, t4);
+            exchange(tour, t1, t3, t6, t5);
+            exchange(tour, t3, t5, t2, t4);
+            this->added.push_back(t2);
+            this->added.push_back(t3);
+            this->added.push_back(t4);
+            this->added.push_back(t5);
+
+            gain3 = gain2 + getDistance(t5, t6);
+            close(gain3 - getDistance(t6, t1));
+
+            deepen(tour, 3, t1, t6, gain3);
+            if(this->bestGain > LOCAL_SEARCH_EPSILON)
+            {
+                return true;
+            }
+
+            undo(tour, 0);
+            this->added.clear();
+        }
+    }
+
+    return false;
+}
+
+bool LinKernighanSolver::improveLinKernighan(Tour& tour, const uint32_t city)
+{
+    uint32_t i;
+    uint32_t t2[2];
+
+    /* A failed move may reverse the orientation of the tour, both ends are
+     * read before the first move */
+    t2[0] = tour.getNext(city);
+    t2[1] = tour.getPrev(city);
+    for(i = 0; i < 2; ++i)
+    {
+        this->exchanges.clear();
+        this->added.clear();
+        this->bestGain  = 0;
+        this->bestCount = 0;
+
+        if(deepen(tour, 1, city, t2[i], getDistance(city, t2[i])) ||
+           alternateFirstStep(tour, city, t2[i]))
+        {
+            /* Keep the exchanges up to the best closed tour */
+            undo(tour, this->bestCount);
+            applied(MOVE_LIN_KERNIGHAN, this->bestGain,
+                    this->exchanges.data(), this->exchanges.size());
+
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,538 @@
+/*******************************************************************************
+ * File: LocalSearchSolver.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * LocalSearchSolver implements the Solver class. Any class implementing the
+ * Solver interface is assumed to solve the TSP.
+ * The algorithm improves the greedy tour with 2-opt, Or-opt and segment
+ * insertion moves until no move improves it.
+ ******************************************************************************/
+
+#include <cstdint>  /* Generic int types */
+#include <vector>   /* std::vector */
+#include <string>   /* std::string */
+#include <iostream> /* std::cout, std::endl */
+#include <chrono>   /* std::chrono */
+
+#include <solver/Solver.h>           /* city_t */
+#include <solver/DistanceProvider.h> /* nsSolver::DistanceProvider */
+#include <solver/DistanceOracle.h>   /* nsSolver::DistanceOracle */
+#include <solver/NeighbourLists.h>   /* nsSolver::NeighbourLists */
+#include <solver/GreedySolver.h>     /* nsSolver::GreedySolver */
+#include <solver/Tour.h>             /* nsSolver::Tour */
+#include <solver/ArrayTour.h>        /* nsSolver::ArrayTour */
+#include <solver/TwoLevelListTour.h> /* nsSolver::TwoLevelListTour */
+
+/* Header file */
+#include <solver/LocalSearchSolver.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/* The names of the move types */
+static const char* MOVE_NAMES[MOVE_TYPE_COUNT] = {
+    "2-opt", "or-opt", "segment insertion", "lin-kernighan"
+};
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+LocalSearchSolver::LocalSearchSolver(const std::vector<city_t>& cities,
+                                     const DistanceProvider*    distances,
+                                     const uint32_t             iterCount,
+                                     const std::string&         cacheDirectory):
+    coordinates(cities),
+    lists(cities, LOCAL_SEARCH_NEAREST_COUNT, LOCAL_SEARCH_QUADRANT_COUNT,
+          cacheDirectory)
+{
+    uint32_t i;
+
+    this->cities    = cities;
+    this->distances = distances;
+    if(this->distances == nullptr)
+    {
+        this->distances = &this->coordinates;
+    }
+
+    this->iterCount = iterCount;
+    this->moveCount = 0;
+    this->queueHead = 0;
+    this->queueSize = 0;
+
+    for(i = 0; i < MOVE_TYPE_COUNT; ++i)
+    {
+        this->moveEnabled[i] = i != MOVE_LIN_KERNIGHAN;
+        this->stats[i]       = {0, 0, 0};
+    }
+}
+
+LocalSearchSolver::~LocalSearchSolver(void)
+{
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+void LocalSearchSolver::improve(Tour& tour)
+{
+    uint32_t i;
+    uint32_t city;
+    uint64_t roundStart;
+
+    this->moveCount = 0;
+    this->queueHead = 0;
+    this->queueSize = 0;
+    this->queue.resize(tour.getCityCount());
+    this->queued.assign(tour.getCityCount(), false);
+    for(i = 0; i < MOVE_TYPE_COUNT; ++i)
+    {
+        this->stats[i] = {0, 0, 0};
+    }
+
+    if(tour.getCityCount() < 4)
+    {
+        return;
+    }
+
+    /* A move also changes the candidate moves of the cities having its ends
+     * in their lists, every city is looked at again when the queue is empty
+     * until a whole round applies no move */
+    do
+    {
+        roundStart = this->moveCount;
+
+        city = 0;
+        for(i = 0; i < tour.getCityCount(); ++i)
+        {
+            push(city);
+            city = tour.getNext(city);
+        }
+
+        while(this->queueSize > 0 && this->moveCount < this->iterCount)
+        {
+            city = this->queue[this->queueHead];
+            this->queueHead = this->queueHead + 1 == this->queue.size() ?
+                              0 : this->queueHead + 1;
+            --this->queueSize;
+            this->queued[city] = false;
+
+            /* The city enters the queue again with the ends of the move */
+            improveCity(tour, city);
+        }
+    } while(this->moveCount != roundStart &&
+            this->moveCount < this->iterCount);
+}
+
+uint64_t LocalSearchSolver::getMoveCount(void) const
+{
+    return this->moveCount;
+}
+
+void LocalSearchSolver::setMoveEnabled(const MoveType type, const bool enabled)
+{
+    this->moveEnabled[type] = enabled;
+}
+
+const move_stats_t& LocalSearchSolver::getStats(const MoveType type) const
+{
+    return this->stats[type];
+}
+
+const char* LocalSearchSolver::getMoveName(const MoveType type)
+{
+    return MOVE_NAMES[type];
+}
+
+void LocalSearchSolver::solve(std::vector<uint32_t>& solution,
+                              double &distance)
+{
+    uint32_t i;
+    uint64_t evaluated;
+    double   greedyDistance;
+    double   elapsed;
+    Tour*    tour;
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    solution.clear();
+    distance = 0;
+    if(this->cities.empty())
+    {
+        return;
+    }
+
+    GreedySolver greedy(this->cities, this->distances);
+    greedy.solve(solution, greedyDistance);
+
+    start = std::chrono::high_resolution_clock::now();
+    if(solution.size() >= LOCAL_SEARCH_LIST_TOUR_SIZE)
+    {
+        tour = new TwoLevelListTour(solution);
+    }
+    else
+    {
+        tour = new ArrayTour(solution);
+    }
+    improve(*tour);
+    tour->getOrder(solution);
+    delete tour;
+    distance = this->distances->getTourLength(solution);
+    elapsed  = std::chrono::duration<double>(
+                    std::chrono::high_resolution_clock::now() - start).count();
+
+    evaluated = 0;
+    for(i = 0; i < MOVE_TYPE_COUNT; ++i)
+    {
+        evaluated += this->stats[i].evaluated;
+        if(this->moveEnabled[i])
+        {
+            std::cout << MOVE_NAMES[i] << ": " << this->stats[i].applied
+                      << " applied / " << this->stats[i].evaluated
+                      << " evaluated | gain " << this->stats[i].gain
+                      << std::endl;
+        }
+    }
+    std::cout << "Local search: " << this->moveCount << " moves, "
+              << evaluated << " evaluated in " << elapsed << "s ("
+              << (elapsed > 0 ? evaluated / elapsed : 0)
+              << " evaluations/s) | greedy tour " << greedyDistance
+              << std::endl;
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+void LocalSearchSolver::push(const uint32_t city)
+{
+    uint32_t tail;
+
+    if(this->queued[city])
+    {
+        return;
+    }
+
+    tail = this->queueHead + this->queueSize;
+    if(tail >= this->queue.size())
+    {
+        tail -= this->queue.size();
+    }
+    this->queue[tail]  = city;
+    this->queued[city] = true;
+    ++this->queueSize;
+}
+
+void LocalSearchSolver::applied(const MoveType  type,
+                                const double    gain,
+                                const uint32_t* ends,
+                                const uint32_t  endCount)
+{
+    uint32_t i;
+
+    ++this->moveCount;
+    ++this->stats[type].applied;
+    this->stats[type].gain += gain;
+
+    for(i = 0; i < endCount; ++i)
+    {
+        push(ends[i]);
+    }
+}
+
+bool LocalSearchSolver::improveCity(Tour& tour, const uint32_t city)
+{
+    if(this->moveEnabled[MOVE_TWO_OPT] && improveTwoOpt(tour, city))
+    {
+        return true;
+    }
+    if(this->moveEnabled[MOVE_OR_OPT] && tour.getCityCount() >= 8 &&
+       improveOrOpt(tour, city))
+    {
+        return true;
+    }
+    if(this->moveEnabled[MOVE_SEGMENT_INSERTION] && tour.getCityCount() >= 6 &&
+       improveSegmentInsertion(tour, city))
+    {
+        return true;
+    }
+
+    return false;
+}
+
+bool LocalSearchSolver::improveTwoOpt(Tour& tour, const uint32_t city)
+{
+    uint32_t        i;
+    uint32_t        direction;
+    uint32_t        count;
+    uint32_t        a;
+    uint32_t        b;
+    uint32_t        c;
+    uint32_t        d;
+    uint32_t        ends[4];
+    double          removed;
+    double          added;
+    double          delta;
+    const uint32_t* neighbours;
+
+    count = this->lists.getNeighbours(city, &neighbours);
+    a     = city;
+
+    /* Direction 0 removes the edge to the next city, 1 the edge to the
+     * previous city */
+    for(direction = 0; direction < 2; ++direction)
+    {
+        b       = tour.getStep(a, direction);
+        removed = getDistance(a, b);
+
+        for(i = 0; i < count; ++i)
+        {
+            c     = neighbours[i];
+            added = getDistance(a, c);
+
+            /* The lists are sorted, the next candidates are farther */
+            if(added >= removed)
+            {
+                break;
+            }
+
+            d = tour.getStep(c, direction);
+            if(c == b || d == a)
+            {
+                continue;
+            }
+
+            ++this->stats[MOVE_TWO_OPT].evaluated;
+            delta = added + getDistance(b, d) - removed - getDistance(c, d);
+            if(delta < -LOCAL_SEARCH_EPSILON)
+            {
+                tour.exchange(a, b, c, d);
+
+                ends[0] = a;
+                ends[1] = b;
+                ends[2] = c;
+                ends[3] = d;
+                applied(MOVE_TWO_OPT, -delta, ends, 4);
+
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+bool LocalSearchSolver::improveOrOpt(Tour& tour, const uint32_t city)
+{
+    uint32_t        i;
+    uint32_t        j;
+    uint32_t        k;
+    uint32_t        length;
+    uint32_t        direction;
+    uint32_t        count;
+    uint32_t        end;
+    uint32_t        c;
+    uint32_t        p;
+    uint32_t        n;
+    uint32_t        x;
+    uint32_t        y;
+    uint32_t        segment[LOCAL_SEARCH_OR_OPT_LENGTH];
+    uint32_t        ends[6];
+    double          removed;
+    double          added;
+    double          reversedAdded;
+    double          edge;
+    bool            reversed;
+    const uint32_t* neighbours;
+
+    /* The segment starts at the city and goes in the direction, p and n are
+     * its neighbours */
+    for(direction = 0; direction < 2; ++direction)
+    {
+        p = tour.getStep(city, direction ^ 1);
+        segment[0] = city;
+        for(length = 1; length <= LOCAL_SEARCH_OR_OPT_LENGTH; ++length)
+        {
+            if(length > 1)
+            {
+                segment[length - 1] = tour.getStep(segment[length - 2],
+                                                   direction);
+            }
+            n = tour.getStep(segment[length - 1], direction);
+
+            removed = getDistance(p, segment[0]) +
+                      getDistance(segment[length - 1], n) - getDistance(p, n);
+            if(removed <= LOCAL_SEARCH_EPSILON)
+            {
+                continue;
+            }
+
+            /* The candidates of both ends of the segment */
+            for(k = 0; k < (length == 1 ? 1U : 2U); ++k)
+            {
+                end   = k == 0 ? segment[0] : segment[length - 1];
+                count = this->lists.getNeighbours(end, &neighbours);
+                for(i = 0; i < count; ++i)
+                {
+                    c = neighbours[i];
+                    if(getDistance(end, c) >= removed)
+                    {
+                        break;
+                    }
+
+                    /* Insert between c and one of its neighbours, x is
+                     * followed by y in the direction */
+                    for(j = 0; j < 2; ++j)
+                    {
+                        x = j == 0 ? c : tour.getStep(c, direction ^ 1);
+                        y = j == 0 ? tour.getStep(c, direction) : c;
+
+                        if(x == p || y == p || x == segment[0] ||
+                           x == segment[length - 1] ||
+                           (length == 3 && x == segment[1]))
+                        {
+                            continue;
+                        }
+
+                        edge          = getDistance(x, y);
+                        added         = getDistance(x, segment[0]) +
+                                        getDistance(segment[length - 1], y) -
+                                        edge;
+                        reversedAdded = getDistance(x, segment[length - 1]) +
+                                        getDistance(segment[0], y) - edge;
+                        this->stats[MOVE_OR_OPT].evaluated += length == 1 ? 1 :
+                                                                            2;
+
+                        reversed = length > 1 && reversedAdded < added;
+                        if(reversed)
+                        {
+                            added = reversedAdded;
+                        }
+                        if(removed - added <= LOCAL_SEARCH_EPSILON)
+                        {
+                            continue;
+                        }
+
+                        /* p s1 ... sL n ... x y becomes p x ... n sL ... s1 y,
+                         * then p n ... x sL ... s1 y */
+                        tour.exchange(p, segment[0], x, y);
+                        if(x != n)
+                        {
+                            tour.exchange(p, x, n, segment[length - 1]);
+                        }
+                        if(!reversed && length > 1)
+                        {
+                            tour.exchange(x, segment[length - 1],
+                                          segment[0], y);
+                        }
+
+                        ends[0] = p;
+                        ends[1] = n;
+                        ends[2] = x;
+                        ends[3] = y;
+                        ends[4] = segment[0];
+                        ends[5] = segment[length - 1];
+                        applied(MOVE_OR_OPT, removed - added, ends, 6);
+
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+bool LocalSearchSolver::improveSegmentInsertion(Tour&          tour,
+                                                const uint32_t city)
+{
+    uint32_t        i;
+    uint32_t        j;
+    uint32_t        direction;
+    uint32_t        count2;
+    uint32_t        count4;
+    uint32_t        t1;
+    uint32_t        t2;
+    uint32_t        t3;
+    uint32_t        t4;
+    uint32_t        t5;
+    uint32_t        t6;
+    uint32_t        ends[6];
+    double          removed;
+    double          gain1;
+    double          gain2;
+    double          gain;
+    const uint32_t* neighbours2;
+    const uint32_t* neighbours4;
+
+    t1 = city;
+    for(direction = 0; direction < 2; ++direction)
+    {
+        t2      = tour.getStep(t1, direction);
+        removed = getDistance(t1, t2);
+        count2  = this->lists.getNeighbours(t2, &neighbours2);
+
+        for(i = 0; i < count2; ++i)
+        {
+            t3    = neighbours2[i];
+            gain1 = removed - getDistance(t2, t3);
+            if(gain1 <= 0)
+            {
+                break;
+            }
+
+            t4 = tour.getStep(t3, direction);
+            if(t3 == t1 || t4 == t1)
+            {
+                continue;
+            }
+
+            count4 = this->lists.getNeighbours(t4, &neighbours4);
+            for(j = 0; j < count4; ++j)
+            {
+                t5    = neighbours4[j];
+                gain2 = gain1 + getDistance(t3, t4) - getDistance(t4, t5);
+                if(gain2 <= 0)
+                {
+                    break;
+                }
+
+                /* t5 and t6 are on the path from t2 to t3 */
+                if(t5 == t3 || !tour.isOnPath(t2, t5, t3, direction))
+                {
+                    continue;
+                }
+                t6 = tour.getStep(t5, direction);
+
+                ++this->stats[MOVE_SEGMENT_INSERTION].evaluated;
+                gain = gain2 + getDistance(t5, t6) - getDistance(t6, t1);
+                if(gain <= LOCAL_SEARCH_EPSILON)
+                {
+                    continue;
+                }
+
+                /* t1 t2 ... t5 t6 ... t3 t4 becomes t1 t6 ... t3 t2 ... t5 t4
+                 * through t1 t3 ... t6 t5 ... t2 t4 and
+                 * t1 t6 ... t3 t5 ... t2 t4 */
+                tour.exchange(t1, t2, t3, t4);
+                tour.exchange(t1, t3, t6, t5);
+                tour.exchange(t3, t5, t2, t4);
+
+                ends[0] = t1;
+                ends[1] = t2;
+                ends[2] = t3;
+                ends[3] = t4;
+                ends[4] = t5;
+                ends[5] = t6;
+                applied(MOVE_SEGMENT_INSERTION, gain, ends, 6);
+
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
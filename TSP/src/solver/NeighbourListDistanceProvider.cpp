@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * File: NeighbourListDistanceProvider.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * NeighbourListDistanceProvider implements the DistanceProvider class. The
+ * provider stores the nearest neighbours of each city and computes the
+ * distances on demand.
+ ******************************************************************************/
+
+#include <cstdint>   /* Generic int types */
+#include <cstddef>   /* size_t */
+#include <vector>    /* std::vector */
+#include <string>    /* std::string */
+
+#include <solver/Solver.h>         /* city_t */
+#include <solver/DistanceOracle.h> /* nsSolver::DistanceOracle */
+#include <solver/NeighbourLists.h> /* nsSolver::NeighbourLists */
+
+/* Header file */
+#include <solver/NeighbourListDistanceProvider.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+NeighbourListDistanceProvider::NeighbourListDistanceProvider(
+                                        const std::vector<city_t>& cities,
+                                        const std::string& cacheDirectory):
+    oracle(cities),
+    lists(cities, NEIGHBOUR_LIST_SIZE, 0, cacheDirectory)
+{
+}
+
+NeighbourListDistanceProvider::~NeighbourListDistanceProvider(void)
+{
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+double NeighbourListDistanceProvider::getDistance(const uint32_t from,
+                                                  const uint32_t to) const
+{
+    return this->oracle.getDistance(from, to);
+}
+
+uint32_t NeighbourListDistanceProvider::getCityCount(void) const
+{
+    return this->oracle.getCityCount();
+}
+
+size_t NeighbourListDistanceProvider::getMemoryFootprint(void) const
+{
+    return this->oracle.getMemoryFootprint() +
+           this->lists.getMemoryFootprint();
+}
+
+const char* NeighbourListDistanceProvider::getName(void) const
+{
+    return "neighbours";
+}
+
+uint32_t NeighbourListDistanceProvider::getNeighbours(
+                                        const uint32_t   city,
+                                        const uint32_t** neighbours) const
+{
+    return this->lists.getNeighbours(city, neighbours);
+}
+
+bool NeighbourListDistanceProvider::isCached(void) const
+{
+    return this->lists.isCached();
+}
@@ -0,0 +1,298 @@
+/*******************************************************************************
+ * File: NeighbourLists.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Candidate neighbour lists of the cities. The lists hold the nearest cities
+ * and optionally the nearest cities in each quadrant around a city. They are
+ * built in parallel and can be cached on disk.
+ ******************************************************************************/
+
+#include <cstdint>   /* Generic int types */
+#include <cstddef>   /* size_t */
+#include <cstdio>    /* std::rename, std::remove, snprintf */
+#include <cstring>   /* memcpy */
+#include <vector>    /* std::vector */
+#include <string>    /* std::string */
+#include <fstream>   /* std::ifstream, std::ofstream */
+#include <algorithm> /* std::min */
+
+#include <solver/Solver.h>      /* city_t */
+#include <solver/SpatialGrid.h> /* nsSolver::SpatialGrid */
+#include <solver/ThreadPool.h>  /* nsSolver::ThreadPool */
+
+/* Header file */
+#include <solver/NeighbourLists.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Static functions
+ ******************************************************************************/
+/* Adds the bytes of a word to a FNV-1a hash */
+static uint64_t hashWord(uint64_t hash, const uint64_t word)
+{
+    uint32_t i;
+
+    for(i = 0; i < sizeof(word); ++i)
+    {
+        hash ^= (word >> (i * 8)) & 0xFF;
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+NeighbourLists::NeighbourLists(const std::vector<city_t>& cities,
+                               const uint32_t             nearestCount,
+                               const uint32_t             quadrantCount,
+                               const std::string&         cacheDirectory)
+{
+    std::string fileName;
+
+    this->nearestCount  = nearestCount;
+    this->quadrantCount = quadrantCount;
+    this->hash          = getHash(cities);
+    this->cached        = false;
+
+    if(!cacheDirectory.empty())
+    {
+        fileName = getCacheFile(cacheDirectory, this->hash, nearestCount,
+                                quadrantCount);
+        if(load(fileName, cities.size()))
+        {
+            this->cached = true;
+            return;
+        }
+    }
+
+    build(cities);
+
+    /* A cache that cannot be written only costs the next build */
+    if(!fileName.empty())
+    {
+        save(fileName);
+    }
+}
+
+NeighbourLists::~NeighbourLists(void)
+{
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+uint32_t NeighbourLists::getCityCount(void) const
+{
+    return this->offsets.size() - 1;
+}
+
+uint32_t NeighbourLists::getNearestCount(void) const
+{
+    return this->nearestCount;
+}
+
+uint32_t NeighbourLists::getQuadrantCount(void) const
+{
+    return this->quadrantCount;
+}
+
+size_t NeighbourLists::getMemoryFootprint(void) const
+{
+    return (this->offsets.capacity() + this->neighbours.capacity()) *
+           sizeof(uint32_t);
+}
+
+bool NeighbourLists::isCached(void) const
+{
+    return this->cached;
+}
+
+std::string NeighbourLists::getCacheFile(const std::string& cacheDirectory,
+                                         const uint64_t     hash,
+                                         const uint32_t     nearestCount,
+                                         const uint32_t     quadrantCount)
+{
+    char name[64];
+
+    snprintf(name, sizeof(name), "neighbours-%016llx-%u-%u.bin",
+             (unsigned long long)hash, nearestCount, quadrantCount);
+
+    return cacheDirectory + "/" + name;
+}
+
+uint64_t NeighbourLists::getHash(const std::vector<city_t>& cities)
+{
+    uint32_t i;
+    uint64_t hash;
+    uint64_t word;
+
+    hash = hashWord(0xcbf29ce484222325ULL, cities.size());
+    for(i = 0; i < cities.size(); ++i)
+    {
+        memcpy(&word, &cities[i].x, sizeof(word));
+        hash = hashWord(hash, word);
+        memcpy(&word, &cities[i].y, sizeof(word));
+        hash = hashWord(hash, word);
+    }
+
+    return hash;
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+void NeighbourLists::build(const std::vector<city_t>& cities)
+{
+    uint32_t i;
+    uint32_t stride;
+    uint32_t taskCount;
+
+    std::vector<uint32_t> lists;
+    std::vector<uint32_t> counts(cities.size());
+
+    SpatialGrid grid(cities);
+    ThreadPool  pool;
+
+    /* Each task fills fixed size slots, the slots are packed afterwards */
+    stride = this->nearestCount + SPATIAL_GRID_QUADRANTS * this->quadrantCount;
+    lists.resize((size_t)cities.size() * stride);
+    taskCount = (cities.size() + NEIGHBOUR_LISTS_TASK_SIZE - 1) /
+                NEIGHBOUR_LISTS_TASK_SIZE;
+    pool.run(taskCount, [&](const uint32_t task)
+    {
+        uint32_t city;
+        uint32_t end;
+
+        end = std::min<size_t>((size_t)(task + 1) * NEIGHBOUR_LISTS_TASK_SIZE,
+                               cities.size());
+        for(city = task * NEIGHBOUR_LISTS_TASK_SIZE; city < end; ++city)
+        {
+            counts[city] = grid.getNeighbours(city, this->nearestCount,
+                                              this->quadrantCount,
+                                              lists.data() +
+                                              (size_t)city * stride);
+        }
+    });
+
+    this->offsets.resize(cities.size() + 1);
+    this->offsets[0] = 0;
+    for(i = 0; i < cities.size(); ++i)
+    {
+        this->offsets[i + 1] = this->offsets[i] + counts[i];
+    }
+    this->neighbours.resize(this->offsets[cities.size()]);
+    for(i = 0; i < cities.size(); ++i)
+    {
+        std::copy(lists.begin() + (size_t)i * stride,
+                  lists.begin() + (size_t)i * stride + counts[i],
+                  this->neighbours.begin() + this->offsets[i]);
+    }
+}
+
+bool NeighbourLists::load(const std::string& fileName,
+                          const uint32_t     cityCount)
+{
+    uint32_t i;
+    uint64_t header[2];
+    uint32_t sizes[4];
+
+    std::ifstream file(fileName, std::ifstream::in | std::ifstream::binary);
+
+    if(!file.good())
+    {
+        return false;
+    }
+
+    /* Magic, hash, city count, list sizes and total entries */
+    file.read((char*)header, sizeof(header));
+    file.read((char*)sizes, sizeof(sizes));
+    if(!file.good() || header[0] != NEIGHBOUR_LISTS_MAGIC ||
+       header[1] != this->hash || sizes[0] != cityCount ||
+       sizes[1] != this->nearestCount || sizes[2] != this->quadrantCount ||
+       sizes[3] > (uint64_t)cityCount *
+                  (this->nearestCount +
+                   SPATIAL_GRID_QUADRANTS * this->quadrantCount))
+    {
+        return false;
+    }
+
+    this->offsets.resize(cityCount + 1);
+    this->neighbours.resize(sizes[3]);
+    file.read((char*)this->offsets.data(),
+              this->offsets.size() * sizeof(uint32_t));
+    file.read((char*)this->neighbours.data(),
+              this->neighbours.size() * sizeof(uint32_t));
+    if(!file.good() || file.peek() != std::ifstream::traits_type::eof())
+    {
+        return false;
+    }
+
+    /* Reject a corrupted file instead of reading out of the arrays */
+    if(this->offsets[0] != 0 || this->offsets[cityCount] != sizes[3])
+    {
+        return false;
+    }
+    for(i = 0; i < cityCount; ++i)
+    {
+        if(this->offsets[i] > this->offsets[i + 1])
+        {
+            return false;
+        }
+    }
+    for(i = 0; i < this->neighbours.size(); ++i)
+    {
+        if(this->neighbours[i] >= cityCount)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool NeighbourLists::save(const std::string& fileName) const
+{
+    uint64_t    header[2];
+    uint32_t    sizes[4];
+    std::string temporary;
+
+    header[0] = NEIGHBOUR_LISTS_MAGIC;
+    header[1] = this->hash;
+    sizes[0]  = this->offsets.size() - 1;
+    sizes[1]  = this->nearestCount;
+    sizes[2]  = this->quadrantCount;
+    sizes[3]  = this->neighbours.size();
+
+    temporary = fileName + ".tmp";
+    std::ofstream file(temporary, std::ofstream::out |
+                                  std::ofstream::binary |
+                                  std::ofstream::trunc);
+    if(!file.good())
+    {
+        return false;
+    }
+
+    file.write((const char*)header, sizeof(header));
+    file.write((const char*)sizes, sizeof(sizes));
+    file.write((const char*)this->offsets.data(),
+               this->offsets.size() * sizeof(uint32_t));
+    file.write((const char*)this->neighbours.data(),
+               this->neighbours.size() * sizeof(uint32_t));
+    file.close();
+
+    if(!file.good() || std::rename(temporary.c_str(), fileName.c_str()) != 0)
+    {
+        std::remove(temporary.c_str());
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,555 @@
+/*******************************************************************************
+ * File: SpatialGrid.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Uniform grid over the cities coordinates. The grid answers nearest city
+ * queries among the cities not removed yet, which lets the greedy solver
+ * build a nearest neighbour tour without scanning every city at each step.
+ ******************************************************************************/
+
+#include <cstdint>   /* Generic int types */
+#include <cstddef>   /* size_t */
+#include <vector>    /* std::vector */
+#include <cmath>     /* std::sqrt */
+#include <algorithm> /* std::min, std::max */
+#include <limits>    /* std::numeric_limits */
+#include <utility>   /* std::pair */
+
+#include <solver/Solver.h>           /* city_t */
+#include <solver/AlignedAllocator.h> /* coordinates_t */
+
+/* Header file */
+#include <solver/SpatialGrid.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+SpatialGrid::SpatialGrid(const std::vector<city_t>& cities)
+{
+    uint32_t i;
+    uint32_t cell;
+    double   maxX;
+    double   maxY;
+    double   width;
+    double   height;
+
+    this->x.resize(cities.size());
+    this->y.resize(cities.size());
+    this->minX = 0;
+    this->minY = 0;
+    maxX       = 0;
+    maxY       = 0;
+    for(i = 0; i < cities.size(); ++i)
+    {
+        this->x[i] = cities[i].x;
+        this->y[i] = cities[i].y;
+        if(i == 0 || cities[i].x < this->minX)
+        {
+            this->minX = cities[i].x;
+        }
+        if(i == 0 || cities[i].y < this->minY)
+        {
+            this->minY = cities[i].y;
+        }
+        if(i == 0 || cities[i].x > maxX)
+        {
+            maxX = cities[i].x;
+        }
+        if(i == 0 || cities[i].y > maxY)
+        {
+            maxY = cities[i].y;
+        }
+    }
+
+    /* Square cells holding SPATIAL_GRID_CITIES_PER_CELL cities on average,
+     * a flat set of cities is given a unit height */
+    width  = std::max(maxX - this->minX, 1e-9);
+    height = std::max(maxY - this->minY, 1e-9);
+    this->cellSize = std::sqrt(width * height * SPATIAL_GRID_CITIES_PER_CELL /
+                               std::max(cities.size(), (size_t)1));
+    this->cellSize = std::max(this->cellSize,
+                              std::max(width, height) /
+                              std::max(cities.size(), (size_t)1));
+    this->columns = std::min((size_t)(width / this->cellSize) + 1,
+                             cities.size() + 1);
+    this->rows    = std::min((size_t)(height / this->cellSize) + 1,
+                             cities.size() + 1);
+
+    /* Counting sort of the cities by cell */
+    this->cellStart.assign((size_t)this->columns * this->rows + 1, 0);
+    this->cellCount.assign((size_t)this->columns * this->rows, 0);
+    this->rowCount.assign(this->rows, 0);
+    this->cityCell.resize(cities.size());
+    for(i = 0; i < cities.size(); ++i)
+    {
+        cell = getRow(this->y[i]) * this->columns + getColumn(this->x[i]);
+        this->cityCell[i] = cell;
+        ++this->cellCount[cell];
+        ++this->rowCount[cell / this->columns];
+    }
+    for(i = 0; i < this->cellCount.size(); ++i)
+    {
+        this->cellStart[i + 1] = this->cellStart[i] + this->cellCount[i];
+    }
+
+    this->cellCities.resize(cities.size());
+    this->cityEntry.resize(cities.size());
+    this->remaining.resize(cities.size());
+    this->remainingEntry.resize(cities.size());
+    std::fill(this->cellCount.begin(), this->cellCount.end(), 0);
+    for(i = 0; i < cities.size(); ++i)
+    {
+        cell = this->cityCell[i];
+        this->cityEntry[i] = this->cellStart[cell] + this->cellCount[cell]++;
+        this->cellCities[this->cityEntry[i]] = i;
+        this->remaining[i]      = i;
+        this->remainingEntry[i] = i;
+    }
+}
+
+SpatialGrid::~SpatialGrid(void)
+{
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+void SpatialGrid::remove(const uint32_t city)
+{
+    uint32_t cell;
+    uint32_t last;
+    uint32_t moved;
+
+    /* Swap with the last remaining city of the cell */
+    cell  = this->cityCell[city];
+    last  = this->cellStart[cell] + --this->cellCount[cell];
+    moved = this->cellCities[last];
+    this->cellCities[this->cityEntry[city]] = moved;
+    this->cityEntry[moved] = this->cityEntry[city];
+    this->cellCities[last] = city;
+    this->cityEntry[city]  = last;
+    --this->rowCount[cell / this->columns];
+
+    /* Swap with the last remaining city */
+    moved = this->remaining.back();
+    this->remaining[this->remainingEntry[city]] = moved;
+    this->remainingEntry[moved] = this->remainingEntry[city];
+    this->remaining.pop_back();
+}
+
+uint32_t SpatialGrid::getNearest(const double px, const double py) const
+{
+    uint32_t i;
+    uint32_t ring;
+    uint32_t column;
+    uint32_t row;
+    uint32_t scanned;
+    int64_t  first;
+    int64_t  last;
+    int64_t  top;
+    int64_t  bottom;
+    int64_t  current;
+    uint32_t best;
+    double   bestDistance;
+    double   bound;
+
+    best         = SPATIAL_GRID_NONE;
+    bestDistance = std::numeric_limits<double>::max();
+    if(this->remaining.empty())
+    {
+        return best;
+    }
+
+    column  = getColumn(px);
+    row     = getRow(py);
+    scanned = 0;
+    for(ring = 0; ; ++ring)
+    {
+        first  = (int64_t)column - ring;
+        last   = (int64_t)column + ring;
+        bottom = (int64_t)row - ring;
+        top    = (int64_t)row + ring;
+
+        /* The ring is outside the block of cells already scanned, stop when
+         * it cannot hold a closer city */
+        if(best != SPATIAL_GRID_NONE)
+        {
+            bound = std::numeric_limits<double>::max();
+            if(first >= 0)
+            {
+                bound = std::min(bound, px - (this->minX +
+                                              (first + 1) * this->cellSize));
+            }
+            if(last < this->columns)
+            {
+                bound = std::min(bound,
+                                 this->minX + last * this->cellSize - px);
+            }
+            if(bottom >= 0)
+            {
+                bound = std::min(bound, py - (this->minY +
+                                              (bottom + 1) * this->cellSize));
+            }
+            if(top < this->rows)
+            {
+                bound = std::min(bound,
+                                 this->minY + top * this->cellSize - py);
+            }
+            if(bound > 0 && bound * bound > bestDistance)
+            {
+                return best;
+            }
+        }
+        if(first < 0 && last >= this->columns &&
+           bottom < 0 && top >= this->rows)
+        {
+            return best;
+        }
+
+        /* Sparse cities, the remaining list is shorter than the cells */
+        if(scanned > this->remaining.size())
+        {
+            for(i = 0; i < this->remaining.size(); ++i)
+            {
+                scanCity(this->remaining[i], px, py, best, bestDistance);
+            }
+            return best;
+        }
+
+        for(current = std::max(bottom, (int64_t)0);
+            current <= std::min(top, (int64_t)this->rows - 1);
+            ++current)
+        {
+            if(this->rowCount[current] == 0)
+            {
+                continue;
+            }
+            if(current == bottom || current == top)
+            {
+                /* Full row of the ring */
+                for(i = std::max(first, (int64_t)0);
+                    i <= std::min(last, (int64_t)this->columns - 1);
+                    ++i)
+                {
+                    scanCell(current * this->columns + i, px, py, best,
+                             bestDistance);
+                    ++scanned;
+                }
+            }
+            else
+            {
+                /* Sides of the ring */
+                if(first >= 0)
+                {
+                    scanCell(current * this->columns + first, px, py, best,
+                             bestDistance);
+                    ++scanned;
+                }
+                if(last < this->columns && last != first)
+                {
+                    scanCell(current * this->columns + last, px, py, best,
+                             bestDistance);
+                    ++scanned;
+                }
+            }
+        }
+    }
+}
+
+uint32_t SpatialGrid::getNeighbours(const uint32_t city,
+                                   const uint32_t nearestCount,
+                                   const uint32_t quadrantCount,
+                                   uint32_t*      neighbours) const
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+    uint32_t ring;
+    uint32_t column;
+    uint32_t row;
+    uint32_t quadrant;
+    uint32_t count;
+    uint32_t candidate;
+    int64_t  first;
+    int64_t  last;
+    int64_t  top;
+    int64_t  bottom;
+    int64_t  from;
+    int64_t  to;
+    int64_t  current;
+    double   px;
+    double   py;
+    double   dx;
+    double   dy;
+    double   distance;
+    double   bound;
+    bool     active[SPATIAL_GRID_QUADRANTS];
+    bool     nearestActive;
+    bool     any;
+
+    /* Quadrants: north east, north west, south west, south east */
+    std::vector<std::pair<double, uint32_t>> nearest;
+    std::vector<std::pair<double, uint32_t>>
+        quadrants[SPATIAL_GRID_QUADRANTS];
+    std::vector<std::pair<double, uint32_t>> merged;
+
+    /* Cells to scan on each side of a ring: from and to bounds of the top
+     * row, bottom row, left column and right column */
+    int64_t sides[4][2];
+
+    px     = this->x[city];
+    py     = this->y[city];
+    column = getColumn(px);
+    row    = getRow(py);
+    for(ring = 0; ; ++ring)
+    {
+        first  = (int64_t)column - ring;
+        last   = (int64_t)column + ring;
+        bottom = (int64_t)row - ring;
+        top    = (int64_t)row + ring;
+
+        /* Distance to the cells not scanned yet */
+        bound = std::numeric_limits<double>::max();
+        if(first >= 0)
+        {
+            bound = std::min(bound, px - (this->minX +
+                                          (first + 1) * this->cellSize));
+        }
+        if(last < this->columns)
+        {
+            bound = std::min(bound, this->minX + last * this->cellSize - px);
+        }
+        if(bottom >= 0)
+        {
+            bound = std::min(bound, py - (this->minY +
+                                          (bottom + 1) * this->cellSize));
+        }
+        if(top < this->rows)
+        {
+            bound = std::min(bound, this->minY + top * this->cellSize - py);
+        }
+        bound = bound > 0 ? bound * bound : 0;
+
+        /* A list is done when it is full and the next ring is farther than
+         * its last candidate, a quadrant is also done when the ring left
+         * the grid on its two sides */
+        nearestActive = nearestCount > 0 &&
+                        (nearest.size() < nearestCount ||
+                         nearest.back().first >= bound) &&
+                        (first >= 0 || last < this->columns ||
+                         bottom >= 0 || top < this->rows);
+        any = nearestActive;
+        for(quadrant = 0; quadrant < SPATIAL_GRID_QUADRANTS; ++quadrant)
+        {
+            active[quadrant] = quadrantCount > 0 &&
+                               (quadrants[quadrant].size() < quadrantCount ||
+                                quadrants[quadrant].back().first >= bound) &&
+                               (ring == 0 ||
+                                (quadrant < 2 ? top < this->rows :
+                                                bottom >= 0) ||
+                                (quadrant == 0 || quadrant == 3 ?
+                                 last < this->columns : first >= 0));
+            any = any || active[quadrant];
+        }
+        if(!any)
+        {
+            break;
+        }
+        if(nearestActive)
+        {
+            for(quadrant = 0; quadrant < SPATIAL_GRID_QUADRANTS; ++quadrant)
+            {
+                active[quadrant] = true;
+            }
+        }
+
+        /* Top and bottom rows, then the columns between them */
+        sides[0][0] = active[1] ? first : column;
+        sides[0][1] = active[0] ? last : column;
+        sides[1][0] = active[2] ? first : column;
+        sides[1][1] = active[3] ? last : column;
+        sides[2][0] = active[2] ? bottom + 1 : row;
+        sides[2][1] = active[1] ? top - 1 : row;
+        sides[3][0] = active[3] ? bottom + 1 : row;
+        sides[3][1] = active[0] ? top - 1 : row;
+        for(i = 0; i < 4; ++i)
+        {
+            /* The single cell of the first ring is the top row */
+            if(ring == 0 && i != 0)
+            {
+                break;
+            }
+            if((i == 0 && !active[0] && !active[1]) ||
+               (i == 1 && !active[2] && !active[3]) ||
+               (i == 2 && !active[1] && !active[2]) ||
+               (i == 3 && !active[0] && !active[3]))
+            {
+                continue;
+            }
+
+            for(current = sides[i][0]; current <= sides[i][1]; ++current)
+            {
+                /* Row and column of the cell */
+                from = i < 2 ? current : (i == 2 ? first : last);
+                to   = i < 2 ? (i == 0 ? top : bottom) : current;
+                if(from < 0 || from >= this->columns ||
+                   to < 0 || to >= this->rows)
+                {
+                    continue;
+                }
+                if(i >= 2 && (to == top || to == bottom))
+                {
+                    continue;
+                }
+
+                k = to * this->columns + from;
+                for(j = this->cellStart[k];
+                    j < this->cellStart[k] + this->cellCount[k];
+                    ++j)
+                {
+                    candidate = this->cellCities[j];
+                    if(candidate == city)
+                    {
+                        continue;
+                    }
+                    dx       = this->x[candidate] - px;
+                    dy       = this->y[candidate] - py;
+                    distance = dx * dx + dy * dy;
+                    if(nearestCount > 0)
+                    {
+                        insertCandidate(nearest, nearestCount, distance,
+                                        candidate);
+                    }
+                    if(quadrantCount > 0)
+                    {
+                        quadrant = dy >= 0 ? (dx >= 0 ? 0 : 1) :
+                                             (dx >= 0 ? 3 : 2);
+                        insertCandidate(quadrants[quadrant], quadrantCount,
+                                        distance, candidate);
+                    }
+                }
+            }
+        }
+    }
+
+    /* Union of the lists */
+    merged = nearest;
+    for(quadrant = 0; quadrant < SPATIAL_GRID_QUADRANTS; ++quadrant)
+    {
+        merged.insert(merged.end(), quadrants[quadrant].begin(),
+                      quadrants[quadrant].end());
+    }
+    std::sort(merged.begin(), merged.end());
+
+    count = 0;
+    for(i = 0; i < merged.size(); ++i)
+    {
+        if(count == 0 || neighbours[count - 1] != merged[i].second)
+        {
+            neighbours[count++] = merged[i].second;
+        }
+    }
+
+    return count;
+}
+
+uint32_t SpatialGrid::getCount(void) const
+{
+    return this->remaining.size();
+}
+
+size_t SpatialGrid::getMemoryFootprint(void) const
+{
+    return (this->x.capacity() + this->y.capacity()) * sizeof(double) +
+           (this->cellStart.capacity() + this->cellCount.capacity() +
+            this->rowCount.capacity() + this->cellCities.capacity() +
+            this->cityCell.capacity() + this->cityEntry.capacity() +
+            this->remaining.capacity() + this->remainingEntry.capacity()) *
+           sizeof(uint32_t);
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+uint32_t SpatialGrid::getColumn(const double position) const
+{
+    if(position <= this->minX)
+    {
+        return 0;
+    }
+    return std::min((uint64_t)((position - this->minX) / this->cellSize),
+                    (uint64_t)this->columns - 1);
+}
+
+uint32_t SpatialGrid::getRow(const double position) const
+{
+    if(position <= this->minY)
+    {
+        return 0;
+    }
+    return std::min((uint64_t)((position - this->minY) / this->cellSize),
+                    (uint64_t)this->rows - 1);
+}
+
+void SpatialGrid::scanCell(const uint32_t cell,
+                           const double   px,
+                           const double   py,
+                           uint32_t&      best,
+                           double&        bestDistance) const
+{
+    uint32_t i;
+    uint32_t end;
+
+    end = this->cellStart[cell] + this->cellCount[cell];
+    for(i = this->cellStart[cell]; i < end; ++i)
+    {
+        scanCity(this->cellCities[i], px, py, best, bestDistance);
+    }
+}
+
+void SpatialGrid::scanCity(const uint32_t city,
+                           const double   px,
+                           const double   py,
+                           uint32_t&      best,
+                           double&        bestDistance) const
+{
+    double dx;
+    double dy;
+    double distance;
+
+    dx       = this->x[city] - px;
+    dy       = this->y[city] - py;
+    distance = dx * dx + dy * dy;
+    if(distance < bestDistance ||
+       (distance == bestDistance && city < best))
+    {
+        bestDistance = distance;
+        best         = city;
+    }
+}
+
+void SpatialGrid::insertCandidate(
+                            std::vector<std::pair<double, uint32_t>>& list,
+                            const uint32_t                            capacity,
+                            const double                              distance,
+                            const uint32_t                            city)
+{
+    std::pair<double, uint32_t> entry(distance, city);
+
+    if(list.size() == capacity && !(entry < list.back()))
+    {
+        return;
+    }
+    if(list.size() == capacity)
+    {
+        list.pop_back();
+    }
+    list.insert(std::upper_bound(list.begin(), list.end(), entry), entry);
+}
@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * File: ThreadPool.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Pool of worker threads running batches of independent tasks. The workers
+ * are created once and wait for the next batch, instead of being created for
+ * each parallel section.
+ ******************************************************************************/
+
+#include <cstdint>            /* Generic int types */
+#include <vector>             /* std::vector */
+#include <thread>             /* std::thread */
+#include <mutex>              /* std::mutex, std::unique_lock */
+#include <condition_variable> /* std::condition_variable */
+#include <functional>         /* std::function */
+
+/* Header file */
+#include <solver/ThreadPool.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+ThreadPool::ThreadPool(void): ThreadPool(0)
+{
+}
+
+ThreadPool::ThreadPool(const uint32_t threadCount)
+{
+    uint32_t i;
+    uint32_t count;
+
+    this->batch       = 0;
+    this->activeCount = 0;
+    this->stopping    = false;
+    this->task        = nullptr;
+    this->taskCount   = 0;
+    this->nextTask.store(0);
+
+    count = threadCount;
+    if(count == 0)
+    {
+        count = std::thread::hardware_concurrency();
+    }
+
+    /* The calling thread is one of the threads */
+    for(i = 1; i < count; ++i)
+    {
+        this->workers.push_back(std::thread(&ThreadPool::workerThread, this));
+    }
+}
+
+ThreadPool::~ThreadPool(void)
+{
+    uint32_t i;
+
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->stopping = true;
+    }
+    this->startSignal.notify_all();
+
+    for(i = 0; i < this->workers.size(); ++i)
+    {
+        this->workers[i].join();
+    }
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+uint32_t ThreadPool::getThreadCount(void) const
+{
+    return this->workers.size() + 1;
+}
+
+void ThreadPool::run(const uint32_t                             count,
+                     const std::function<void(const uint32_t)>& routine)
+{
+    if(count == 0)
+    {
+        return;
+    }
+
+    /* Publish the batch */
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->task        = &routine;
+        this->taskCount   = count;
+        this->activeCount = this->workers.size();
+        this->nextTask.store(0);
+        ++this->batch;
+    }
+    this->startSignal.notify_all();
+
+    /* Take part in the batch, then wait for the workers */
+    runTasks();
+
+    std::unique_lock<std::mutex> guard(this->lock);
+    while(this->activeCount != 0)
+    {
+        this->doneSignal.wait(guard);
+    }
+    this->task = nullptr;
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+void ThreadPool::runTasks(void)
+{
+    uint32_t index;
+
+    index = this->nextTask.fetch_add(1);
+    while(index < this->taskCount)
+    {
+        (*this->task)(index);
+        index = this->nextTask.fetch_add(1);
+    }
+}
+
+void ThreadPool::workerThread(void)
+{
+    uint64_t seenBatch;
+
+    seenBatch = 0;
+    while(true)
+    {
+        {
+            std::unique_lock<std::mutex> guard(this->lock);
+            while(!this->stopping && this->batch == seenBatch)
+            {
+                this->startSignal.wait(guard);
+            }
+            if(this->stopping)
+            {
+                return;
+            }
+            seenBatch = this->batch;
+        }
+
+        runTasks();
+
+        {
+            std::lock_guard<std::mutex> guard(this->lock);
+            --this->activeCount;
+        }
+        this->doneSignal.notify_one();
+    }
+}
@@ -0,0 +1,54 @@
+/*******************************************************************************
+ * File: Tour.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Tour interface. This class defines the API used by the local search moves
+ * to walk and modify a tour, whatever the tour representation is.
+ ******************************************************************************/
+
+#include <cstdint> /* Generic int types */
+#include <vector>  /* std::vector */
+
+/* Header file */
+#include <solver/Tour.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+void Tour::exchange(const uint32_t a,
+                    const uint32_t b,
+                    const uint32_t c,
+                    const uint32_t d)
+{
+    /* a b ... c d becomes a c ... b d */
+    if(getNext(a) == b)
+    {
+        reverse(b, c);
+    }
+    else
+    {
+        reverse(a, d);
+    }
+}
+
+void Tour::getOrder(std::vector<uint32_t>& order) const
+{
+    uint32_t i;
+    uint32_t city;
+
+    order.resize(getCityCount());
+
+    city = 0;
+    for(i = 0; i < order.size(); ++i)
+    {
+        order[i] = city;
+        city     = getNext(city);
+    }
+}
@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * File: TriangularDistanceProvider.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * TriangularDistanceProvider implements the DistanceProvider class. The
+ * distances are stored once per pair of cities in single precision, in the
+ * lower triangle of the distance matrix.
+ ******************************************************************************/
+
+#include <cstdint>   /* Generic int types */
+#include <cstddef>   /* size_t */
+#include <vector>    /* std::vector */
+#include <utility>   /* std::pair */
+#include <algorithm> /* std::min */
+
+#include <solver/Solver.h>            /* city_t */
+#include <solver/HugePageAllocator.h> /* nsSolver::HugePageAllocator */
+#include <solver/DistanceOracle.h>    /* nsSolver::DistanceOracle */
+#include <solver/ThreadPool.h>        /* nsSolver::ThreadPool */
+
+/* Header file */
+#include <solver/TriangularDistanceProvider.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+TriangularDistanceProvider::TriangularDistanceProvider(
+                                        const std::vector<city_t>& cities,
+                                        const HugePageMode         hugePages):
+    oracle(cities)
+{
+    this->cityCount = 0;
+    this->allocator = new HugePageAllocator(hugePages);
+    this->distances = nullptr;
+
+    build();
+}
+
+TriangularDistanceProvider::~TriangularDistanceProvider(void)
+{
+    /* The matrix is released with the allocator */
+    delete this->allocator;
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+double TriangularDistanceProvider::getDistance(const uint32_t from,
+                                               const uint32_t to) const
+{
+    if(from > to)
+    {
+        return this->distances[(size_t)from * (from - 1) / 2 + to];
+    }
+    if(to > from)
+    {
+        return this->distances[(size_t)to * (to - 1) / 2 + from];
+    }
+    return 0;
+}
+
+uint32_t TriangularDistanceProvider::getCityCount(void) const
+{
+    return this->cityCount;
+}
+
+size_t TriangularDistanceProvider::getMemoryFootprint(void) const
+{
+    return getMatrixSize() + this->oracle.getMemoryFootprint();
+}
+
+const char* TriangularDistanceProvider::getName(void) const
+{
+    return "triangular";
+}
+
+bool TriangularDistanceProvider::rebuild(const std::vector<city_t>& cities)
+{
+    if(this->oracle.hasCities(cities))
+    {
+        return false;
+    }
+
+    this->oracle = DistanceOracle(cities);
+    build();
+
+    return true;
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+size_t TriangularDistanceProvider::getMatrixSize(void) const
+{
+    if(this->cityCount < 2)
+    {
+        return 0;
+    }
+    return (size_t)this->cityCount * (this->cityCount - 1) / 2 *
+           sizeof(float);
+}
+
+void TriangularDistanceProvider::build(void)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t tileCount;
+
+    std::vector<std::pair<uint32_t, uint32_t>> tiles;
+
+    /* Keep the buffer when the size did not change */
+    if(this->oracle.getCityCount() != this->cityCount)
+    {
+        this->allocator->release(this->distances);
+        this->cityCount = this->oracle.getCityCount();
+        this->distances = (float*)this->allocator->allocate(getMatrixSize());
+    }
+
+    tileCount = (this->cityCount + DISTANCE_TILE_SIZE - 1) /
+                DISTANCE_TILE_SIZE;
+    for(i = 0; i < tileCount; ++i)
+    {
+        for(j = 0; j <= i; ++j)
+        {
+            tiles.push_back(std::make_pair(i, j));
+        }
+    }
+
+    this->pool.run(tiles.size(), [this, &tiles](const uint32_t index)
+    {
+        buildTile(tiles[index].first, tiles[index].second);
+    });
+}
+
+void TriangularDistanceProvider::buildTile(const uint32_t rowTile,
+                                           const uint32_t columnTile)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t rowEnd;
+    uint32_t columnStart;
+    uint32_t end;
+    float*   row;
+    double   line[DISTANCE_TILE_SIZE];
+
+    rowEnd      = std::min((rowTile + 1) * DISTANCE_TILE_SIZE,
+                           this->cityCount);
+    columnStart = columnTile * DISTANCE_TILE_SIZE;
+
+    for(i = rowTile * DISTANCE_TILE_SIZE; i < rowEnd; ++i)
+    {
+        /* Below the diagonal only */
+        end = std::min(columnStart + DISTANCE_TILE_SIZE, i);
+        if(columnStart >= end)
+        {
+            continue;
+        }
+
+        row = this->distances + (size_t)i * (i - 1) / 2;
+        this->oracle.getDistances(i, columnStart, end, line);
+        for(j = columnStart; j < end; ++j)
+        {
+            row[j] = line[j - columnStart];
+        }
+    }
+}
@@ -0,0 +1,434 @@
+/*******************************************************************************
+ * File: TwoLevelListTour.cpp
+ *
+ * Author: Alexy Torres Aurora Dugo
+ *
+ * Date: 19/10/2026
+ *
+ * Version: 1.0
+ *
+ * Two-level list tour, implements the Tour interface with segments of about
+ * sqrt(N) cities that can be reversed as a whole. A reversal costs O(sqrt(N))
+ * instead of O(N) for the array tour.
+ ******************************************************************************/
+
+#include <cstdint>   /* Generic int types */
+#include <vector>    /* std::vector */
+#include <cmath>     /* std::sqrt */
+#include <algorithm> /* std::max, std::min, std::copy, std::reverse_copy */
+#include <utility>   /* std::swap */
+
+#include <solver/Tour.h> /* nsSolver::Tour */
+
+/* Header file */
+#include <solver/TwoLevelListTour.h>
+
+using namespace nsSolver; /* Solver's namespace */
+
+/*******************************************************************************
+ * Constructors / Destructors
+ ******************************************************************************/
+TwoLevelListTour::TwoLevelListTour(const std::vector<uint32_t>& order)
+{
+    uint32_t balancedCount;
+
+    this->groupSize    = std::max<uint32_t>(1, std::sqrt(order.size()));
+    balancedCount      = (order.size() + this->groupSize - 1) /
+                         this->groupSize;
+    this->rebuildCount = 0;
+
+    /* A reversal adds at most two segments */
+    this->segments.resize(TWO_LEVEL_LIST_SEGMENT_FACTOR * balancedCount + 2);
+    this->slots.resize(this->segments.size() * this->groupSize);
+    this->positions.resize(order.size());
+    this->order.resize(order.size());
+    this->path.resize(this->segments.size());
+
+    build(order);
+}
+
+TwoLevelListTour::~TwoLevelListTour(void)
+{
+}
+
+/*******************************************************************************
+ * Public methods
+ ******************************************************************************/
+uint32_t TwoLevelListTour::getNext(const uint32_t city) const
+{
+    const tour_position_t& position = this->positions[city];
+    const tour_segment_t*  segment  = &this->segments[position.segment];
+
+    if(!segment->reversed && position.index + 1 < segment->size)
+    {
+        return this->slots[segment->start + position.index + 1];
+    }
+    if(segment->reversed && position.index > 0)
+    {
+        return this->slots[segment->start + position.index - 1];
+    }
+
+    /* First city of the next segment */
+    segment = &this->segments[segment->next];
+
+    return this->slots[segment->start +
+                       (segment->reversed ? segment->size - 1 : 0)];
+}
+
+uint32_t TwoLevelListTour::getPrev(const uint32_t city) const
+{
+    const tour_position_t& position = this->positions[city];
+    const tour_segment_t*  segment  = &this->segments[position.segment];
+
+    if(segment->reversed && position.index + 1 < segment->size)
+    {
+        return this->slots[segment->start + position.index + 1];
+    }
+    if(!segment->reversed && position.index > 0)
+    {
+        return this->slots[segment->start + position.index - 1];
+    }
+
+    /* Last city of the previous segment */
+    segment = &this->segments[segment->prev];
+
+    return this->slots[segment->start +
+                       (segment->reversed ? 0 : segment->size - 1)];
+}
+
+bool TwoLevelListTour::isBetween(const uint32_t from,
+                                 const uint32_t city,
+                                 const uint32_t to) const
+{
+    uint64_t first;
+    uint64_t middle;
+    uint64_t last;
+
+    /* Order of the segment then order in the segment */
+    first  = ((uint64_t)this->segments[this->positions[from].segment].rank <<
+              32) | getIndex(from);
+    middle = ((uint64_t)this->segments[this->positions[city].segment].rank <<
+              32) | getIndex(city);
+    last   = ((uint64_t)this->segments[this->positions[to].segment].rank <<
+              32) | getIndex(to);
+
+    if(first <= last)
+    {
+        return first <= middle && middle <= last;
+    }
+
+    return middle >= first || middle <= last;
+}
+
+void TwoLevelListTour::reverse(const uint32_t from, const uint32_t to)
+{
+    uint32_t first;
+    uint32_t last;
+    uint32_t length;
+
+    if(from == to)
+    {
+        return;
+    }
+
+    first = getIndex(from);
+    last  = getIndex(to);
+    if(this->positions[from].segment == this->positions[to].segment)
+    {
+        if(first <= last)
+        {
+            reverseCities(from, to, last - first + 1);
+        }
+        else if(first - last > 1)
+        {
+            /* The rest of the tour is inside the segment */
+            reverseCities(getNext(to), getPrev(from), first - last - 1);
+        }
+        return;
+    }
+
+    /* A short path over two segments is cheaper to swap than to split */
+    if(this->segments[this->positions[from].segment].next ==
+       this->positions[to].segment)
+    {
+        length = this->segments[this->positions[from].segment].size - first +
+                 last + 1;
+        if(length <= this->groupSize)
+        {
+            reverseCities(from, to, length);
+            return;
+        }
+    }
+
+    if(this->segmentCount + 2 > this->segments.size())
+    {
+        rebuild();
+    }
+
+    /* The path becomes a sequence of whole segments */
+    splitBefore(from);
+    if(this->positions[to].segment == this->positions[getNext(to)].segment)
+    {
+        splitBefore(getNext(to));
+    }
+    reverseSegments(this->positions[from].segment,
+                    this->positions[to].segment);
+}
+
+uint32_t TwoLevelListTour::getCityCount(void) const
+{
+    return this->positions.size();
+}
+
+uint32_t TwoLevelListTour::getSegmentCount(void) const
+{
+    return this->segmentCount;
+}
+
+uint64_t TwoLevelListTour::getRebuildCount(void) const
+{
+    return this->rebuildCount;
+}
+
+/*******************************************************************************
+ * Private methods
+ ******************************************************************************/
+void TwoLevelListTour::build(const std::vector<uint32_t>& order)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t city;
+
+    this->segmentCount = (order.size() + this->groupSize - 1) /
+                         this->groupSize;
+    for(i = 0; i < this->segmentCount; ++i)
+    {
+        tour_segment_t& segment = this->segments[i];
+
+        segment.start    = i * this->groupSize;
+        segment.size     = std::min<uint32_t>(this->groupSize,
+                                              order.size() - segment.start);
+        segment.next     = i + 1 == this->segmentCount ? 0 : i + 1;
+        segment.prev     = i == 0 ? this->segmentCount - 1 : i - 1;
+        segment.rank     = i;
+        segment.reversed = false;
+
+        for(j = 0; j < segment.size; ++j)
+        {
+            city = order[segment.start + j];
+
+            this->slots[segment.start + j] = city;
+            this->positions[city].segment  = i;
+            this->positions[city].index    = j;
+        }
+    }
+}
+
+void TwoLevelListTour::rebuild(void)
+{
+    uint32_t i;
+    uint32_t segment;
+    uint32_t size;
+
+    /* Copy the segments in the order of the tour */
+    size    = 0;
+    segment = 0;
+    for(i = 0; i < this->segmentCount; ++i)
+    {
+        const tour_segment_t& current = this->segments[segment];
+
+        if(current.reversed)
+        {
+            std::reverse_copy(this->slots.begin() + current.start,
+                              this->slots.begin() + current.start +
+                              current.size,
+                              this->order.begin() + size);
+        }
+        else
+        {
+            std::copy(this->slots.begin() + current.start,
+                      this->slots.begin() + current.start + current.size,
+                      this->order.begin() + size);
+        }
+        size   += current.size;
+        segment = current.next;
+    }
+
+    build(this->order);
+    ++this->rebuildCount;
+}
+
+uint32_t TwoLevelListTour::getIndex(const uint32_t city) const
+{
+    const tour_position_t& position = this->positions[city];
+    const tour_segment_t&  segment  = this->segments[position.segment];
+
+    return segment.reversed ? segment.size - 1 - position.index :
+                              position.index;
+}
+
+void TwoLevelListTour::stepForward(tour_position_t& position) const
+{
+    const tour_segment_t& segment = this->segments[position.segment];
+
+    if(!segment.reversed && position.index + 1 < segment.size)
+    {
+        ++position.index;
+    }
+    else if(segment.reversed && position.index > 0)
+    {
+        --position.index;
+    }
+    else
+    {
+        position.segment = segment.next;
+        position.index   = this->segments[segment.next].reversed ?
+                           this->segments[segment.next].size - 1 : 0;
+    }
+}
+
+void TwoLevelListTour::stepBackward(tour_position_t& position) const
+{
+    const tour_segment_t& segment = this->segments[position.segment];
+
+    if(segment.reversed && position.index + 1 < segment.size)
+    {
+        ++position.index;
+    }
+    else if(!segment.reversed && position.index > 0)
+    {
+        --position.index;
+    }
+    else
+    {
+        position.segment = segment.prev;
+        position.index   = this->segments[segment.prev].reversed ?
+                           0 : this->segments[segment.prev].size - 1;
+    }
+}
+
+void TwoLevelListTour::splitBefore(const uint32_t city)
+{
+    uint32_t        i;
+    uint32_t        cut;
+    uint32_t        added;
+    uint32_t        before;
+    uint32_t        segment;
+    tour_segment_t* source;
+    tour_segment_t* target;
+
+    if(getIndex(city) == 0)
+    {
+        return;
+    }
+
+    /* The slots after the cut move to the new segment, which follows the
+     * segment in the tour, or precedes it when the segment is reversed */
+    segment = this->positions[city].segment;
+    added   = this->segmentCount++;
+    source  = &this->segments[segment];
+    target  = &this->segments[added];
+    cut     = source->reversed ? this->positions[city].index + 1 :
+                                 this->positions[city].index;
+
+    target->start    = added * this->groupSize;
+    target->size     = source->size - cut;
+    target->reversed = source->reversed;
+    for(i = 0; i < target->size; ++i)
+    {
+        this->slots[target->start + i] = this->slots[source->start + cut + i];
+        this->positions[this->slots[target->start + i]].segment = added;
+        this->positions[this->slots[target->start + i]].index   = i;
+    }
+    source->size = cut;
+
+    before       = source->reversed ? source->prev : segment;
+    target->prev = before;
+    target->next = this->segments[before].next;
+    this->segments[target->next].prev = added;
+    this->segments[before].next       = added;
+
+    /* The segments after the new one are shifted up to the first one */
+    target->rank = this->segments[before].rank + 1;
+    for(i = target->next; this->segments[i].rank != 0;
+        i = this->segments[i].next)
+    {
+        ++this->segments[i].rank;
+    }
+}
+
+void TwoLevelListTour::reverseCities(const uint32_t from,
+                                     const uint32_t to,
+                                     const uint32_t length)
+{
+    uint32_t        count;
+    uint32_t        first;
+    uint32_t        last;
+    tour_position_t forward;
+    tour_position_t backward;
+
+    forward  = this->positions[from];
+    backward = this->positions[to];
+    for(count = length / 2; count > 0; --count)
+    {
+        first = this->segments[forward.segment].start + forward.index;
+        last  = this->segments[backward.segment].start + backward.index;
+
+        std::swap(this->slots[first], this->slots[last]);
+        this->positions[this->slots[first]] = forward;
+        this->positions[this->slots[last]]  = backward;
+
+        stepForward(forward);
+        stepBackward(backward);
+    }
+}
+
+void TwoLevelListTour::reverseSegments(const uint32_t first,
+                                       const uint32_t last)
+{
+    uint32_t i;
+    uint32_t count;
+    uint32_t rank;
+    uint32_t start;
+    uint32_t end;
+    uint32_t before;
+    uint32_t after;
+
+    count = (this->segments[last].rank + this->segmentCount -
+             this->segments[first].rank) % this->segmentCount + 1;
+    start = first;
+    end   = last;
+    if(2 * count > this->segmentCount)
+    {
+        /* Reversing the rest of the tour gives the same cycle */
+        count = this->segmentCount - count;
+        start = this->segments[last].next;
+        end   = this->segments[first].prev;
+    }
+    if(count == 0)
+    {
+        return;
+    }
+
+    before = this->segments[start].prev;
+    after  = this->segments[end].next;
+    rank   = this->segments[start].rank;
+    this->path[0] = start;
+    for(i = 1; i < count; ++i)
+    {
+        this->path[i] = this->segments[this->path[i - 1]].next;
+    }
+
+    /* before, path[count - 1], ..., path[0], after */
+    for(i = 0; i < count; ++i)
+    {
+        tour_segment_t& segment = this->segments[this->path[i]];
+
+        segment.reversed = !segment.reversed;
+        segment.rank     = (rank + count - 1 - i) % this->segmentCount;
+        segment.next     = i == 0 ? after : this->path[i - 1];
+        segment.prev     = i + 1 == count ? before : this->path[i + 1];
+    }
+    this->segments[before].next = this->path[count - 1];
+    this->segments[after].prev  = this->path[0];
+}
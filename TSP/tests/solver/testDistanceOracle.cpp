@@ -0,0 +1,157 @@
+#include <iostream>  /* std::cout, std::endl */
+#include <vector>    /* std::vector */
+#include <string>    /* std::string */
+#include <cmath>     /* std::fabs */
+#include <random>    /* std::mt19937 */
+#include <stdexcept> /* std::runtime_exception */
+
+#include "solver/DistanceOracle.h"
+
+using namespace nsSolver;
+
+/* Returns the nearest unvisited city by scanning every city */
+static uint32_t getScanNearest(const DistanceOracle&       oracle,
+                               const uint32_t              from,
+                               const std::vector<uint8_t>& visited)
+{
+    uint32_t j;
+    uint32_t best;
+
+    best = DISTANCE_ORACLE_NONE;
+    for(j = 0; j < oracle.getCityCount(); ++j)
+    {
+        if(!visited[j] && (best == DISTANCE_ORACLE_NONE ||
+                           oracle.getDistance(from, j) <
+                           oracle.getDistance(from, best)))
+        {
+            best = j;
+        }
+    }
+
+    return best;
+}
+
+/* Checks a scan kernel against the scan while the cities are visited in a
+ * random order */
+static void checkKernel(const std::vector<city_t>& cities,
+                        const ScanKernel           kernel)
+{
+    uint32_t i;
+    uint32_t from;
+
+    std::vector<uint8_t> visited(cities.size(), false);
+    std::mt19937         generator(cities.size());
+
+    DistanceOracle oracle(cities);
+
+    if(!oracle.setScanKernel(kernel))
+    {
+        return;
+    }
+    for(i = 0; i <= cities.size(); ++i)
+    {
+        from = generator() % cities.size();
+        if(oracle.getNearest(from, visited) !=
+           getScanNearest(oracle, from, visited))
+        {
+            throw std::runtime_error(
+                std::string("Wrong nearest city with the ") +
+                DistanceOracle::getScanKernelName(kernel) + " kernel");
+        }
+        visited[generator() % cities.size()] = true;
+        if(i % 7 == 0)
+        {
+            visited.assign(visited.size(), true);
+            visited[generator() % cities.size()] = false;
+            if(oracle.getNearest(from, visited) !=
+               getScanNearest(oracle, from, visited))
+            {
+                throw std::runtime_error("Wrong last unvisited city");
+            }
+            visited.assign(visited.size(), false);
+        }
+    }
+
+    visited.assign(visited.size(), true);
+    if(oracle.getNearest(0, visited) != DISTANCE_ORACLE_NONE)
+    {
+        throw std::runtime_error("Visited city returned");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    uint32_t i;
+    uint32_t count;
+    city_t   city;
+
+    std::vector<city_t> cities;
+    std::vector<city_t> randomCities;
+    std::mt19937        generator(0);
+    std::uniform_real_distribution<double> coordinate(0, 100);
+
+    /* Unit square plus a 3-4-5 triangle */
+    cities.push_back({0, 0.0, 0.0});
+    cities.push_back({1, 1.0, 0.0});
+    cities.push_back({2, 1.0, 1.0});
+    cities.push_back({3, 0.0, 1.0});
+    cities.push_back({4, 3.0, 4.0});
+
+    DistanceOracle oracle(cities);
+
+    if(oracle.getCityCount() != 5 ||
+       oracle.getMemoryFootprint() < 5 * 2 * sizeof(double))
+    {
+        throw std::runtime_error("Wrong oracle size");
+    }
+    if(oracle.getDistance(0, 0) != 0 || oracle.getDistance(0, 1) != 1 ||
+       oracle.getDistance(0, 4) != 5 ||
+       oracle.getDistance(4, 0) != oracle.getDistance(0, 4) ||
+       std::fabs(oracle.getDistance(0, 2) - std::sqrt(2.0)) > 1e-12)
+    {
+        throw std::runtime_error("Wrong distance");
+    }
+    if(oracle.getTourLength({0, 1, 2, 3}) != 4 ||
+       oracle.getTourLength({0, 4}) != 10 ||
+       oracle.getTourLength({2}) != 0 ||
+       oracle.getTourLength({}) != 0)
+    {
+        throw std::runtime_error("Wrong tour length");
+    }
+
+    /* Scan kernels, with tails and ties on a coarse grid */
+    if(DistanceOracle::getBestScanKernel() != oracle.getScanKernel())
+    {
+        throw std::runtime_error("Best kernel not selected");
+    }
+    for(count = 1; count < 40; count += 3)
+    {
+        randomCities.clear();
+        for(i = 0; i < count * 7; ++i)
+        {
+            city.id = i;
+            city.x  = (uint32_t)coordinate(generator) / 10;
+            city.y  = (uint32_t)coordinate(generator) / 10;
+            randomCities.push_back(city);
+        }
+        checkKernel(randomCities, SCAN_KERNEL_SCALAR);
+        checkKernel(randomCities, SCAN_KERNEL_AVX2);
+    }
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
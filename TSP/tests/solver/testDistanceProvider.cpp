@@ -0,0 +1,223 @@
+#include <iostream>  /* std::cout, std::endl */
+#include <vector>    /* std::vector */
+#include <string>    /* std::string */
+#include <random>    /* std::mt19937 */
+#include <algorithm> /* std::sort */
+#include <cmath>     /* std::fabs */
+#include <stdexcept> /* std::runtime_exception */
+
+#include "solver/DistanceProvider.h"
+#include "solver/NeighbourListDistanceProvider.h"
+#include "solver/FullMatrixDistanceProvider.h"
+#include "solver/TriangularDistanceProvider.h"
+
+using namespace nsSolver;
+
+/* Checks a backend against the oracle */
+static void checkBackend(const std::string&         name,
+                         const std::vector<city_t>& cities,
+                         const double               tolerance)
+{
+    uint32_t i;
+    uint32_t j;
+    double   expected;
+
+    DistanceProvider* oracle  = DistanceProvider::create("oracle", cities,
+                                                         HUGE_PAGES_OFF, "");
+    DistanceProvider* backend = DistanceProvider::create(name, cities,
+                                                         HUGE_PAGES_OFF, "");
+
+    if(backend == nullptr || name != backend->getName() ||
+       backend->getCityCount() != cities.size() ||
+       backend->getMemoryFootprint() >
+       DistanceProvider::getRequiredMemory(name, cities.size()))
+    {
+        throw std::runtime_error("Wrong backend " + name);
+    }
+    for(i = 0; i < cities.size(); ++i)
+    {
+        for(j = 0; j < cities.size(); ++j)
+        {
+            expected = oracle->getDistance(i, j);
+            if(std::fabs(backend->getDistance(i, j) - expected) >
+               tolerance * (1 + expected))
+            {
+                throw std::runtime_error("Wrong distance with " + name);
+            }
+        }
+    }
+
+    delete backend;
+    delete oracle;
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    uint32_t i;
+    uint32_t j;
+    uint32_t count;
+    uint64_t bytes;
+    city_t   city;
+
+    const uint32_t*       neighbours;
+    std::vector<city_t>   cities;
+    std::vector<city_t>   moved;
+    std::vector<uint32_t> expected;
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> coordinate(0, 1000);
+
+    for(i = 0; i < 300; ++i)
+    {
+        city.id = i;
+        city.x  = coordinate(generator);
+        city.y  = coordinate(generator);
+        cities.push_back(city);
+    }
+
+    /* Backends */
+    checkBackend("matrix", cities, 0);
+    checkBackend("triangular", cities, 1e-6);
+    checkBackend("neighbours", cities, 0);
+    checkBackend("oracle", cities, 0);
+    if(DistanceProvider::create("sphere", cities, HUGE_PAGES_OFF, "") !=
+       nullptr)
+    {
+        throw std::runtime_error("Unknown backend created");
+    }
+
+    /* Rebuilds only happen when the cities change */
+    FullMatrixDistanceProvider matrix(cities, HUGE_PAGES_OFF);
+    TriangularDistanceProvider triangle(cities, HUGE_PAGES_OFF);
+    if(matrix.rebuild(cities) || triangle.rebuild(cities))
+    {
+        throw std::runtime_error("Rebuilt with the same cities");
+    }
+    moved = cities;
+    moved[7].x += 1;
+    moved.resize(moved.size() - 1);
+    if(!matrix.rebuild(moved) || !triangle.rebuild(moved) ||
+       matrix.getCityCount() != moved.size() ||
+       triangle.getCityCount() != moved.size())
+    {
+        throw std::runtime_error("Not rebuilt with new cities");
+    }
+    moved[7].x += 1;
+    if(!matrix.rebuild(moved) || !triangle.rebuild(moved))
+    {
+        throw std::runtime_error("Not rebuilt with moved cities");
+    }
+    DistanceOracle movedOracle(moved);
+    for(i = 0; i < moved.size(); ++i)
+    {
+        for(j = 0; j < moved.size(); ++j)
+        {
+            if(matrix.getDistance(i, j) != movedOracle.getDistance(i, j) ||
+               triangle.getDistance(i, j) !=
+               (float)movedOracle.getDistance(i, j))
+            {
+                throw std::runtime_error("Wrong rebuilt distance");
+            }
+        }
+    }
+
+    /* Neighbour lists against a brute force search */
+    NeighbourListDistanceProvider lists(cities, "");
+    for(i = 0; i < cities.size(); ++i)
+    {
+        expected.clear();
+        for(j = 0; j < cities.size(); ++j)
+        {
+            if(j != i)
+            {
+                expected.push_back(j);
+            }
+        }
+        std::sort(expected.begin(), expected.end(),
+                  [&lists, i](const uint32_t a, const uint32_t b)
+                  {
+                      return lists.getDistance(i, a) <
+                             lists.getDistance(i, b);
+                  });
+
+        count = lists.getNeighbours(i, &neighbours);
+        if(count != NEIGHBOUR_LIST_SIZE)
+        {
+            throw std::runtime_error("Wrong neighbour count");
+        }
+        for(j = 0; j < count; ++j)
+        {
+            if(lists.getDistance(i, neighbours[j]) !=
+               lists.getDistance(i, expected[j]))
+            {
+                throw std::runtime_error("Wrong neighbour " +
+                                         std::to_string(j) + " of city " +
+                                         std::to_string(i));
+            }
+        }
+    }
+
+    /* Small problems have shorter lists */
+    NeighbourListDistanceProvider small(std::vector<city_t>(cities.begin(),
+                                                            cities.begin() +
+                                                            3),
+                                        "");
+    if(small.getNeighbours(0, &neighbours) != 2)
+    {
+        throw std::runtime_error("Wrong small neighbour count");
+    }
+
+    /* Selection from the budget */
+    const std::pair<uint64_t, std::string> budgets[] = {
+        {UINT64_MAX, "matrix"},
+        {300 * 300 * 8 + 300 * 16, "matrix"},
+        {300 * 300 * 8 + 300 * 16 - 1, "triangular"},
+        {300 * 299 * 2 + 300 * 16, "triangular"},
+        {300 * 84 + 4, "neighbours"},
+        {300 * 84 + 3, "oracle"},
+        {0, "oracle"}
+    };
+    for(i = 0; i < sizeof(budgets) / sizeof(budgets[0]); ++i)
+    {
+        DistanceProvider* selected =
+            DistanceProvider::select(cities, budgets[i].first,
+                                     HUGE_PAGES_OFF, "");
+        if(budgets[i].second != selected->getName())
+        {
+            throw std::runtime_error("Wrong selection for budget " +
+                                     std::to_string(budgets[i].first) +
+                                     ": " + selected->getName());
+        }
+        delete selected;
+    }
+
+    /* Sizes */
+    if(!DistanceProvider::parseSize("1024", bytes) || bytes != 1024 ||
+       !DistanceProvider::parseSize("2K", bytes) || bytes != 2048 ||
+       !DistanceProvider::parseSize("3M", bytes) || bytes != 3 << 20 ||
+       !DistanceProvider::parseSize("4g", bytes) || bytes != 4ULL << 30 ||
+       DistanceProvider::parseSize("", bytes) ||
+       DistanceProvider::parseSize("-1", bytes) ||
+       DistanceProvider::parseSize("5T", bytes) ||
+       DistanceProvider::parseSize("5MB", bytes))
+    {
+        throw std::runtime_error("Wrong size parsing");
+    }
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
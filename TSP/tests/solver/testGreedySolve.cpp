@@ -1,9 +1,73 @@
 #include <iostream>
+#include <vector>
+#include <random>
+#include <string>
+#include <stdexcept>
+#include <cmath>
 
 #include "solver/GreedySolver.h"
+#include "solver/DistanceProvider.h"
+#include "solver/DistanceOracle.h"
 
 using namespace nsSolver;
 
+static std::vector<city_t> getCities(const uint32_t count)
+{
+    uint32_t i;
+    city_t   city;
+
+    std::vector<city_t> cities;
+
+    std::mt19937 generator(count);
+    std::uniform_real_distribution<double> coordinate(0, 3000);
+
+    for(i = 0; i < count; ++i)
+    {
+        city.id = i;
+        city.x  = coordinate(generator);
+        city.y  = coordinate(generator);
+        cities.push_back(city);
+    }
+
+    return cities;
+}
+
+/* Builds the nearest neighbour tour by scanning every city at each step */
+static std::vector<uint32_t> getScanTour(const std::vector<city_t>& cities)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t best;
+    double   bestDistance;
+    double   candidate;
+
+    std::vector<uint32_t> tour;
+    std::vector<uint8_t>  visited(cities.size(), false);
+
+    DistanceOracle oracle(cities);
+
+    tour.push_back(0);
+    visited[0] = true;
+    for(i = 1; i < cities.size(); ++i)
+    {
+        best         = 0;
+        bestDistance = -1;
+        for(j = 0; j < cities.size(); ++j)
+        {
+            candidate = oracle.getDistance(tour.back(), j);
+            if(!visited[j] && (bestDistance == -1 || candidate < bestDistance))
+            {
+                best         = j;
+                bestDistance = candidate;
+            }
+        }
+        visited[best] = true;
+        tour.push_back(best);
+    }
+
+    return tour;
+}
+
 int main(int argc, char** argv)
 {
     (void)argc;
@@ -11,10 +75,77 @@ int main(int argc, char** argv)
 
     #ifdef _TESTMODE
 
-    GreedySolver* solver = new GreedySolver(4);
+    uint32_t i;
+    double   reference;
+    double   distance;
+
+    std::vector<uint32_t> referenceTour;
+    std::vector<uint32_t> tour;
+    std::vector<city_t>   cities = getCities(500);
+    std::vector<city_t>   clustered;
+    const char* backends[] = {"oracle", "matrix", "triangular", "neighbours"};
+
+    GreedySolver* solver = new GreedySolver(cities);
+    solver->testSolve();
+    solver->solve(referenceTour, reference);
+    delete solver;
+    if(referenceTour != getScanTour(cities))
+    {
+        throw std::runtime_error("Grid tour differs from the scan tour");
+    }
+
+    /* Small problems are scanned instead of using the grid */
+    clustered = getCities(GREEDY_GRID_MIN_SIZE - 1);
+    solver    = new GreedySolver(clustered);
+    solver->testSolve();
+    solver->solve(tour, distance);
+    delete solver;
+    if(tour != getScanTour(clustered))
+    {
+        throw std::runtime_error("Scanned tour differs from the scan tour");
+    }
+
+    /* Clustered cities, with duplicates, leave large empty areas */
+    clustered = getCities(300);
+    for(i = 0; i < clustered.size(); ++i)
+    {
+        clustered[i].x = (i % 3) * 1000 + std::fmod(clustered[i].x, 10.0);
+        clustered[i].y = (i % 3) * 1000 + std::fmod(clustered[i].y, 10.0);
+    }
+    clustered.push_back(clustered[5]);
+    clustered.push_back(clustered[5]);
+    solver = new GreedySolver(clustered);
+    solver->testSolve();
+    solver->solve(tour, distance);
+    delete solver;
+    if(tour != getScanTour(clustered))
+    {
+        throw std::runtime_error("Grid tour differs on clustered cities");
+    }
+
+    /* Every backend gives a valid tour, the exact ones give the same tour */
+    for(i = 0; i < sizeof(backends) / sizeof(backends[0]); ++i)
+    {
+        DistanceProvider* distances =
+            DistanceProvider::create(backends[i], cities, HUGE_PAGES_OFF,
+                                     "");
+        solver = new GreedySolver(cities, distances);
+        solver->testSolve();
+        solver->solve(tour, distance);
+        if(std::string(backends[i]) != "triangular" &&
+           (tour != referenceTour || distance != reference))
+        {
+            throw std::runtime_error(std::string("Wrong tour with ") +
+                                     backends[i]);
+        }
+        delete solver;
+        delete distances;
+    }
+
+    solver = new GreedySolver(getCities(1));
     solver->testSolve();
     delete solver;
-    solver = new GreedySolver(0);
+    solver = new GreedySolver(getCities(0));
     solver->testSolve();
     delete solver;
 
@@ -29,4 +160,4 @@ int main(int argc, char** argv)
     return -1;
 
     #endif
-}
\ No newline at end of file
+}
@@ -0,0 +1,188 @@
+#include <iostream>  /* std::cout, std::endl */
+#include <vector>    /* std::vector */
+#include <string>    /* std::to_string */
+#include <random>    /* std::mt19937 */
+#include <cmath>     /* std::fabs */
+#include <stdexcept> /* std::runtime_exception */
+
+#include "solver/LinKernighanSolver.h"
+#include "solver/LocalSearchSolver.h"
+#include "solver/GreedySolver.h"
+#include "solver/DistanceOracle.h"
+
+using namespace nsSolver;
+
+static std::vector<city_t> getCities(const uint32_t count,
+                                     const bool     clustered)
+{
+    uint32_t i;
+    city_t   city;
+
+    std::vector<city_t> cities;
+
+    std::mt19937 generator(count);
+    std::uniform_real_distribution<double> coordinate(0, 3000);
+
+    for(i = 0; i < count; ++i)
+    {
+        city.id = i;
+        city.x  = coordinate(generator);
+        city.y  = coordinate(generator);
+        if(clustered)
+        {
+            city.x = (i % 5) * 10000 + city.x / 20;
+            city.y = (i % 3) * 10000 + city.y / 20;
+        }
+        cities.push_back(city);
+    }
+
+    return cities;
+}
+
+/* Checks the solution is a tour matching its length */
+static void checkSolution(const DistanceOracle&        oracle,
+                          const std::vector<uint32_t>& solution,
+                          const double                 distance)
+{
+    uint32_t i;
+
+    std::vector<uint8_t> seen(oracle.getCityCount(), false);
+
+    if(solution.size() != oracle.getCityCount())
+    {
+        throw std::runtime_error("Wrong solution size: " +
+                                 std::to_string(solution.size()));
+    }
+    for(i = 0; i < solution.size(); ++i)
+    {
+        if(solution[i] >= solution.size() || seen[solution[i]])
+        {
+            throw std::runtime_error("Solution is not a tour");
+        }
+        seen[solution[i]] = true;
+    }
+    if(std::fabs(oracle.getTourLength(solution) - distance) >
+       1e-6 * (1 + distance))
+    {
+        throw std::runtime_error("Solution does not match its distance");
+    }
+}
+
+/* Checks the gains of the moves add up to the improvement */
+static void checkGains(const LocalSearchSolver& solver,
+                       const double             greedyDistance,
+                       const double             distance)
+{
+    uint32_t type;
+    uint64_t applied;
+    double   gain;
+
+    applied = 0;
+    gain    = 0;
+    for(type = 0; type < MOVE_TYPE_COUNT; ++type)
+    {
+        applied += solver.getStats((MoveType)type).applied;
+        gain    += solver.getStats((MoveType)type).gain;
+    }
+    if(applied != solver.getMoveCount() ||
+       std::fabs(greedyDistance - gain - distance) > 1e-6 * (1 + distance))
+    {
+        throw std::runtime_error("Wrong move gains");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    uint32_t i;
+    uint32_t j;
+    uint32_t type;
+    double   distance;
+    double   greedyDistance;
+    double   localDistance;
+
+    std::vector<city_t>   cities;
+    std::vector<uint32_t> solution;
+    std::vector<uint32_t> sizes = {1, 2, 3, 4, 5, 8, 10, 150, 1000, 3000,
+                                   LOCAL_SEARCH_LIST_TOUR_SIZE};
+
+    for(i = 0; i < sizes.size(); ++i)
+    {
+        for(j = 0; j < 2; ++j)
+        {
+            cities = getCities(sizes[i], j == 1);
+            DistanceOracle oracle(cities);
+
+            GreedySolver greedy(cities, &oracle);
+            greedy.solve(solution, greedyDistance);
+
+            LocalSearchSolver local(cities, &oracle, UINT32_MAX, "");
+            local.solve(solution, localDistance);
+
+            LinKernighanSolver solver(cities, &oracle, UINT32_MAX, "");
+            solver.solve(solution, distance);
+            checkSolution(oracle, solution, distance);
+            checkGains(solver, greedyDistance, distance);
+
+            /* Only the Lin-Kernighan moves are searched by default */
+            for(type = 0; type < MOVE_TYPE_COUNT; ++type)
+            {
+                if(type != MOVE_LIN_KERNIGHAN &&
+                   solver.getStats((MoveType)type).evaluated != 0)
+                {
+                    throw std::runtime_error("Disabled move searched");
+                }
+            }
+
+            /* The variable depth moves improve the local optima of the
+             * other moves on the uniform tours */
+            if(distance > greedyDistance + 1e-6 ||
+               (sizes[i] >= 1000 && j == 0 && distance > 0.99 * localDistance))
+            {
+                throw std::runtime_error("No improvement on " +
+                                         std::to_string(sizes[i]) +
+                                         " cities: " +
+                                         std::to_string(distance) + " / " +
+                                         std::to_string(localDistance));
+            }
+
+            /* The other moves keep improving the Lin-Kernighan tour */
+            LinKernighanSolver combined(cities, &oracle, UINT32_MAX, "");
+            for(type = 0; type < MOVE_TYPE_COUNT; ++type)
+            {
+                combined.setMoveEnabled((MoveType)type, true);
+            }
+            combined.solve(solution, distance);
+            checkSolution(oracle, solution, distance);
+            checkGains(combined, greedyDistance, distance);
+        }
+    }
+
+    /* The number of moves is bounded by the iteration count */
+    cities = getCities(1000, false);
+    LinKernighanSolver limited(cities, nullptr, 10, "");
+    limited.solve(solution, distance);
+    if(limited.getMoveCount() != 10)
+    {
+        throw std::runtime_error("Wrong move count: " +
+                                 std::to_string(limited.getMoveCount()));
+    }
+    DistanceOracle oracle(cities);
+    checkSolution(oracle, solution, distance);
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
@@ -0,0 +1,248 @@
+#include <iostream>  /* std::cout, std::endl */
+#include <vector>    /* std::vector */
+#include <string>    /* std::to_string */
+#include <random>    /* std::mt19937 */
+#include <cmath>     /* std::fabs */
+#include <stdexcept> /* std::runtime_exception */
+
+#include "solver/LocalSearchSolver.h"
+#include "solver/GreedySolver.h"
+#include "solver/DistanceOracle.h"
+#include "solver/NeighbourLists.h"
+#include "solver/ArrayTour.h"
+
+using namespace nsSolver;
+
+static std::vector<city_t> getCities(const uint32_t count,
+                                     const bool     clustered)
+{
+    uint32_t i;
+    city_t   city;
+
+    std::vector<city_t> cities;
+
+    std::mt19937 generator(count);
+    std::uniform_real_distribution<double> coordinate(0, 3000);
+
+    for(i = 0; i < count; ++i)
+    {
+        city.id = i;
+        city.x  = coordinate(generator);
+        city.y  = coordinate(generator);
+        if(clustered)
+        {
+            city.x = (i % 5) * 10000 + city.x / 20;
+            city.y = (i % 3) * 10000 + city.y / 20;
+        }
+        cities.push_back(city);
+    }
+
+    return cities;
+}
+
+/* Checks the solution is a tour matching its length */
+static void checkSolution(const DistanceOracle&        oracle,
+                          const std::vector<uint32_t>& solution,
+                          const double                 distance)
+{
+    uint32_t i;
+
+    std::vector<uint8_t> seen(oracle.getCityCount(), false);
+
+    if(solution.size() != oracle.getCityCount())
+    {
+        throw std::runtime_error("Wrong solution size: " +
+                                 std::to_string(solution.size()));
+    }
+    for(i = 0; i < solution.size(); ++i)
+    {
+        if(solution[i] >= solution.size() || seen[solution[i]])
+        {
+            throw std::runtime_error("Solution is not a tour");
+        }
+        seen[solution[i]] = true;
+    }
+    if(std::fabs(oracle.getTourLength(solution) - distance) >
+       1e-6 * (1 + distance))
+    {
+        throw std::runtime_error("Solution does not match its distance");
+    }
+}
+
+/* Checks that no 2-opt move adding an edge from a city to one of its
+ * candidates, shorter than the removed edge of the city, improves the tour */
+static void checkLocalOptimum(const std::vector<city_t>&   cities,
+                              const std::vector<uint32_t>& solution)
+{
+    uint32_t j;
+    uint32_t k;
+    uint32_t count;
+    uint32_t a;
+    uint32_t b;
+    uint32_t c;
+    uint32_t d;
+    double   delta;
+
+    const uint32_t* neighbours;
+
+    DistanceOracle oracle(cities);
+    ArrayTour      tour(solution);
+    NeighbourLists lists(cities, LOCAL_SEARCH_NEAREST_COUNT,
+                         LOCAL_SEARCH_QUADRANT_COUNT, "");
+
+    for(a = 0; a < cities.size(); ++a)
+    {
+        count = lists.getNeighbours(a, &neighbours);
+        for(k = 0; k < 2; ++k)
+        {
+            b = k == 0 ? tour.getNext(a) : tour.getPrev(a);
+            for(j = 0; j < count; ++j)
+            {
+                c = neighbours[j];
+                d = k == 0 ? tour.getNext(c) : tour.getPrev(c);
+                if(c == b || d == a ||
+                   oracle.getDistance(a, c) >= oracle.getDistance(a, b))
+                {
+                    continue;
+                }
+                delta = oracle.getDistance(a, c) + oracle.getDistance(b, d) -
+                        oracle.getDistance(a, b) - oracle.getDistance(c, d);
+                if(delta < -LOCAL_SEARCH_EPSILON)
+                {
+                    throw std::runtime_error("Improving move left at city " +
+                                             std::to_string(a));
+                }
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+    uint32_t type;
+    uint64_t applied;
+    double   distance;
+    double   greedyDistance;
+    double   twoOptDistance;
+    double   gain;
+
+    std::vector<city_t>   cities;
+    std::vector<uint32_t> solution;
+    std::vector<uint32_t> sizes = {1, 2, 3, 4, 5, 10, 150, 1000, 3000,
+                                   LOCAL_SEARCH_LIST_TOUR_SIZE};
+
+    /* Enabled move types: 2-opt, Or-opt, segment insertion, then all */
+    std::vector<uint32_t> masks = {1, 2, 4, 7};
+
+    for(i = 0; i < sizes.size(); ++i)
+    {
+        for(j = 0; j < 2; ++j)
+        {
+            cities = getCities(sizes[i], j == 1);
+            DistanceOracle oracle(cities);
+
+            GreedySolver greedy(cities, &oracle);
+            greedy.solve(solution, greedyDistance);
+
+            twoOptDistance = greedyDistance;
+            for(k = 0; k < masks.size(); ++k)
+            {
+                LocalSearchSolver solver(cities, &oracle, UINT32_MAX, "");
+                for(type = 0; type < MOVE_TYPE_COUNT; ++type)
+                {
+                    solver.setMoveEnabled((MoveType)type,
+                                          (masks[k] >> type) & 1);
+                }
+                solver.solve(solution, distance);
+                checkSolution(oracle, solution, distance);
+
+                /* The gains of the moves add up to the improvement, which
+                 * checks that each move is applied as evaluated */
+                applied = 0;
+                gain    = 0;
+                for(type = 0; type < MOVE_TYPE_COUNT; ++type)
+                {
+                    applied += solver.getStats((MoveType)type).applied;
+                    gain    += solver.getStats((MoveType)type).gain;
+                    if(((masks[k] >> type) & 1) == 0 &&
+                       solver.getStats((MoveType)type).evaluated != 0)
+                    {
+                        throw std::runtime_error("Disabled move searched");
+                    }
+                }
+                if(applied != solver.getMoveCount() ||
+                   std::fabs(greedyDistance - gain - distance) >
+                   1e-6 * (1 + distance))
+                {
+                    throw std::runtime_error("Wrong move gains with moves " +
+                                             std::to_string(masks[k]) +
+                                             " on " +
+                                             std::to_string(sizes[i]) +
+                                             " cities");
+                }
+
+                if((masks[k] & 1) != 0)
+                {
+                    checkLocalOptimum(cities, solution);
+                }
+                if(masks[k] == 1)
+                {
+                    twoOptDistance = distance;
+                }
+
+                /* The edges between the clusters dominate the clustered
+                 * tours, only the uniform tours must improve by a margin */
+                if(distance > greedyDistance + 1e-6 ||
+                   ((masks[k] & 1) != 0 && sizes[i] >= 150 && j == 0 &&
+                    distance > 0.97 * greedyDistance))
+                {
+                    throw std::runtime_error("No improvement on " +
+                                             std::to_string(sizes[i]) +
+                                             " cities");
+                }
+
+                /* The other moves improve the 2-opt local optima of the
+                 * uniform tours */
+                if(masks[k] == 7 && sizes[i] >= 1000 && j == 0 &&
+                   distance > 0.99 * twoOptDistance)
+                {
+                    throw std::runtime_error("No improvement over 2-opt on " +
+                                             std::to_string(sizes[i]) +
+                                             " cities");
+                }
+            }
+        }
+    }
+
+    /* The number of moves is bounded by the iteration count */
+    cities = getCities(1000, false);
+    LocalSearchSolver limited(cities, nullptr, 10, "");
+    limited.solve(solution, distance);
+    if(limited.getMoveCount() != 10)
+    {
+        throw std::runtime_error("Wrong move count: " +
+                                 std::to_string(limited.getMoveCount()));
+    }
+    DistanceOracle oracle(cities);
+    checkSolution(oracle, solution, distance);
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
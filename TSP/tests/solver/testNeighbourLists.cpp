@@ -0,0 +1,238 @@
+#include <iostream>  /* std::cout, std::endl */
+#include <vector>    /* std::vector */
+#include <string>    /* std::string */
+#include <random>    /* std::mt19937 */
+#include <algorithm> /* std::sort, std::unique */
+#include <utility>   /* std::pair */
+#include <fstream>   /* std::ofstream */
+#include <cstdio>    /* std::remove */
+#include <cstdlib>   /* mkdtemp */
+#include <unistd.h>  /* rmdir */
+#include <stdexcept> /* std::runtime_exception */
+
+#include "solver/NeighbourLists.h"
+#include "solver/SpatialGrid.h"
+
+using namespace nsSolver;
+
+/* Returns the list of a city by sorting every other city */
+static std::vector<uint32_t> getScanList(const std::vector<city_t>& cities,
+                                         const uint32_t             city,
+                                         const uint32_t             nearest,
+                                         const uint32_t             quadrant)
+{
+    uint32_t i;
+    uint32_t q;
+    double   dx;
+    double   dy;
+
+    std::vector<std::pair<double, uint32_t>> sorted;
+    std::vector<std::pair<double, uint32_t>> selected;
+    std::vector<uint32_t>                    list;
+    uint32_t counts[SPATIAL_GRID_QUADRANTS] = {0, 0, 0, 0};
+
+    for(i = 0; i < cities.size(); ++i)
+    {
+        dx = cities[i].x - cities[city].x;
+        dy = cities[i].y - cities[city].y;
+        if(i != city)
+        {
+            sorted.push_back(std::make_pair(dx * dx + dy * dy, i));
+        }
+    }
+    std::sort(sorted.begin(), sorted.end());
+
+    for(i = 0; i < sorted.size(); ++i)
+    {
+        dx = cities[sorted[i].second].x - cities[city].x;
+        dy = cities[sorted[i].second].y - cities[city].y;
+        q  = dy >= 0 ? (dx >= 0 ? 0 : 1) : (dx >= 0 ? 3 : 2);
+        if(i < nearest || counts[q] < quadrant)
+        {
+            selected.push_back(sorted[i]);
+        }
+        ++counts[q];
+    }
+    for(i = 0; i < selected.size(); ++i)
+    {
+        list.push_back(selected[i].second);
+    }
+
+    return list;
+}
+
+/* Checks every list against the scan */
+static void checkLists(const std::vector<city_t>& cities,
+                       const uint32_t             nearest,
+                       const uint32_t             quadrant)
+{
+    uint32_t i;
+    uint32_t count;
+
+    const uint32_t* list;
+
+    NeighbourLists lists(cities, nearest, quadrant, "");
+
+    if(lists.getCityCount() != cities.size() || lists.isCached() ||
+       lists.getNearestCount() != nearest ||
+       lists.getQuadrantCount() != quadrant)
+    {
+        throw std::runtime_error("Wrong lists parameters");
+    }
+    for(i = 0; i < cities.size(); ++i)
+    {
+        count = lists.getNeighbours(i, &list);
+        if(std::vector<uint32_t>(list, list + count) !=
+           getScanList(cities, i, nearest, quadrant))
+        {
+            throw std::runtime_error("Wrong list for city " +
+                                     std::to_string(i) + " with " +
+                                     std::to_string(nearest) + " nearest and " +
+                                     std::to_string(quadrant) +
+                                     " per quadrant");
+        }
+    }
+}
+
+/* Tells if two lists objects hold the same lists */
+static bool isEqual(const NeighbourLists& a, const NeighbourLists& b)
+{
+    uint32_t i;
+    uint32_t countA;
+    uint32_t countB;
+
+    const uint32_t* listA;
+    const uint32_t* listB;
+
+    if(a.getCityCount() != b.getCityCount())
+    {
+        return false;
+    }
+    for(i = 0; i < a.getCityCount(); ++i)
+    {
+        countA = a.getNeighbours(i, &listA);
+        countB = b.getNeighbours(i, &listB);
+        if(std::vector<uint32_t>(listA, listA + countA) !=
+           std::vector<uint32_t>(listB, listB + countB))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    uint32_t i;
+    city_t   city;
+
+    std::vector<city_t> cities;
+    std::vector<city_t> clustered;
+    std::string         fileName;
+    char                directory[] = "/tmp/testNeighbourListsXXXXXX";
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> coordinate(0, 1000);
+
+    /* More cities than a build task, so several tasks run */
+    for(i = 0; i < 1500; ++i)
+    {
+        city.id = i;
+        city.x  = coordinate(generator);
+        city.y  = coordinate(generator);
+        cities.push_back(city);
+    }
+
+    /* Clusters far apart and duplicates, the quadrants reach across the
+     * empty areas */
+    clustered = std::vector<city_t>(cities.begin(), cities.begin() + 400);
+    for(i = 0; i < clustered.size(); ++i)
+    {
+        clustered[i].x = (i % 4) * 1000 + clustered[i].x / 50;
+        clustered[i].y = (i % 3) * 1000 + clustered[i].y / 50;
+    }
+    clustered[1] = clustered[0];
+    clustered[2] = clustered[0];
+
+    checkLists(cities, 8, 0);
+    checkLists(cities, 5, 2);
+    checkLists(clustered, 10, 0);
+    checkLists(clustered, 6, 3);
+    checkLists(clustered, 0, 1);
+    checkLists(std::vector<city_t>(cities.begin(), cities.begin() + 5), 8, 2);
+    checkLists(std::vector<city_t>(cities.begin(), cities.begin() + 1), 8, 2);
+
+    /* Cache */
+    if(mkdtemp(directory) == nullptr)
+    {
+        throw std::runtime_error("Cannot create the cache directory");
+    }
+    fileName = NeighbourLists::getCacheFile(directory,
+                                            NeighbourLists::getHash(cities),
+                                            8, 2);
+
+    NeighbourLists built(cities, 8, 2, directory);
+    NeighbourLists loaded(cities, 8, 2, directory);
+    NeighbourLists uncached(cities, 8, 2, "");
+    if(built.isCached() || !loaded.isCached() || !isEqual(built, loaded) ||
+       !isEqual(built, uncached))
+    {
+        throw std::runtime_error("Wrong cached lists");
+    }
+
+    /* Other sizes and other cities are other files */
+    NeighbourLists otherSize(cities, 8, 3, directory);
+    NeighbourLists otherCities(clustered, 8, 2, directory);
+    if(otherSize.isCached() || otherCities.isCached() ||
+       NeighbourLists::getHash(cities) == NeighbourLists::getHash(clustered))
+    {
+        throw std::runtime_error("Wrong cache key");
+    }
+
+    /* A truncated file is rebuilt and rewritten */
+    std::ofstream(fileName, std::ofstream::trunc) << "TSPNBRS1";
+    NeighbourLists rebuilt(cities, 8, 2, directory);
+    NeighbourLists reloaded(cities, 8, 2, directory);
+    if(rebuilt.isCached() || !reloaded.isCached() ||
+       !isEqual(rebuilt, uncached) || !isEqual(reloaded, uncached))
+    {
+        throw std::runtime_error("Truncated cache file used");
+    }
+
+    /* A directory that does not exist only disables the cache */
+    NeighbourLists missing(cities, 8, 2, std::string(directory) + "/none");
+    if(missing.isCached() || !isEqual(missing, uncached))
+    {
+        throw std::runtime_error("Wrong lists without cache");
+    }
+
+    std::remove(fileName.c_str());
+    std::remove(NeighbourLists::getCacheFile(directory,
+                                             NeighbourLists::getHash(cities),
+                                             8, 3).c_str());
+    std::remove(NeighbourLists::getCacheFile(
+                    directory, NeighbourLists::getHash(clustered),
+                    8, 2).c_str());
+    if(rmdir(directory) != 0)
+    {
+        throw std::runtime_error("Unexpected files in the cache directory");
+    }
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
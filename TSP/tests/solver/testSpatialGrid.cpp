@@ -0,0 +1,159 @@
+#include <iostream>  /* std::cout, std::endl */
+#include <vector>    /* std::vector */
+#include <random>    /* std::mt19937 */
+#include <algorithm> /* std::shuffle */
+#include <stdexcept> /* std::runtime_exception */
+
+#include "solver/SpatialGrid.h"
+
+using namespace nsSolver;
+
+/* Returns the nearest remaining city by scanning every city */
+static uint32_t getScanNearest(const std::vector<city_t>&  cities,
+                               const std::vector<uint8_t>& removed,
+                               const double                px,
+                               const double                py)
+{
+    uint32_t i;
+    uint32_t best;
+    double   bestDistance;
+    double   distance;
+
+    best         = SPATIAL_GRID_NONE;
+    bestDistance = -1;
+    for(i = 0; i < cities.size(); ++i)
+    {
+        distance = (cities[i].x - px) * (cities[i].x - px) +
+                   (cities[i].y - py) * (cities[i].y - py);
+        if(!removed[i] && (bestDistance == -1 || distance < bestDistance))
+        {
+            best         = i;
+            bestDistance = distance;
+        }
+    }
+
+    return best;
+}
+
+/* Removes the cities in a random order and checks each query against the
+ * scan */
+static void checkGrid(const std::vector<city_t>& cities)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t expected;
+    uint32_t nearest;
+
+    std::vector<uint32_t> order(cities.size());
+    std::vector<uint8_t>  removed(cities.size(), false);
+    std::mt19937          generator(cities.size());
+    std::uniform_real_distribution<double> coordinate(-100, 1100);
+
+    SpatialGrid grid(cities);
+
+    for(i = 0; i < order.size(); ++i)
+    {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), generator);
+
+    for(i = 0; i < order.size(); ++i)
+    {
+        if(grid.getCount() != cities.size() - i)
+        {
+            throw std::runtime_error("Wrong city count");
+        }
+
+        /* From the cities and from random points, inside and outside the
+         * cities bounds */
+        for(j = 0; j < 4; ++j)
+        {
+            const double px = j == 0 ? cities[order[i]].x :
+                                       coordinate(generator);
+            const double py = j == 0 ? cities[order[i]].y :
+                                       coordinate(generator);
+
+            expected = getScanNearest(cities, removed, px, py);
+            nearest  = grid.getNearest(px, py);
+            if(nearest != expected)
+            {
+                throw std::runtime_error("Wrong nearest city " +
+                                         std::to_string(nearest) +
+                                         " instead of " +
+                                         std::to_string(expected));
+            }
+        }
+
+        grid.remove(order[i]);
+        removed[order[i]] = true;
+    }
+
+    if(grid.getCount() != 0 ||
+       grid.getNearest(0, 0) != SPATIAL_GRID_NONE)
+    {
+        throw std::runtime_error("Grid not empty");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    uint32_t i;
+    city_t   city;
+
+    std::vector<city_t> cities;
+    std::mt19937        generator(0);
+    std::uniform_real_distribution<double> coordinate(0, 1000);
+
+    /* Uniform cities */
+    for(i = 0; i < 2000; ++i)
+    {
+        city.id = i;
+        city.x  = coordinate(generator);
+        city.y  = coordinate(generator);
+        cities.push_back(city);
+    }
+    checkGrid(cities);
+
+    /* Two clusters far apart, with duplicates */
+    for(i = 0; i < cities.size(); ++i)
+    {
+        cities[i].x = (i % 2) * 1000 + cities[i].x / 100;
+        cities[i].y = cities[i].y / 100;
+    }
+    cities[10] = cities[20];
+    cities[11] = cities[20];
+    checkGrid(cities);
+
+    /* Cities on a line, then on a single point */
+    for(i = 0; i < cities.size(); ++i)
+    {
+        cities[i].y = 5;
+    }
+    checkGrid(cities);
+    for(i = 0; i < cities.size(); ++i)
+    {
+        cities[i].x = 5;
+    }
+    checkGrid(cities);
+
+    /* Single city and empty grid */
+    checkGrid(std::vector<city_t>(cities.begin(), cities.begin() + 1));
+    checkGrid(std::vector<city_t>());
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
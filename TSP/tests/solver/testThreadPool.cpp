@@ -0,0 +1,73 @@
+#include <iostream>  /* std::cout, std::endl */
+#include <vector>    /* std::vector */
+#include <atomic>    /* std::atomic */
+#include <stdexcept> /* std::runtime_exception */
+
+#include "solver/ThreadPool.h"
+
+using namespace nsSolver;
+
+/* Runs batches on a pool and checks each task ran exactly once */
+static void checkPool(ThreadPool& pool)
+{
+    uint32_t i;
+    uint32_t batch;
+
+    std::vector<std::atomic<uint32_t>> runs(1000);
+
+    for(batch = 0; batch < 20; ++batch)
+    {
+        for(i = 0; i < runs.size(); ++i)
+        {
+            runs[i] = 0;
+        }
+
+        pool.run(batch * 50, [&runs](const uint32_t task)
+        {
+            ++runs[task];
+        });
+
+        for(i = 0; i < runs.size(); ++i)
+        {
+            if(runs[i] != (i < batch * 50 ? 1U : 0U))
+            {
+                throw std::runtime_error("Wrong run count for task " +
+                                         std::to_string(i));
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    ThreadPool single(1);
+    ThreadPool quad(4);
+    ThreadPool machine;
+
+    if(single.getThreadCount() != 1 || quad.getThreadCount() != 4 ||
+       machine.getThreadCount() == 0)
+    {
+        throw std::runtime_error("Wrong thread count");
+    }
+
+    checkPool(single);
+    checkPool(quad);
+    checkPool(machine);
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
@@ -0,0 +1,182 @@
+#include <iostream>  /* std::cout, std::endl */
+#include <vector>    /* std::vector */
+#include <string>    /* std::to_string */
+#include <random>    /* std::mt19937 */
+#include <algorithm> /* std::reverse, std::min, std::max */
+#include <stdexcept> /* std::runtime_exception */
+
+#include "solver/Tour.h"
+#include "solver/ArrayTour.h"
+#include "solver/TwoLevelListTour.h"
+
+using namespace nsSolver;
+
+/* Checks a tour against the order of visit it should follow, in one of the
+ * two orientations */
+static void checkTour(const Tour&                  tour,
+                      const std::vector<uint32_t>& expected,
+                      std::mt19937&                generator)
+{
+    uint32_t i;
+    uint32_t a;
+    uint32_t b;
+    uint32_t c;
+    uint32_t size;
+    bool     between;
+
+    std::vector<uint32_t> order;
+    std::vector<uint32_t> position(expected.size());
+    std::vector<uint32_t> expectedPosition(expected.size());
+
+    size = expected.size();
+    tour.getOrder(order);
+    if(order.size() != size || tour.getCityCount() != size)
+    {
+        throw std::runtime_error("Wrong tour size");
+    }
+    for(i = 0; i < size; ++i)
+    {
+        position[order[i]]            = i;
+        expectedPosition[expected[i]] = i;
+    }
+
+    for(i = 0; i < size; ++i)
+    {
+        a = expected[(expectedPosition[i] + 1) % size];
+        b = expected[(expectedPosition[i] + size - 1) % size];
+        if(tour.getPrev(tour.getNext(i)) != i ||
+           order[(position[i] + 1) % size] != tour.getNext(i) ||
+           std::min(a, b) != std::min(tour.getNext(i), tour.getPrev(i)) ||
+           std::max(a, b) != std::max(tour.getNext(i), tour.getPrev(i)))
+        {
+            throw std::runtime_error("Wrong neighbours for city " +
+                                     std::to_string(i));
+        }
+    }
+
+    for(i = 0; i < 2 * size; ++i)
+    {
+        a = generator() % size;
+        b = generator() % size;
+        c = generator() % size;
+        if(position[a] <= position[c])
+        {
+            between = position[a] <= position[b] && position[b] <= position[c];
+        }
+        else
+        {
+            between = position[b] >= position[a] || position[b] <= position[c];
+        }
+        if(tour.isBetween(a, b, c) != between)
+        {
+            throw std::runtime_error("Wrong between");
+        }
+    }
+}
+
+/* Applies random reversals to a tour and to a reference array */
+static void testReversals(Tour& tour, const uint32_t size, const uint32_t runs)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t from;
+    uint32_t to;
+    uint32_t length;
+
+    std::vector<uint32_t> expected;
+    std::vector<uint32_t> rotated;
+
+    std::mt19937 generator(size);
+
+    tour.getOrder(expected);
+    checkTour(tour, expected, generator);
+
+    for(i = 0; i < runs; ++i)
+    {
+        from = generator() % size;
+        to   = i % 4 == 0 ? tour.getPrev(from) : generator() % size;
+
+        /* Short paths, which may span two segments */
+        if(i % 4 == 1)
+        {
+            to = from;
+            for(j = generator() % 8; j > 0; --j)
+            {
+                to = tour.getNext(to);
+            }
+        }
+
+        /* The reference starts at from, the path is its first cities */
+        tour.getOrder(rotated);
+        while(rotated[0] != from)
+        {
+            std::rotate(rotated.begin(), rotated.begin() + 1, rotated.end());
+        }
+        length = std::find(rotated.begin(), rotated.end(), to) -
+                 rotated.begin() + 1;
+        std::reverse(rotated.begin(), rotated.begin() + length);
+        expected = rotated;
+
+        tour.reverse(from, to);
+        checkTour(tour, expected, generator);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    #ifdef _TESTMODE
+
+    uint32_t i;
+    uint32_t size;
+
+    std::vector<uint32_t> order;
+
+    std::mt19937 generator(0);
+
+    for(size = 1; size < 70; size += size < 8 ? 1 : 13)
+    {
+        order.resize(size);
+        for(i = 0; i < size; ++i)
+        {
+            order[i] = i;
+        }
+        std::shuffle(order.begin(), order.end(), generator);
+
+        ArrayTour tour(order);
+        testReversals(tour, size, 200);
+
+        TwoLevelListTour listTour(order);
+        testReversals(listTour, size, 200);
+    }
+
+    /* Enough long reversals to balance the segments again */
+    order.resize(300);
+    for(i = 0; i < order.size(); ++i)
+    {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), generator);
+
+    TwoLevelListTour listTour(order);
+    testReversals(listTour, order.size(), 2000);
+    if(listTour.getRebuildCount() == 0 ||
+       listTour.getSegmentCount() > TWO_LEVEL_LIST_SEGMENT_FACTOR * 18 + 2)
+    {
+        throw std::runtime_error("Segments not balanced");
+    }
+
+    std::cout << "\033[1;32mPASSED\033[0m\t" << std::endl;
+
+    return 0;
+
+    #else
+
+    std::cout << "\033[1;33mTEST MODE DISABLED\033[0m\t" << std::endl;
+
+    return -1;
+
+    #endif
+}
@@ -1,8 +1,78 @@
 #! /bin/bash
 make clean
 
+################### Shared sources
+
+echo "Test huge page allocator copies"
+for file in include/solver/HugePageAllocator.h \
+            src/solver/HugePageAllocator.cpp; do
+    diff -I "@brief .* problem solvers\." $file ../NQueensProblem/$file
+    if [[ $? != 0 ]]; then
+        echo "FAIL: Test huge page allocator copies"
+        exit -1
+    fi
+done
+
+################### Distances
+
+echo "Test distance oracle"
+make test=true testDistanceOracle
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test distance oracle"
+    exit -1
+fi
+
+echo "Test distance providers"
+make test=true testDistanceProvider
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test distance providers"
+    exit -1
+fi
+
+echo "Test tour"
+make test=true testTour
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test tour"
+    exit -1
+fi
+
+echo "Test local search"
+make test=true testLocalSearch
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test local search"
+    exit -1
+fi
+
+echo "Test Lin-Kernighan"
+make test=true testLinKernighan
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test Lin-Kernighan"
+    exit -1
+fi
+
+echo "Test neighbour lists"
+make test=true testNeighbourLists
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test neighbour lists"
+    exit -1
+fi
+
+echo "Test thread pool"
+make test=true testThreadPool
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test thread pool"
+    exit -1
+fi
+
 ################### Greedy
 
+echo "Test spatial grid"
+make test=true testSpatialGrid
+if [[ $? != 0 ]]; then
+    echo "FAIL: Test spatial grid"
+    exit -1
+fi
+
 echo "Test greedy algorithm attack counter"
 make test=true testGreedyAttackCount
 if [[ $? != 0 ]]; then